@@ -0,0 +1,14 @@
+BENCH_IMPL_DIR=benchmarks
+INCLUDE_DIR=source_code
+COMPILER=clang++
+FLAGS="-std=c++14 -O2 -pthread"
+
+set -e
+
+if [[ -z "$1" ]]; then
+	echo "usage: ./benchmark.sh <name> (see: ${BENCH_IMPL_DIR}/)"
+	exit 1
+fi
+
+${COMPILER} ${FLAGS} -I ${INCLUDE_DIR} "${BENCH_IMPL_DIR}/$1.cpp" -o "$1"
+./"$1" ; rm ./"$1"
@@ -0,0 +1,171 @@
+/** @file interval_map_bench.cpp
+ *
+ * 	ft::interval_map against a std::multimap keyed by the low bounds on a
+ * 	million random windows: inserts, point (stabbing) and window overlap
+ * 	queries, erases. Without the max high bound of the subtrees, the
+ * 	std::multimap has to scan every window starting in [low - longest, high].
+ * 	That scan is slow enough that the std::multimap only runs the first
+ * 	BENCH_STD_QUERIES queries. The query phases are timed per query and the
+ * 	checksum covers those first queries, so both rows can be compared.
+ *
+ * 	./benchmark.sh interval_map_bench
+*/
+
+# include <chrono>
+# include <cstdio>
+# include <iostream>
+# include <map>
+# include <random>
+# include <stdexcept>
+
+# include <vector.hpp>
+# include <interval_map.hpp>
+
+# define BENCH_ITEMS 1000000UL
+# define BENCH_ROUNDS 3
+# define BENCH_QUERIES 0x10000UL
+# define BENCH_STD_QUERIES 0x400UL
+# define BENCH_SPACE 0x100000000UL
+# define BENCH_SHORT 0x1000UL
+# define BENCH_LONG 0x1000000UL
+
+typedef std::chrono::steady_clock	bench_clock;
+typedef ft::interval<unsigned long>	bench_window;
+
+static double
+bench_ms(bench_clock::time_point start)
+{ return (std::chrono::duration<double, std::milli>(bench_clock::now() - start).count()); }
+
+/// Sums the mapped values of the overlapping windows.
+struct bench_sum
+{
+	unsigned long	sum;
+
+	bench_sum() : sum(0) { }
+
+	void operator()(const std::pair<const bench_window, unsigned long>& value)
+	{ sum += value.second; }
+};
+
+//@{
+/**
+ * 	@brief The containers: ft::interval_map and std::multimap by low bound
+*/
+typedef ft::interval_map<unsigned long, unsigned long>						ft_windows;
+typedef std::multimap<unsigned long, std::pair<unsigned long, unsigned long> >	std_windows;
+
+static void
+bench_insert(ft_windows& m, const bench_window& w, unsigned long i)
+{ m.insert(ft_windows::value_type(w, i)); }
+
+static void
+bench_insert(std_windows& m, const bench_window& w, unsigned long i)
+{ m.insert(std_windows::value_type(w.low, std::make_pair(w.high, i))); }
+
+static unsigned long
+bench_overlaps(const ft_windows& m, const bench_window& q)
+{ return (m.for_each_overlap(q, bench_sum()).sum); }
+
+static unsigned long
+bench_overlaps(const std_windows& m, const bench_window& q)
+{
+	unsigned long					sum = 0;
+	std_windows::const_iterator		it = m.lower_bound(q.low > BENCH_LONG ? q.low - BENCH_LONG : 0);
+	const std_windows::const_iterator	last = m.upper_bound(q.high);
+
+	for ( ; it != last ; ++it)
+		if (it->second.first >= q.low)
+			sum += it->second.second;
+	return (sum);
+}
+
+static void
+bench_erase(ft_windows& m, const bench_window& w)
+{ m.erase(w); }
+
+static void
+bench_erase(std_windows& m, const bench_window& w)
+{ m.erase(w.low); }
+//@}
+
+/**
+ * 	@brief Window workload
+ *
+ * 	Prints the best time of each phase over BENCH_ROUNDS runs: in ms for
+ * 	the inserts and erases, in us per query for the @p count first point
+ * 	and window queries. The checksum sums the overlaps of the first
+ * 	BENCH_STD_QUERIES queries, then of the others.
+*/
+template <class Map>
+static void
+bench_windows(const char* name, const ft::vector<bench_window>& windows, const ft::vector<bench_window>& points,
+const ft::vector<bench_window>& queries, unsigned long count)
+{
+	double			best[4] = {0, 0, 0, 0};
+	unsigned long	checksum = 0;
+	unsigned long	rest = 0;
+
+	for (int round = 0 ; round < BENCH_ROUNDS ; round++)
+	{
+		Map						m;
+		double					ms[4];
+		bench_clock::time_point	start = bench_clock::now();
+
+		for (unsigned long i = 0 ; i < windows.size() ; i++)
+			bench_insert(m, windows[i], i);
+		ms[0] = bench_ms(start);
+
+		start = bench_clock::now();
+		checksum = 0;
+		rest = 0;
+		for (unsigned long i = 0 ; i < count ; i++)
+			(i < BENCH_STD_QUERIES ? checksum : rest) += bench_overlaps(m, points[i]);
+		ms[1] = bench_ms(start) * 1000 / count;
+
+		start = bench_clock::now();
+		for (unsigned long i = 0 ; i < count ; i++)
+			(i < BENCH_STD_QUERIES ? checksum : rest) += bench_overlaps(m, queries[i]);
+		ms[2] = bench_ms(start) * 1000 / count;
+
+		start = bench_clock::now();
+		for (unsigned long i = 0 ; i < windows.size() ; i++)
+			bench_erase(m, windows[i]);
+		ms[3] = bench_ms(start);
+
+		for (int phase = 0 ; phase < 4 ; phase++)
+			if (!round || ms[phase] < best[phase])
+				best[phase] = ms[phase];
+	}
+	std::printf("%-18s insert %8.2f  points %8.3f  windows %8.3f  erase %8.2f  (checksum %lu + %lu)\n",
+	name, best[0], best[1], best[2], best[3], checksum, rest);
+}
+
+int main()
+{
+	ft::vector<bench_window>	windows;
+	ft::vector<bench_window>	points;
+	ft::vector<bench_window>	queries;
+	std::mt19937_64				gen(42);
+
+	/* Mostly short windows, one in 0x100 as long as BENCH_LONG */
+	for (unsigned long i = 0 ; i < BENCH_ITEMS ; i++)
+	{
+		const unsigned long low = gen() % BENCH_SPACE;
+		const unsigned long length = gen() % (i & 0xff ? BENCH_SHORT : BENCH_LONG);
+
+		windows.push_back(bench_window(low, low + length));
+	}
+	for (unsigned long i = 0 ; i < BENCH_QUERIES ; i++)
+	{
+		const unsigned long point = gen() % BENCH_SPACE;
+
+		points.push_back(bench_window(point, point));
+		queries.push_back(bench_window(point, point + gen() % BENCH_SHORT));
+	}
+	std::printf("== %lu random windows, %lu point and window queries (%lu for std::multimap) ==\n",
+	BENCH_ITEMS, BENCH_QUERIES, BENCH_STD_QUERIES);
+	std::printf("== insert and erase in ms, queries in us per query ==\n");
+	bench_windows<ft_windows>("ft::interval_map", windows, points, queries, BENCH_QUERIES);
+	bench_windows<std_windows>("std::multimap", windows, points, queries, BENCH_STD_QUERIES);
+	return (0);
+}
@@ -0,0 +1,210 @@
+/** @file map_bench.cpp
+ *
+ * 	ft::map against std::map on a million entries: random inserts,
+ * 	in-order traversal, lookups, erases, the construction from a
+ * 	sorted range, sorted appends hinted with end() and rank / nth queries.
+ * 	Build with -DFT_RBTREE_NODE_POOL=0 to compare without the node pool,
+ * 	-DFT_RBTREE_ORDER_STATISTICS=1 with the subtree sizes.
+ *
+ * 	./benchmark.sh map_bench
+*/
+
+# include <chrono>
+# include <algorithm>
+# include <cstdio>
+# include <iostream>
+# include <iterator>
+# include <map>
+# include <random>
+# include <stdexcept>
+
+# include <vector.hpp>
+# include <map.hpp>
+
+# define BENCH_ITEMS 1000000UL
+# define BENCH_ROUNDS 3
+# define BENCH_QUERIES 0x100UL
+
+typedef std::chrono::steady_clock	bench_clock;
+
+static double
+bench_ms(bench_clock::time_point start)
+{ return (std::chrono::duration<double, std::milli>(bench_clock::now() - start).count()); }
+
+/**
+ * 	@brief Map workload
+ *
+ * 	Prints the best time of each phase over BENCH_ROUNDS runs, in ms.
+*/
+template <class Map>
+static void
+bench_map(const char* name, const ft::vector<unsigned long>& keys)
+{
+	double			best[4] = {0, 0, 0, 0};
+	unsigned long	checksum = 0;
+
+	for (int round = 0 ; round < BENCH_ROUNDS ; round++)
+	{
+		Map						m;
+		double					ms[4];
+		bench_clock::time_point	start = bench_clock::now();
+
+		for (unsigned long i = 0 ; i < keys.size() ; i++)
+			m.insert(typename Map::value_type(keys[i], i));
+		ms[0] = bench_ms(start);
+
+		start = bench_clock::now();
+		checksum = 0;
+		for (typename Map::const_iterator it = m.begin() ; it != m.end() ; ++it)
+			checksum += it->second;
+		ms[1] = bench_ms(start);
+
+		start = bench_clock::now();
+		for (unsigned long i = 0 ; i < keys.size() ; i++)
+			checksum += m.find(keys[i])->first;
+		ms[2] = bench_ms(start);
+
+		start = bench_clock::now();
+		for (unsigned long i = 0 ; i < keys.size() ; i++)
+			m.erase(keys[i]);
+		ms[3] = bench_ms(start);
+
+		for (int phase = 0 ; phase < 4 ; phase++)
+			if (!round || ms[phase] < best[phase])
+				best[phase] = ms[phase];
+	}
+	std::printf("%-10s insert %8.2f  traverse %7.2f  find %8.2f  erase %8.2f  (checksum %lu)\n",
+	name, best[0], best[1], best[2], best[3], checksum);
+}
+
+/**
+ * 	@brief Sorted range construction
+ *
+ * 	@return The best time of BENCH_ROUNDS runs, in ms.
+*/
+template <class Map>
+static double
+bench_sorted_build(const ft::vector<typename Map::value_type>& sorted, unsigned long& checksum)
+{
+	double best = 0;
+
+	for (int round = 0 ; round < BENCH_ROUNDS ; round++)
+	{
+		bench_clock::time_point	start = bench_clock::now();
+		Map						m(sorted.begin(), sorted.end());
+		const double			ms = bench_ms(start);
+
+		if (!round || ms < best)
+			best = ms;
+		checksum = m.size() + m.begin()->second + m.rbegin()->second;
+	}
+	return (best);
+}
+
+/**
+ * 	@brief Hinted appends
+ *
+ * 	@return The best time of BENCH_ROUNDS runs of sorted inserts hinted
+ * 	with end(), in ms.
+*/
+template <class Map>
+static double
+bench_hinted_append(const ft::vector<typename Map::value_type>& sorted, unsigned long& checksum)
+{
+	double best = 0;
+
+	for (int round = 0 ; round < BENCH_ROUNDS ; round++)
+	{
+		Map						m;
+		bench_clock::time_point	start = bench_clock::now();
+
+		for (unsigned long i = 0 ; i < sorted.size() ; i++)
+			m.insert(m.end(), sorted[i]);
+
+		const double			ms = bench_ms(start);
+
+		if (!round || ms < best)
+			best = ms;
+		checksum = m.size() + m.begin()->second + m.rbegin()->second;
+	}
+	return (best);
+}
+
+//@{
+/**
+ * 	@brief Rank and nth of a map: ft::map members, std::map walks
+*/
+static unsigned long
+bench_rank(const ft::map<unsigned long, unsigned long>& m, unsigned long k)
+{ return (m.rank(k)); }
+
+static unsigned long
+bench_rank(const std::map<unsigned long, unsigned long>& m, unsigned long k)
+{ return (std::distance(m.begin(), m.lower_bound(k))); }
+
+static unsigned long
+bench_nth(const ft::map<unsigned long, unsigned long>& m, unsigned long n)
+{ return (m.nth(n)->first); }
+
+static unsigned long
+bench_nth(const std::map<unsigned long, unsigned long>& m, unsigned long n)
+{ return (std::next(m.begin(), n)->first); }
+//@}
+
+/**
+ * 	@brief Order statistics
+ *
+ * 	@return The time of BENCH_QUERIES rank and nth queries, in ms.
+*/
+template <class Map>
+static double
+bench_order_statistics(const ft::vector<typename Map::value_type>& sorted, const ft::vector<unsigned long>& keys,
+unsigned long& checksum)
+{
+	Map						m(sorted.begin(), sorted.end());
+	bench_clock::time_point	start = bench_clock::now();
+
+	checksum = 0;
+	for (unsigned long i = 0 ; i < BENCH_QUERIES ; i++)
+		checksum += bench_rank(m, keys[i]) + bench_nth(m, keys[i] % m.size());
+	return (bench_ms(start));
+}
+
+int main()
+{
+	ft::vector<unsigned long>	keys;
+	std::mt19937_64				gen(42);
+
+	for (unsigned long i = 0 ; i < BENCH_ITEMS ; i++)
+		keys.push_back(gen());
+	std::printf("== %lu random keys (ms) ==\n", BENCH_ITEMS);
+	bench_map<ft::map<unsigned long, unsigned long> >("ft::map", keys);
+	bench_map<std::map<unsigned long, unsigned long> >("std::map", keys);
+
+	typedef std::pair<const unsigned long, unsigned long>	bench_pair;
+	ft::vector<unsigned long>								sorted_keys(keys);
+	ft::vector<bench_pair>									sorted;
+	unsigned long											checksum[6];
+
+	std::sort(sorted_keys.begin(), sorted_keys.end());
+	for (unsigned long i = 0 ; i < sorted_keys.size() ; i++)
+		sorted.push_back(bench_pair(sorted_keys[i], i));
+	const double ft_ms = bench_sorted_build<ft::map<unsigned long, unsigned long> >(sorted, checksum[0]);
+	const double std_ms = bench_sorted_build<std::map<unsigned long, unsigned long> >(sorted, checksum[1]);
+	std::printf("== Construction from %lu sorted pairs (ms) ==\n", BENCH_ITEMS);
+	std::printf("ft::map  %8.2f\nstd::map %8.2f  (checksum %s)\n", ft_ms, std_ms,
+	checksum[0] == checksum[1] ? "ok" : "KO");
+
+	const double ft_hint_ms = bench_hinted_append<ft::map<unsigned long, unsigned long> >(sorted, checksum[2]);
+	const double std_hint_ms = bench_hinted_append<std::map<unsigned long, unsigned long> >(sorted, checksum[3]);
+	std::printf("== Appends of %lu sorted pairs hinted with end() (ms) ==\n", BENCH_ITEMS);
+	std::printf("ft::map  %8.2f\nstd::map %8.2f  (checksum %s)\n", ft_hint_ms, std_hint_ms,
+	checksum[2] == checksum[3] && checksum[2] == checksum[0] ? "ok" : "KO");
+
+	const double ft_os_ms = bench_order_statistics<ft::map<unsigned long, unsigned long> >(sorted, keys, checksum[4]);
+	const double std_os_ms = bench_order_statistics<std::map<unsigned long, unsigned long> >(sorted, keys, checksum[5]);
+	std::printf("== %lu rank + nth queries (ms) ==\n", BENCH_QUERIES);
+	std::printf("ft::map  %8.2f\nstd::map %8.2f  (checksum %s)\n", ft_os_ms, std_os_ms,
+	checksum[4] == checksum[5] ? "ok" : "KO");
+	return (0);
+}
@@ -0,0 +1,112 @@
+/** @file mpmc_queue_bench.cpp
+ *
+ * 	Throughput of ft::mpmc_queue against a std::mutex wrapped
+ * 	ft::queue<T, ft::deque<T> >, with N producers and N consumers.
+ *
+ * 	./benchmark.sh mpmc_queue_bench
+*/
+
+# include <chrono>
+# include <cstdio>
+# include <mutex>
+# include <condition_variable>
+# include <thread>
+# include <vector>
+
+# include <deque.hpp>
+# include <queue.hpp>
+# include <mpmc_queue.hpp>
+
+# define BENCH_ITEMS 4000000UL
+# define BENCH_CAPACITY 0x400
+
+typedef std::chrono::steady_clock	bench_clock;
+
+/// The ft::queue used by the worker pool before ft::mpmc_queue.
+template <class T>
+struct locked_queue
+{
+	std::mutex					lock;
+	std::condition_variable		not_empty;
+	std::condition_variable		not_full;
+	ft::queue<T, ft::deque<T> >	q;
+
+	void	push(const T& value)
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		while (q.size() >= BENCH_CAPACITY)
+			not_full.wait(guard);
+		q.push(value);
+		not_empty.notify_one();
+	}
+
+	void	pop(T& value)
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		while (q.empty())
+			not_empty.wait(guard);
+		value = q.front();
+		q.pop();
+		not_full.notify_one();
+	}
+};
+
+/**
+ * 	@brief Throughput
+ *
+ * 	@p threads producers push BENCH_ITEMS integers in total, @p threads
+ * 	consumers pop and sum them.
+*/
+template <class Queue>
+static void
+bench_throughput(const char* name, unsigned long threads)
+{
+	Queue						q(BENCH_CAPACITY);
+	std::atomic<unsigned long>	sum(0);
+	std::vector<std::thread>	workers;
+	const unsigned long			per_thread = BENCH_ITEMS / threads;
+	bench_clock::time_point		start = bench_clock::now();
+
+	for (unsigned long t = 0 ; t < threads ; t++)
+	{
+		workers.push_back(std::thread([&, t]() {
+			for (unsigned long i = 0 ; i < per_thread ; i++)
+				q.push(t * per_thread + i);
+		}));
+		workers.push_back(std::thread([&]() {
+			unsigned long value;
+			unsigned long local = 0;
+			for (unsigned long i = 0 ; i < per_thread ; i++)
+			{
+				q.pop(value);
+				local += value;
+			}
+			sum += local;
+		}));
+	}
+	for (unsigned long t = 0 ; t < workers.size() ; t++)
+		workers[t].join();
+
+	const double			ns = std::chrono::duration<double, std::nano>(bench_clock::now() - start).count();
+	const unsigned long		n = per_thread * threads;
+
+	std::printf("%-28s %2lu+%-2lu threads %8.1f Mops/s  (checksum %s)\n", name, threads, threads,
+	n / ns * 1e3, sum == n * (n - 1) / 2 ? "ok" : "KO");
+}
+
+/// Constructible from a capacity, as ft::mpmc_queue.
+struct bench_locked_queue : public locked_queue<unsigned long>
+{ explicit bench_locked_queue(std::size_t) { } };
+
+int main()
+{
+	const unsigned long max_threads = std::thread::hardware_concurrency() > 2
+		? std::thread::hardware_concurrency() / 2 : 1;
+
+	for (unsigned long threads = 1 ; threads <= max_threads ; threads *= 2)
+	{
+		bench_throughput<ft::mpmc_queue<unsigned long> >("mpmc_queue", threads);
+		bench_throughput<bench_locked_queue>("mutex + queue<T, deque<T> >", threads);
+	}
+	return (0);
+}
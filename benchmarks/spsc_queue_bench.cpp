@@ -0,0 +1,184 @@
+/** @file spsc_queue_bench.cpp
+ *
+ * 	Throughput and latency of ft::spsc_queue against a std::mutex
+ * 	wrapped ft::queue<T, ft::deque<T> >, one producer and one consumer.
+ *
+ * 	./benchmark.sh spsc_queue_bench
+*/
+
+# include <chrono>
+# include <cstdio>
+# include <mutex>
+# include <thread>
+# include <vector>
+
+# include <deque.hpp>
+# include <queue.hpp>
+# include <spsc_queue.hpp>
+
+# define BENCH_ITEMS 10000000UL
+# define BENCH_ROUND_TRIPS 200000UL
+# define BENCH_CAPACITY 0x400
+# define BENCH_BATCH 0x40
+
+typedef std::chrono::steady_clock	bench_clock;
+
+/// The ft::queue used by the pipeline before ft::spsc_queue.
+template <class T>
+struct locked_queue
+{
+	std::mutex								lock;
+	ft::queue<T, ft::deque<T> >				q;
+
+	void	push(const T& value)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		q.push(value);
+	}
+
+	bool	try_pop(T& value)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if (q.empty())
+			return (false);
+		value = q.front();
+		q.pop();
+		return (true);
+	}
+};
+
+static double
+elapsed_ns(bench_clock::time_point start)
+{ return (std::chrono::duration<double, std::nano>(bench_clock::now() - start).count()); }
+
+/**
+ * 	@brief Throughput
+ *
+ * 	The producer pushes BENCH_ITEMS integers, the consumer pops and sums them.
+*/
+template <class Queue, class Push, class Pop>
+static void
+bench_throughput(const char* name, Queue& q, Push push, Pop pop)
+{
+	unsigned long			sum = 0;
+	bench_clock::time_point	start = bench_clock::now();
+
+	std::thread consumer([&]() {
+		unsigned long value;
+		for (unsigned long i = 0 ; i < BENCH_ITEMS ; )
+		{
+			if (pop(q, value))
+			{
+				sum += value;
+				i++;
+			}
+			else
+				std::this_thread::yield();
+		}
+	});
+	for (unsigned long i = 0 ; i < BENCH_ITEMS ; i++)
+		push(q, i);
+	consumer.join();
+
+	const double ns = elapsed_ns(start);
+
+	std::printf("%-28s %8.1f Mops/s  (checksum %s)\n", name, BENCH_ITEMS / ns * 1e3,
+	sum == BENCH_ITEMS * (BENCH_ITEMS - 1) / 2 ? "ok" : "KO");
+}
+
+/**
+ * 	@brief Batched throughput
+ *
+ * 	Same as bench_throughput with try_push_n/try_pop_n of BENCH_BATCH items.
+*/
+static void
+bench_batch_throughput(ft::spsc_queue<unsigned long>& q)
+{
+	unsigned long			sum = 0;
+	bench_clock::time_point	start = bench_clock::now();
+
+	std::thread consumer([&]() {
+		unsigned long buff[BENCH_BATCH];
+		for (unsigned long i = 0 ; i < BENCH_ITEMS ; )
+		{
+			const unsigned long n = q.try_pop_n(buff, BENCH_BATCH);
+			if (!n)
+				std::this_thread::yield();
+			for (unsigned long j = 0 ; j < n ; j++)
+				sum += buff[j];
+			i += n;
+		}
+	});
+	unsigned long buff[BENCH_BATCH];
+	for (unsigned long i = 0 ; i < BENCH_ITEMS ; )
+	{
+		unsigned long n = BENCH_ITEMS - i < BENCH_BATCH ? BENCH_ITEMS - i : BENCH_BATCH;
+		for (unsigned long j = 0 ; j < n ; j++)
+			buff[j] = i + j;
+		n = q.try_push_n(buff, n);
+		if (!n)
+			std::this_thread::yield();
+		i += n;
+	}
+	consumer.join();
+
+	const double ns = elapsed_ns(start);
+
+	std::printf("%-28s %8.1f Mops/s  (checksum %s)\n", "spsc_queue (batch 64)", BENCH_ITEMS / ns * 1e3,
+	sum == BENCH_ITEMS * (BENCH_ITEMS - 1) / 2 ? "ok" : "KO");
+}
+
+/**
+ * 	@brief Latency
+ *
+ * 	Ping-pong between two queues: the mean round trip is two hand-offs.
+*/
+template <class Queue, class Push, class Pop>
+static void
+bench_latency(const char* name, Queue& ping, Queue& pong, Push push, Pop pop)
+{
+	std::thread echo([&]() {
+		unsigned long value;
+		for (unsigned long i = 0 ; i < BENCH_ROUND_TRIPS ; i++)
+		{
+			while (!pop(ping, value))
+				std::this_thread::yield();
+			push(pong, value);
+		}
+	});
+	bench_clock::time_point	start = bench_clock::now();
+	unsigned long			value;
+
+	for (unsigned long i = 0 ; i < BENCH_ROUND_TRIPS ; i++)
+	{
+		push(ping, i);
+		while (!pop(pong, value))
+			std::this_thread::yield();
+	}
+
+	const double ns = elapsed_ns(start);
+
+	echo.join();
+	std::printf("%-28s %8.1f ns round trip\n", name, ns / BENCH_ROUND_TRIPS);
+}
+
+int main()
+{
+	typedef ft::spsc_queue<unsigned long>	spsc;
+	typedef locked_queue<unsigned long>		locked;
+
+	auto spsc_push = [](spsc& q, unsigned long v) { q.push(v); };
+	auto spsc_pop = [](spsc& q, unsigned long& v) { return (q.try_pop(v)); };
+	auto locked_push = [](locked& q, unsigned long v) { q.push(v); };
+	auto locked_pop = [](locked& q, unsigned long& v) { return (q.try_pop(v)); };
+
+	std::printf("== Throughput (%lu items) ==\n", BENCH_ITEMS);
+	{ spsc q(BENCH_CAPACITY); bench_throughput("spsc_queue", q, spsc_push, spsc_pop); }
+	{ spsc q(BENCH_CAPACITY); bench_batch_throughput(q); }
+	{ locked q; bench_throughput("mutex + queue<T, deque<T> >", q, locked_push, locked_pop); }
+
+	std::printf("== Latency (%lu round trips) ==\n", BENCH_ROUND_TRIPS);
+	{ spsc a(BENCH_CAPACITY), b(BENCH_CAPACITY); bench_latency("spsc_queue", a, b, spsc_push, spsc_pop); }
+	{ locked a, b; bench_latency("mutex + queue<T, deque<T> >", a, b, locked_push, locked_pop); }
+	return (0);
+}
@@ -0,0 +1,169 @@
+/** @file ws_deque_bench.cpp
+ *
+ * 	Fork-join sum of an ft::vector over a work-stealing pool of
+ * 	ft::ws_deque, from 1 worker to std::thread::hardware_concurrency().
+ *
+ * 	./benchmark.sh ws_deque_bench
+*/
+
+# include <atomic>
+# include <chrono>
+# include <cstdint>
+# include <cstdio>
+# include <iostream>
+# include <memory>
+# include <new>
+# include <stdexcept>
+# include <thread>
+# include <vector>
+
+# include <vector.hpp>
+# include <ws_deque.hpp>
+
+# define BENCH_ITEMS 0x4000000UL
+# define BENCH_GRAIN 0x2000UL
+# define BENCH_ROUNDS 5
+
+typedef std::chrono::steady_clock	bench_clock;
+
+/// A task: sum the elements [first, last), packed in a word (lock-free slots).
+struct range_task
+{
+	std::uint32_t	first;
+	std::uint32_t	last;
+};
+
+typedef ft::ws_deque<range_task>	bench_deque;
+
+/**
+ * 	@brief Work-stealing pool
+ *
+ * 	Each worker pops its own deque, splits a too large range in two halves
+ * 	(forks the upper one) and sums it when it's small enough. An idle worker
+ * 	steals from the others, round-robin.
+ *
+ * 	The deques are placed in one block aligned by hand: before C++17 new
+ * 	ignores their cache line alignment.
+*/
+struct bench_pool
+{
+	const ft::vector<unsigned long>&			data;
+	unsigned char*								block;
+	std::vector<bench_deque*>					deques;
+	std::atomic<unsigned long>					summed;
+	std::atomic<unsigned long>					sum;
+
+	bench_pool(const ft::vector<unsigned long>& data, unsigned long workers)
+	: data(data), block(new unsigned char[(workers + 1) * sizeof(bench_deque)]), deques(), summed(0), sum(0)
+	{
+		void*		first = block;
+		std::size_t	space = (workers + 1) * sizeof(bench_deque);
+
+		std::align(alignof(bench_deque), workers * sizeof(bench_deque), first, space);
+		for (unsigned long i = 0 ; i < workers ; i++)
+			deques.push_back(new (static_cast<bench_deque*>(first) + i) bench_deque());
+	}
+
+	~bench_pool()
+	{
+		for (unsigned long i = 0 ; i < deques.size() ; i++)
+			deques[i]->~bench_deque();
+		delete[] block;
+	}
+
+	void	run(unsigned long id)
+	{
+		bench_deque&				own = *deques[id];
+		unsigned long				local = 0;
+		unsigned long				count = 0;
+		range_task					task;
+
+		while (summed.load(std::memory_order_relaxed) != data.size())
+		{
+			if (!own.pop(task) && !steal(id, task))
+			{
+				if (count)
+				{
+					sum += local;
+					summed += count;
+					local = count = 0;
+				}
+				std::this_thread::yield();
+				continue ;
+			}
+			while (task.last - task.first > BENCH_GRAIN)
+			{
+				const unsigned long middle = task.first + (task.last - task.first) / 2;
+
+				own.push(range_task{static_cast<std::uint32_t>(middle), task.last});
+				task.last = static_cast<std::uint32_t>(middle);
+			}
+			for (unsigned long i = task.first ; i < task.last ; i++)
+				local += data[i];
+			count += task.last - task.first;
+		}
+	}
+
+	bool	steal(unsigned long id, range_task& task)
+	{
+		for (unsigned long i = 1 ; i < deques.size() ; i++)
+			if (deques[(id + i) % deques.size()]->steal(task))
+				return (true);
+		return (false);
+	}
+};
+
+/**
+ * 	@brief Fork-join sum
+ *
+ * 	@return The best time of BENCH_ROUNDS runs, in ms.
+*/
+static double
+bench_sum(const ft::vector<unsigned long>& data, unsigned long workers, bool& ok)
+{
+	double best = 0;
+
+	for (int round = 0 ; round < BENCH_ROUNDS ; round++)
+	{
+		bench_pool					pool(data, workers);
+		std::vector<std::thread>	threads;
+		bench_clock::time_point		start = bench_clock::now();
+
+		pool.deques[0]->push(range_task{0, static_cast<std::uint32_t>(data.size())});
+		for (unsigned long i = 1 ; i < workers ; i++)
+			threads.push_back(std::thread(&bench_pool::run, &pool, i));
+		pool.run(0);
+		for (unsigned long i = 0 ; i < threads.size() ; i++)
+			threads[i].join();
+
+		const double ms = std::chrono::duration<double, std::milli>(bench_clock::now() - start).count();
+
+		if (!round || ms < best)
+			best = ms;
+		ok = ok && pool.sum == data.size() * (data.size() - 1) / 2;
+	}
+	return (best);
+}
+
+int main()
+{
+	ft::vector<unsigned long>	data;
+	const unsigned long			max_workers = std::thread::hardware_concurrency()
+		? std::thread::hardware_concurrency() : 1;
+	double						serial = 0;
+
+	for (unsigned long i = 0 ; i < BENCH_ITEMS ; i++)
+		data.push_back(i);
+	std::printf("== Fork-join sum (%lu items, grain %lu) ==\n", BENCH_ITEMS, BENCH_GRAIN);
+	for (unsigned long workers = 1 ; workers <= max_workers ; workers *= 2)
+	{
+		bool			ok = true;
+		const double	ms = bench_sum(data, workers, ok);
+
+		if (workers == 1)
+			serial = ms;
+		std::printf("ws_deque pool %3lu workers %8.2f ms  x%.2f  (checksum %s)\n", workers, ms,
+		serial / ms, ok ? "ok" : "KO");
+	}
+	return (0);
+}
@@ -1,8 +1,8 @@
 
 /** @file algorithm.hpp
  * 
- * 	This file contains the implementation of lexicographical compare
- * 	and equal
+ * 	This file contains the implementation of lexicographical compare,
+ * 	equal, copy, fill, find and for_each
 */
 
 # pragma once
@@ -114,11 +114,49 @@ namespace FT_NAMESPACE
     	return (true);
 	}
 
-	template<class T> 
+	template<class T>
 	inline const T&
 	min(const T& a, const T& b)
 	{ return (b < a ? b : a); }
 
+	/* NOTE: %deque overloads them to work node by node (see: deque.hpp) */
+
+	template <class InputIt, class OutputIt>
+	inline OutputIt
+	copy(InputIt first, InputIt last, OutputIt d_first)
+	{
+		for (; first != last ; ++first, ++d_first)
+			*d_first = *first;
+		return (d_first);
+	}
+
+	template <class ForwardIt, class T>
+	inline void
+	fill(ForwardIt first, ForwardIt last, const T& value)
+	{
+		for (; first != last ; ++first)
+			*first = value;
+	}
+
+	template <class InputIt, class T>
+	inline InputIt
+	find(InputIt first, InputIt last, const T& value)
+	{
+		for (; first != last ; ++first)
+			if (*first == value)
+				return (first);
+		return (last);
+	}
+
+	template <class InputIt, class UnaryFunction>
+	inline UnaryFunction
+	for_each(InputIt first, InputIt last, UnaryFunction f)
+	{
+		for (; first != last ; ++first)
+			f(*first);
+		return (f);
+	}
+
 	template <typename Arg, typename Result>
 	struct unary_function
 	{
@@ -1,6 +1,5 @@
-
 /**	@file deque.hpp
- * 
+ *
  *	This file contains the deque container implementation.
 */
 
@@ -8,40 +7,61 @@
 
 # include <ft_iterator.hpp>
 # include <ft_allocator.hpp>
+# include <ft_growth_policy.hpp>
+# include <algorithm.hpp>
+
+# include <limits>
+# include <cstring>
+# include <string>
+# include <stdexcept>
 
 # define FT_MAX(x, y) x > y ? x : y
 
 /**
  * 	@brief Deque node size MACROS
- * 
- * 	@param x Use to be size_of(T).
- * 
- * 	Used to define the max size of a node (node: see later).
- * 	The size is @b 512 and is overwritable if needed, but the idea
- * 	is to keep constant node sizes to optimize the allocation
- * 	functions using always small sizes.
+ *
+ * 	- FT_DEQUE_BUFF_SIZE: The default size in bytes of a node (node: see later).
+ * 	- FT_DEQUE_PAGE_BUFF_SIZE: The node size in bytes used by %page_deque.
+ * 	- FT_DEQUE_MIN_NODE_SIZE: The minimum amount of elements in a node, big types
+ * 	get bigger nodes instead of a node per element.
+ *
+ * 	All are overwritable if needed, the idea is to keep constant node
+ * 	sizes to optimize the allocation functions using always the same sizes.
+ * 	The node size of a %deque is given by its BuffSize template parameter.
+ *
+ * 	- FT_DEQUE_GET_BUFF_SIZE(x, bytes): The amount of elements of size @a x
+ * 	in a node of @a bytes.
 */
 #ifndef FT_DEQUE_BUFF_SIZE
 # define FT_DEQUE_BUFF_SIZE 0x200
 #endif
 
-# define FT_DEQUE_GET_BUFF_SIZE(x) x < FT_DEQUE_BUFF_SIZE ? std::size_t(FT_DEQUE_BUFF_SIZE / size) : std::size_t(0x1)
+#ifndef FT_DEQUE_PAGE_BUFF_SIZE
+# define FT_DEQUE_PAGE_BUFF_SIZE 0x1000
+#endif
+
+#ifndef FT_DEQUE_MIN_NODE_SIZE
+# define FT_DEQUE_MIN_NODE_SIZE 0x8
+#endif
+
+# define FT_DEQUE_GET_BUFF_SIZE(x, bytes) ((x) * FT_DEQUE_MIN_NODE_SIZE < (bytes) \
+	? std::size_t((bytes) / (x)) : std::size_t(FT_DEQUE_MIN_NODE_SIZE))
 
 namespace FT_NAMESPACE
 {
 	/**
 	 * 	@brief Deque iterator
-	 * 
+	 *
 	 * 	@tparam T The type holded by the deque container.
 	 * 	@tparam Ref_T A mtable or const reference to T
 	 * 	@tparam Ptr_T A mutable or const pointer to T
-	 * 
+	 *
 	 * 	Implementation of deque iterator class, this class as also used
 	 * 	to deque management. In fact is part of the core algorithm of deque.
 	 * 	Deque class holds 2 @c deque_iterator that defines the front and the back
 	 * 	of the deque.
 	*/
-	template <class T, typename Ref_T, typename Ptr_T>
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize = FT_DEQUE_BUFF_SIZE>
 	struct deque_iterator
 	{
 		// 	Note: Node and Map concept haven't nothing in common to map container or linked-list nodes.
@@ -50,20 +70,21 @@ namespace FT_NAMESPACE
 
 		public:
 
-		typedef T				value_type;
-		typedef	Ptr_T			pointer;
-		typedef Ref_T			reference;
-		typedef std::size_t		size_type;
-		typedef std::ptrdiff_t	difference_type;
-		typedef deque_iterator	Self;
+		typedef random_access_iterator_tag	iterator_category;
+		typedef T							value_type;
+		typedef	Ptr_T						pointer;
+		typedef Ref_T						reference;
+		typedef std::size_t					size_type;
+		typedef std::ptrdiff_t				difference_type;
+		typedef deque_iterator				Self;
 
 		/* Note: Typedefs {const_reference} and {const_pointer} aren't the
 			same as typedefs const {reference} and const {pointer} when
 			the deque_iterator is a {const_iterator} */
-		typedef const value_type&									const_reference;
-		typedef const value_type*									const_pointer;
-		typedef Self<value_type, value_type&, value_type*>			iterator;
-		typedef Self<value_type, const_reference, const_pointer>	const_iterator;
+		typedef const value_type&										const_reference;
+		typedef const value_type*										const_pointer;
+		typedef deque_iterator<value_type, value_type&, value_type*, BuffSize>	iterator;
+		typedef deque_iterator<value_type, const_reference, const_pointer, BuffSize>	const_iterator;
 
 		/* Core types (see: explenation in deque class) */
 		typedef	value_type*		Node_ptr;
@@ -71,17 +92,17 @@ namespace FT_NAMESPACE
 
 		/* Auxiliar functions */
 
-		private:
-
-		inline size_type		get_node_size() throw();
+		static size_type		get_node_size() throw();
 		void					it_change_node(Map_ptr new_node) throw();
 
 		/* Core:
 		* (see: futher explenation in deque class)
 		* - curr -> points to the current element in the node.
 		* - head -> points to the first element in the node.
-		* - tail -> points to the last element in the node.
+		* - tail -> points past the last element in the node.
 		* - node -> points to the current node.
+		*
+		* NOTE: Public, the deque algorithm works on them.
 		*/
 		Node_ptr		curr;
 		Node_ptr		head;
@@ -90,15 +111,13 @@ namespace FT_NAMESPACE
 
 		/* Member functions */
 
-		public:
-
 		deque_iterator();
 		deque_iterator(Node_ptr pos, Map_ptr map);
-		deque_iterator(const_iterator& other);
+		deque_iterator(const iterator& other);
 
 		/* Requires read/write iterators */
 		reference				operator*() const;
-		pointer					operator->();
+		pointer					operator->() const;
 
 		/* Requires forward iterators */
 		Self&					operator++();
@@ -114,18 +133,24 @@ namespace FT_NAMESPACE
 		reference				operator[](difference_type n) const;
 
 		/* Non members */
-		friend bool				operator==(const Self&, const Self&);
-		friend bool				operator<(const Self&, const Self&);
-		template <typename _T, typename _T_Ref, typename _T_Ptr>
-		friend bool				operator==(const Self&, const deque_iterator<_T, _T_Ref, _T_Ptr>&);
-		template <typename _T, typename _T_Ref, typename _T_Ptr>
-		friend bool				operator<(const Self&, const deque_iterator<_T, _T_Ref, _T_Ptr>&);
-		// TO DO: Decide if i want / need those at friend
-		template <typename _T, typename _T_Ref, typename _T_Ptr>
-		friend difference_type	operator-(const Self&, deque_iterator<_T, _T_Ref, _T_Ptr>&);
-		friend Self				operator-(const Self&, difference_type);
-		friend Self				operator+(const Self&, difference_type);
-		friend Self				operator+(difference_type, const Self&);
+
+		/* Note: an iterator is converted to a const_iterator when both are compared */
+		friend bool				operator==(const Self& lhs, const Self& rhs) { return (lhs.curr == rhs.curr); }
+		friend bool				operator!=(const Self& lhs, const Self& rhs) { return (lhs.curr != rhs.curr); }
+		friend bool				operator<(const Self& lhs, const Self& rhs)
+		{ return (lhs.node == rhs.node ? lhs.curr < rhs.curr : lhs.node < rhs.node); }
+		friend bool				operator>(const Self& lhs, const Self& rhs) { return (rhs < lhs); }
+		friend bool				operator<=(const Self& lhs, const Self& rhs) { return (!(rhs < lhs)); }
+		friend bool				operator>=(const Self& lhs, const Self& rhs) { return (!(lhs < rhs)); }
+		friend difference_type	operator-(const Self& lhs, const Self& rhs)
+		{
+			/* A null node is a default (empty) iterator */
+			return (difference_type(get_node_size()) * (lhs.node - rhs.node - difference_type(lhs.node != 0))
+			+ (lhs.curr - lhs.head) + (rhs.tail - rhs.curr));
+		}
+		friend Self				operator-(const Self& x, difference_type n) { Self tmp = x; return (tmp -= n); }
+		friend Self				operator+(const Self& x, difference_type n) { Self tmp = x; return (tmp += n); }
+		friend Self				operator+(difference_type n, const Self& x) { return (x + n); }
 	};
 
 	////////////////////////
@@ -134,14 +159,14 @@ namespace FT_NAMESPACE
 
 	/**
 	 * 	@brief get_node_size
-	 * 
+	 *
 	 * 	Fast-use of the MACROS.
 	*/
-	template <class T, typename Ref_T, typename Ptr_T>
-	typename deque_iterator<T, Ref_T, Ptr_T>::size_type
-	inline deque_iterator<T, Ref_T, Ptr_T>::get_node_size()
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::size_type
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::get_node_size()
 	throw()
-	{ return (FT_DEQUE_BUFF_SIZE(sizeof(value_type)); }
+	{ return (FT_DEQUE_GET_BUFF_SIZE(sizeof(value_type), BuffSize)); }
 
 	/**
 	 * 	@brief Change node
@@ -151,9 +176,9 @@ namespace FT_NAMESPACE
 	 * 	Migrates all the control data core to @a new_node
 	 * 	execpt @c curr.
 	*/
-	template <class T, typename Ref_T, typename Ptr_T>
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
 	inline void
-	deque_iterator<T, Ref_T, Ptr_T>::it_change_node(Map_ptr new_node)
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::it_change_node(Map_ptr new_node)
 	throw()
 	{
 		node = new_node;
@@ -168,27 +193,27 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief Default Constructor
 	*/
-	template <class T, typename Ref_T, typename Ptr_T>
-	deque_iterator<T, Ref_T, Ptr_T>::deque_iterator()
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::deque_iterator()
 	: curr(), head(), tail(), node()
 	{ }
 
 	/**
 	 * 	@brief Constructor
-	 * 
+	 *
 	 * 	@param pos The index in the deque.
 	 * 	@param map The index node in the map.
 	*/
-	template <class T, typename Ref_T, typename Ptr_T>
-	deque_iterator<T, Ref_T, Ptr_T>::deque_iterator(Node_ptr pos, Map_ptr map)
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::deque_iterator(Node_ptr pos, Map_ptr map)
 	: curr(pos), head(*map), tail(Node_ptr(*map + difference_type(get_node_size()))), node(map)
 	{ }
 
 	/**
 	 * 	@brief Conversion iterator to const_iterator Constructor.
 	*/
-	template <class T, typename Ref_T, typename Ptr_T>
-	deque_iterator<T, Ref_T, Ptr_T>::deque_iterator(const_iterator& other)
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::deque_iterator(const iterator& other)
 	: curr(other.curr), head(other.head), tail(other.tail), node(other.node)
 	{ }
 
@@ -200,23 +225,23 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief deque_iterator overload operators
 	*/
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::reference
-	deque_iterator<T, Ref_T, Ptr_T>::operator*() const
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::reference
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator*() const
 	{ return (*curr); }
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::pointer
-	deque_iterator<T, Ref_T, Ptr_T>::operator->()
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::pointer
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator->() const
 	{ return (curr); }
 
 	////////////////////////////////
 	// Requires forward iterators //
 	////////////////////////////////
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::Self&
-	deque_iterator<T, Ref_T, Ptr_T>::operator++()
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::Self&
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator++()
 	{
 		if (++curr == tail)
 		{
@@ -226,9 +251,9 @@ namespace FT_NAMESPACE
 		return (*this);
 	}
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::Self
-	deque_iterator<T, Ref_T, Ptr_T>::operator++(int)
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::Self
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator++(int)
 	{
 		Self tmp = *this;
 		++(*this);
@@ -239,21 +264,22 @@ namespace FT_NAMESPACE
 	// Requires bidirectional iterators //
 	//////////////////////////////////////
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::Self&
-	deque_iterator<T, Ref_T, Ptr_T>::operator--()
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::Self&
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator--()
 	{
-		if (--curr == tail)
+		if (curr == head)
 		{
 			it_change_node(node - 1);
-			curr = head;
+			curr = tail;
 		}
+		--curr;
 		return (*this);
 	}
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::Self
-	deque_iterator<T, Ref_T, Ptr_T>::operator--(int)
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::Self
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator--(int)
 	{
 		Self tmp = *this;
 		--(*this);
@@ -264,189 +290,186 @@ namespace FT_NAMESPACE
 	// Requires random access iterators //
 	//////////////////////////////////////
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	typename deque_iterator<T, Ref_T, Ptr_T>::Self&
-	deque_iterator<T, Ref_T, Ptr_T>::operator+=(difference_type n)
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::Self&
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator+=(difference_type n)
 	{
 		const difference_type amount = n + (curr - head);
+		const difference_type node_size = difference_type(get_node_size());
 
 		/* Smaller than the remening space in the curr node */
-		if (amount >= 0 && amount < difference_type(get_node_size()))
-			curr += amount;
-		/* Or need to change fill more node(s) */
-		else 
+		if (amount >= 0 && amount < node_size)
+			curr += n;
+		/* Or need to change of node */
+		else
 		{
-			// Handle addition or substraction
+			/* Handle addition or substraction */
 			const difference_type map_index = amount > 0
-				? amount / difference_type(get_node_size())
-				: -difference_type(amount - 1);
+				? amount / node_size
+				: -((-amount - 1) / node_size) - 1;
 			it_change_node(node + map_index);
 			/* Update the current index */
-			curr = head + (amount - map_index * difference_type(get_node_size()));
+			curr = head + (amount - map_index * node_size);
 		}
+		return (*this);
 	}
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::Self&
-	deque_iterator<T, Ref_T, Ptr_T>::operator-=(difference_type n)
-	{ return (*this -= -n ); }
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::Self&
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator-=(difference_type n)
+	{ return (*this += -n); }
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	typename deque_iterator<T, Ref_T, Ptr_T>::reference
-	deque_iterator<T, Ref_T, Ptr_T>::operator[](difference_type n) const
-	{ return (*(this + n)); }
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize>
+	inline typename deque_iterator<T, Ref_T, Ptr_T, BuffSize>::reference
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>::operator[](difference_type n) const
+	{ return (*(*this + n)); }
 	//@}
 
-	/////////////////
-	// Non members //
-	/////////////////
+	//////////////////////////
+	// Segmented algorithms //
+	//////////////////////////
 
-	//@{
 	/**
-	 * 	@brief Boolean operators
-	 * 
-	 * 	@param lhs A %deque_iterator.
-	 * 	@param rhs A %deque_iterator with the same type of @p lhs.
-	 * 	@return The result of the requested operation.
+	 * 	@brief Segmented algorithms
+	 *
+	 * 	Overloads of algorithm.hpp for %deque iterators. The range is cut in
+	 * 	nodes, each node is a contiguous array processed as a pointer range:
+	 * 	no node boundary check per element, the loops can be vectorized.
+	 * 	Picked by overload resolution, ft::copy(d.begin(), d.end(), out) works
+	 * 	the same as for any iterator.
 	*/
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline bool
-	operator==(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const typename deque_iterator<T, Ref_T, Ptr_T>::Self& rhs)
-	{ return (lhs.curr == rhs.curr); }
-
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline bool
-	operator<(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const typename deque_iterator<T, Ref_T, Ptr_T>::Self& rhs)
-	{ return (lhs.curr < rhs.curr); }
-
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline bool
-	operator!=(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const typename deque_iterator<T, Ref_T, Ptr_T>::Self& rhs)
-	{ return (!(lhs == rhs)); }
-
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline bool
-	operator>(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const typename deque_iterator<T, Ref_T, Ptr_T>::Self& rhs)
-	{ return (rhs < lhs); }
-
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline bool
-	operator<=(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const typename deque_iterator<T, Ref_T, Ptr_T>::Self& rhs)
-	{ return (!(lhs > rhs)); }
-
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline bool
-	operator>=(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const typename deque_iterator<T, Ref_T, Ptr_T>::Self& rhs)
-	{ return (!(lhs < rhs)); }
-	//@}
-
 	//@{
-	/**
-	 * 	@brief Boolean operators
-	 * 
-	 * 	@tparam _T_Ref a reference to T that could be const or mutable.
-	 * 	@tparam _T_Ptr a pointer to T that could be const or mutable.
-	 * 	@param lhs A %deque_iterator.
-	 * 	@param rhs A %deque_iterator.
-	 * 	@return The result of the requested operation.
-	 * 
-	 * 	Note: One of both is a const_iterator.
-	*/
-	template <class T, typename Ref_T, typename Ptr_T>
-	template <typename _T, typename _T_Ref, typename _T_Ptr>
-	inline bool
-	operator==(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const deque_iterator<_T, _T_Ref, _T_Ptr>& rhs)
-	{ return (lhs.curr == rhs.curr); }
-
-	template <class T, typename Ref_T, typename Ptr_T>
-	template <typename _T, typename _T_Ref, typename _T_Ptr>
-	inline bool
-	operator<(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const deque_iterator<_T, _T_Ref, _T_Ptr>& rhs)
-	{ return (lhs.curr < rhs.curr); }
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize, class OutputIt>
+	OutputIt
+	copy(deque_iterator<T, Ref_T, Ptr_T, BuffSize> first,
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize> last, OutputIt d_first)
+	{
+		if (first.node == last.node)
+			return (FT_NAMESPACE::copy(first.curr, last.curr, d_first));
+		d_first = FT_NAMESPACE::copy(first.curr, first.tail, d_first);
+		for (T** node = first.node + 1 ; node < last.node ; node++)
+			d_first = FT_NAMESPACE::copy(*node, *node + first.get_node_size(), d_first);
+		return (FT_NAMESPACE::copy(last.head, last.curr, d_first));
+	}
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	template <typename _T, typename _T_Ref, typename _T_Ptr>
-	inline bool
-	operator!=(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const deque_iterator<_T, _T_Ref, _T_Ptr>& rhs)
-	{ return (!(lhs == rhs)); }
+	template <class V, class T, std::size_t BuffSize>
+	deque_iterator<T, T&, T*, BuffSize>
+	copy(V* first, V* last, deque_iterator<T, T&, T*, BuffSize> d_first)
+	{
+		while (first != last)
+		{
+			const std::ptrdiff_t n = FT_NAMESPACE::min(last - first, d_first.tail - d_first.curr);
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	template <typename _T, typename _T_Ref, typename _T_Ptr>
-	inline bool
-	operator>(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const deque_iterator<_T, _T_Ref, _T_Ptr>& rhs)
-	{ return (rhs < lhs); }
+			FT_NAMESPACE::copy(first, first + n, d_first.curr);
+			first += n;
+			d_first += n;
+		}
+		return (d_first);
+	}
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	template <typename _T, typename _T_Ref, typename _T_Ptr>
-	inline bool
-	operator<=(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const deque_iterator<_T, _T_Ref, _T_Ptr>& rhs)
-	{ return (!(lsh > rhs)); }
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize, class U, std::size_t BuffSize2>
+	deque_iterator<U, U&, U*, BuffSize2>
+	copy(deque_iterator<T, Ref_T, Ptr_T, BuffSize> first,
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize> last, deque_iterator<U, U&, U*, BuffSize2> d_first)
+	{
+		while (first != last)
+		{
+			/* The biggest contiguous block in both ranges */
+			std::ptrdiff_t n = FT_NAMESPACE::min(first.tail - first.curr, d_first.tail - d_first.curr);
+
+			if (first.node == last.node)
+				n = FT_NAMESPACE::min(n, last.curr - first.curr);
+			FT_NAMESPACE::copy(first.curr, first.curr + n, d_first.curr);
+			first += n;
+			d_first += n;
+		}
+		return (d_first);
+	}
 
-	template <class T, typename Ref_T, typename Ptr_T>
-	template <typename _T, typename _T_Ref, typename _T_Ptr>
-	inline bool
-	operator>=(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	const deque_iterator<_T, _T_Ref, _T_Ptr>& rhs)
-	{ return (!(lhs < rhs)); }
-	//@}
+	template <class T, std::size_t BuffSize, class U>
+	void
+	fill(deque_iterator<T, T&, T*, BuffSize> first,
+	deque_iterator<T, T&, T*, BuffSize> last, const U& value)
+	{
+		if (first.node == last.node)
+			return (FT_NAMESPACE::fill(first.curr, last.curr, value));
+		FT_NAMESPACE::fill(first.curr, first.tail, value);
+		for (T** node = first.node + 1 ; node < last.node ; node++)
+			FT_NAMESPACE::fill(*node, *node + first.get_node_size(), value);
+		FT_NAMESPACE::fill(last.head, last.curr, value);
+	}
 
-	/**
-	 * 	@brief operator-+
-	 * 
-	 * 	@return The arithmetic operation between @p lhs and @p rhs.
-	*/
-	// TO DO: No not need to typedef if the functions is friend
-	template <class T, typename Ref_T, typename Ptr_T>
-	template <typename _T, typename _T_Ref, typename _T_Ptr>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::difference_type
-	operator-(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	deque_iterator<_T, _T_Ref, _T_Ptr>& rhs)
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize, class U>
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize>
+	find(deque_iterator<T, Ref_T, Ptr_T, BuffSize> first,
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize> last, const U& value)
 	{
-		// TO DO: No not need to typedef if the functions is friend
-		return (difference_type(difference_type(get_node_size()) *
-		difference_type(lhs.node - rhs.node - 1) + difference_type(lhs.curr - lhs.head)
-		+ difference_type(rhs.tail - rhs.curr)));
+		T*	found;
+
+		if (first.node == last.node)
+			return (first += FT_NAMESPACE::find(first.curr, last.curr, value) - first.curr);
+		if ((found = FT_NAMESPACE::find(first.curr, first.tail, value)) != first.tail)
+			return (deque_iterator<T, Ref_T, Ptr_T, BuffSize>(found, first.node));
+		for (T** node = first.node + 1 ; node < last.node ; node++)
+			if ((found = FT_NAMESPACE::find(*node, *node + first.get_node_size(), value)) != *node + first.get_node_size())
+				return (deque_iterator<T, Ref_T, Ptr_T, BuffSize>(found, node));
+		found = FT_NAMESPACE::find(last.head, last.curr, value);
+		return (deque_iterator<T, Ref_T, Ptr_T, BuffSize>(found, last.node));
 	}
 
-	// TO DO: No not need to typedef if the functions is friend
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::Self
-	operator-(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& lhs,
-	typename deque_iterator<T, Ref_T, Ptr_T>::difference_type n)
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize, class UnaryFunction>
+	UnaryFunction
+	for_each(deque_iterator<T, Ref_T, Ptr_T, BuffSize> first,
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize> last, UnaryFunction f)
 	{
-		Self tmp = lhs;
-		tmp -= n;
-		return (tmp);
+		if (first.node == last.node)
+			return (FT_NAMESPACE::for_each(first.curr, last.curr, f));
+		f = FT_NAMESPACE::for_each(first.curr, first.tail, f);
+		for (T** node = first.node + 1 ; node < last.node ; node++)
+			f = FT_NAMESPACE::for_each(*node, *node + first.get_node_size(), f);
+		return (FT_NAMESPACE::for_each(last.head, last.curr, f));
 	}
 
-	// TO DO: No not need to typedef if the functions is friend
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::Self
-	operator+(const typename deque_iterator<T, Ref_T, Ptr_T>::Self& x,
-	typename deque_iterator<T, Ref_T, Ptr_T>::difference_type n)
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize, class InputIt2>
+	bool
+	equal(deque_iterator<T, Ref_T, Ptr_T, BuffSize> first1,
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize> last1, InputIt2 first2)
 	{
-		Self tmp = x;
-		tmp += n;
-		return (tmp);
+		while (first1.node != last1.node)
+		{
+			for (T* p = first1.curr ; p != first1.tail ; ++p, ++first2)
+				if (!(*p == *first2))
+					return (false);
+			first1.it_change_node(first1.node + 1);
+			first1.curr = first1.head;
+		}
+		for (T* p = first1.curr ; p != last1.curr ; ++p, ++first2)
+			if (!(*p == *first2))
+				return (false);
+		return (true);
 	}
 
-	// TO DO: No not need to typedef if the functions is friend
-	template <class T, typename Ref_T, typename Ptr_T>
-	inline typename deque_iterator<T, Ref_T, Ptr_T>::Self
-	operator+(typename deque_iterator<T, Ref_T, Ptr_T>::difference_type n,
-	const typename deque_iterator<T, Ref_T, Ptr_T>::Self& x)
-	{ return (x + n); }
+	template <class T, typename Ref_T, typename Ptr_T, std::size_t BuffSize,
+	class U, typename Ref_U, typename Ptr_U, std::size_t BuffSize2>
+	bool
+	equal(deque_iterator<T, Ref_T, Ptr_T, BuffSize> first1,
+	deque_iterator<T, Ref_T, Ptr_T, BuffSize> last1, deque_iterator<U, Ref_U, Ptr_U, BuffSize2> first2)
+	{
+		while (first1 != last1)
+		{
+			/* The biggest contiguous block in both ranges */
+			std::ptrdiff_t n = FT_NAMESPACE::min(first1.tail - first1.curr, first2.tail - first2.curr);
+
+			if (first1.node == last1.node)
+				n = FT_NAMESPACE::min(n, last1.curr - first1.curr);
+			if (!FT_NAMESPACE::equal(first1.curr, first1.curr + n, first2.curr))
+				return (false);
+			first1 += n;
+			first2 += n;
+		}
+		return (true);
+	}
+	//@}
 
 	////////////////
 	// Deque Base //
@@ -454,34 +477,37 @@ namespace FT_NAMESPACE
 
 	/**
 	 * 	@brief deque_algorithm
-	 * 
+	 *
 	 * 	This class is the base class of @c deque it allocates and destroy but dont
 	 * 	initialise the data
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, std::size_t BuffSize>
 	class deque_algorithm
 	{
 		/* Member types */
 
 		protected:
 
-		typedef T				value_type;
-		typedef value_type*		pointer;
-		typedef const pointer	const_pointer;
-		typedef value_type&		reference;
-		typedef const reference	const_reference;
-		typedef Allocator		allocator_type;
+		typedef T					value_type;
+		typedef value_type*			pointer;
+		typedef const value_type*	const_pointer;
+		typedef value_type&			reference;
+		typedef const value_type&	const_reference;
+		typedef Allocator			allocator_type;
 
-		typedef deque_iterator<T, reference, pointer>				iterator;
-		typedef deque_iterator<T, const_reference, const_pointer>	const_iterator;
+		typedef deque_iterator<T, reference, pointer, BuffSize>			iterator;
+		typedef deque_iterator<T, const_reference, const_pointer, BuffSize>	const_iterator;
 
 		typedef typename iterator::difference_type	difference_type;
 		typedef typename iterator::Node_ptr			Node_ptr;
 		typedef typename iterator::Map_ptr			Map_ptr;
 		typedef typename iterator::size_type		size_type;
 
+		/* The map holds pointers to nodes, it is allocated by a rebound allocator */
+		typedef typename Allocator::template rebind<Node_ptr>::other	Map_allocator;
+
 		/* Core:
-		 * 
+		 *
 		 * head -> A %deque_iterator at the front of the deque.
 		 * tail -> A %deque_iterator at the back of the deque.
 		 * map -> An array of pointer to arrays of T.
@@ -494,99 +520,126 @@ namespace FT_NAMESPACE
 		allocator_type	memory;
 		enum { map_initial_size = 8 };
 
-		/* Import member */
-
-		using iterator::get_node_size;
-
 		/* Member functions */
 
 		public:
 
 		deque_algorithm();
 		deque_algorithm(const allocator_type& alloc);
+		~deque_algorithm();
+
+		static size_type	get_node_size() throw();
 
 		/* Memory handlers */
 		pointer		alg_allocate_node() throw(std::bad_alloc);
 		void		alg_deallocate_node(pointer p) throw();
-		pointer		alg_allocate_map(size_type n) throw(std::bad_alloc);
-		void		alg_deallocate_map(pointer p, size_type n) throw();
+		Map_ptr		alg_allocate_map(size_type n) throw(std::bad_alloc);
+		void		alg_deallocate_map(Map_ptr p, size_type n) throw();
 		void		alg_destroy_nodes(Map_ptr first, Map_ptr last) throw();
 		void		alg_create_nodes(Map_ptr first, Map_ptr last) throw(std::bad_alloc);
 		void		alg_init_map(size_type n) throw(std::bad_alloc);
+		void		alg_move_data(deque_algorithm& other) throw();
+		void		alg_swap_data(deque_algorithm& other) throw();
 	};
 
 	/**
 	 * 	@brief Default Constructor
 	*/
-	template <class T, class Allocator>
-	deque_algorithm<T, Allocator>::deque_algorithm()
+	template <class T, class Allocator, std::size_t BuffSize>
+	deque_algorithm<T, Allocator, BuffSize>::deque_algorithm()
 	: head(), tail(), map(), map_size(), memory()
 	{ }
 
-	template <class T, class Allocator>
-	deque_algorithm<T, Allocator>::deque_algorithm(const allocator_type& alloc)
+	template <class T, class Allocator, std::size_t BuffSize>
+	deque_algorithm<T, Allocator, BuffSize>::deque_algorithm(const allocator_type& alloc)
 	: head(), tail(), map(), map_size(), memory(alloc)
 	{ }
 
+	/**
+	 * 	@brief Destructor
+	 *
+	 * 	Frees the nodes and the map. The elements are destroyed by %deque.
+	*/
+	template <class T, class Allocator, std::size_t BuffSize>
+	deque_algorithm<T, Allocator, BuffSize>::~deque_algorithm()
+	{
+		if (map)
+		{
+			alg_destroy_nodes(head.node, tail.node + 1);
+			alg_deallocate_map(map, map_size);
+		}
+	}
+
+	/**
+	 * 	@brief get_node_size
+	 *
+	 * 	@return The amount of elements in a node.
+	*/
+	template <class T, class Allocator, std::size_t BuffSize>
+	inline typename deque_algorithm<T, Allocator, BuffSize>::size_type
+	deque_algorithm<T, Allocator, BuffSize>::get_node_size()
+	throw()
+	{ return (iterator::get_node_size()); }
+
 	/////////////////////
 	// Memory handlers //
 	/////////////////////
 
 	/**
 	 * 	@brief Allocate node
-	 * 
+	 *
 	 * 	Fast use of allocator.
 	*/
-	template <class T, class Allocator>
-	inline typename deque_algorithm<T, Allocator>::pointer
-	deque_algorithm<T, Allocator>::alg_allocate_node()
+	template <class T, class Allocator, std::size_t BuffSize>
+	inline typename deque_algorithm<T, Allocator, BuffSize>::pointer
+	deque_algorithm<T, Allocator, BuffSize>::alg_allocate_node()
 	throw(::std::bad_alloc)
-	{ return (memory.allocate(get_node_size())) }
+	{ return (memory.allocate(get_node_size())); }
 
 	/**
 	 * 	@brief Deallocate node
-	 * 
+	 *
 	 * 	Fast use deallocator
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, std::size_t BuffSize>
 	inline void
-	deque_algorithm<T, Allocator>::alg_deallocate_node(pointer p)
+	deque_algorithm<T, Allocator, BuffSize>::alg_deallocate_node(pointer p)
 	throw()
 	{ memory.deallocate(p, get_node_size()); }
 
 	/**
 	 * 	@brief Allocate map
-	 * 
+	 *
 	 * 	Fast use of allocator.
 	*/
-	template <class T, class Allocator>
-	inline typename deque_algorithm<T, Allocator>::pointer
-	deque_algorithm<T, Allocator>::alg_allocate_map(size_type n)
+	template <class T, class Allocator, std::size_t BuffSize>
+	inline typename deque_algorithm<T, Allocator, BuffSize>::Map_ptr
+	deque_algorithm<T, Allocator, BuffSize>::alg_allocate_map(size_type n)
 	throw(::std::bad_alloc)
-	{ return (memory.allocate(n)); }
+	{ return (Map_allocator(memory).allocate(n)); }
 
 	/**
 	 * 	@brief Deallocate map
-	 * 
+	 *
 	 * 	Fast use deallocator
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, std::size_t BuffSize>
 	inline void
-	deque_algorithm<T, Allocator>::alg_deallocate_map(pointer p, size_type n)
+	deque_algorithm<T, Allocator, BuffSize>::alg_deallocate_map(Map_ptr p, size_type n)
 	throw()
-	{ memory.deallocate(p, n); }
+	{ Map_allocator(memory).deallocate(p, n); }
 
 	/**
 	 * 	@brief Destroy nodes
-	 * 
+	 *
 	 * 	@param first A Map_ptr.
 	 * 	@param last A Map_ptr.
-	 * 
+	 *
 	 * 	Deallocates the nodes in range @p first - @p last.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, std::size_t BuffSize>
 	inline void
-	deque_algorithm<T, Allocator>::alg_destroy_nodes(Map_ptr first, Map_ptr last)
+	deque_algorithm<T, Allocator, BuffSize>::alg_destroy_nodes(Map_ptr first, Map_ptr last)
 	throw()
 	{
 		for (Map_ptr i = first ; i < last ; i++)
@@ -595,24 +648,24 @@ namespace FT_NAMESPACE
 
 	/**
 	 * 	@brief Create nodes
-	 * 
+	 *
 	 * 	@param first A Map_ptr.
 	 * 	@param last A Map_ptr.
-	 * 	
+	 *
 	 * 	Allocates nodes in range @p first - @p last.
-	 * 
+	 *
 	 * 	@throw std::bad_alloc.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, std::size_t BuffSize>
 	void
-	deque_algorithm<T, Allocator>::alg_create_nodes(Map_ptr first, Map_ptr last)
+	deque_algorithm<T, Allocator, BuffSize>::alg_create_nodes(Map_ptr first, Map_ptr last)
 	throw(::std::bad_alloc)
 	{
 		Map_ptr	curr;
 
 		try {
 			for (curr = first ; curr < last ; curr++)
-				curr = alg_allocate_node();
+				*curr = alg_allocate_node();
 		} catch(std::bad_alloc&) {
 			alg_destroy_nodes(first, curr);
 			throw;
@@ -621,36 +674,90 @@ namespace FT_NAMESPACE
 
 	/**
 	 * 	@brief Itatialise map
-	 * 
+	 *
 	 * 	@param n The len of the %deque.
-	 * 
+	 *
+	 * 	Allocates the map and the nodes needed by @p n elements, the nodes are
+	 * 	centered in the map. The elements are not constructed.
+	 *
 	 * 	@throw std::bad_alloc.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, std::size_t BuffSize>
 	void
-	deque_algorithm<T, Allocator>::alg_init_map(size_type n)
+	deque_algorithm<T, Allocator, BuffSize>::alg_init_map(size_type n)
 	throw(::std::bad_alloc)
 	{
 		const size_type		num_nodes = (n / get_node_size()) + 1;
 
-		map_size = size_type(FT_MAX(map_initial_size, num_nodes + 2));
+		map_size = size_type(FT_MAX(size_type(map_initial_size), num_nodes + 2));
 		map = alg_allocate_map(map_size);
 
-		Map_ptr		map_first = (map  + map_size - num_nodes) / 2;
+		Map_ptr		map_first = map + (map_size - num_nodes) / 2;
 		Map_ptr		map_last = map_first + num_nodes;
 
 		try {
 			alg_create_nodes(map_first, map_last);
 		}
-		catch (std::bad_alloc&) { 
+		catch (std::bad_alloc&) {
 			alg_deallocate_map(map, map_size);
+			map = Map_ptr();
+			map_size = 0;
 			throw;
 		}
 
 		head.it_change_node(map_first);
 		tail.it_change_node(map_last - 1);
 		head.curr = head.head;
-		tail.curr = tail.head + num_nodes % get_node_size();
+		tail.curr = tail.head + n % get_node_size();
+	}
+
+	/**
+	 * 	@brief Move data
+	 *
+	 * 	@param other A %deque_algorithm.
+	 *
+	 * 	Steals the map and the nodes of @p other, @p other is left empty.
+	*/
+	template <class T, class Allocator, std::size_t BuffSize>
+	inline void
+	deque_algorithm<T, Allocator, BuffSize>::alg_move_data(deque_algorithm& other)
+	throw()
+	{
+		head = other.head;
+		tail = other.tail;
+		map = other.map;
+		map_size = other.map_size;
+		other.head = iterator();
+		other.tail = iterator();
+		other.map = Map_ptr();
+		other.map_size = 0;
+	}
+
+	/**
+	 * 	@brief Swap data
+	 *
+	 * 	@param other A %deque_algorithm.
+	 *
+	 * 	Swaps the maps (and the nodes) of @c *this and @p other.
+	*/
+	template <class T, class Allocator, std::size_t BuffSize>
+	inline void
+	deque_algorithm<T, Allocator, BuffSize>::alg_swap_data(deque_algorithm& other)
+	throw()
+	{
+		const iterator	tmp_head = head;
+		const iterator	tmp_tail = tail;
+		const Map_ptr	tmp_map = map;
+		const size_type	tmp_map_size = map_size;
+
+		head = other.head;
+		tail = other.tail;
+		map = other.map;
+		map_size = other.map_size;
+		other.head = tmp_head;
+		other.tail = tmp_tail;
+		other.map = tmp_map;
+		other.map_size = tmp_map_size;
 	}
 
 	/////////////////
@@ -659,37 +766,40 @@ namespace FT_NAMESPACE
 
 	/**
 	 * 	@brief Deque
-	 * 
+	 *
 	 * 	@tparam T the type holded by a deque elemement.
 	 * 	@tparam Allocator An allocator type.
-	 * 
+	 * 	@tparam Growth A growth policy (see: ft_growth_policy.hpp).
+	 * 	@tparam BuffSize The size in bytes of a node (see: FT_DEQUE_GET_BUFF_SIZE).
+	 *
 	 * 	Front/Back insertion optimised %vector. A deque contains 4 members:
 	 *
 	 * 	- T**			map
 	 * 	- std::size_t	map_size;
 	 * 	- iterator		head, tail
-	 * 	
+	 *
 	 * 	%map_size is at least 8, %map is an array of pointers to arrays of T type,
 	 * 	%head and %tail are the front and the back of the deque. Each pointer to array
-	 * 	in %map is called a "node". Each node contains a max size of T elems that is the max
-	 * 	fast alloction size. The greather will be the size of T less elements a node will hold.
-	 * 
-	 * 	The first node starts at position (%map + %map_size) / 2, more nodes can be appended or
-	 * 	prepended. %head point to the first element in the first node and %tail points to the last
-	 * 	element in the last node. If the %deque contains more elements than %map_size, %map is
-	 * 	reallocated with a greather size.
-	 * 
+	 * 	in %map is called a "node". Each node holds @p BuffSize bytes of T elems, the greather
+	 * 	will be the size of T less elements a node will hold (but at least FT_DEQUE_MIN_NODE_SIZE).
+	 *
+	 * 	The first node starts at the middle of the %map, more nodes can be appended or
+	 * 	prepended. %head point to the first element in the first node and %tail points past
+	 * 	the last element in the last node (%tail always points into an allocated node).
+	 * 	When there's no room for a new node at one end of the %map, the nodes are recentered
+	 * 	in the %map, or the %map is reallocated with a greather size (given by the growth policy).
+	 *
 	 * 	This algorithm is faster than %vector algorithm. Each time a %vector need to increase it capacity,
 	 * 	all its elements must be copied in the new %vector. In a %deque only the pointers to the nodes will
 	 * 	be copied when an incrementation of the capacity is needed. This optimisations are the same of insertion
 	 * 	and deletion of elements.
 	*/
-	template <class T, class Allocator = allocator<T>>
-	class deque : protected deque_algorithm<T, Allocator>
+	template <class T, class Allocator = allocator<T>, class Growth = growth_double, std::size_t BuffSize = FT_DEQUE_BUFF_SIZE>
+	class deque : protected deque_algorithm<T, Allocator, BuffSize>
 	{
 		/* Member types */
 
-		typedef deque_algorithm<T, Allocator>	Base;
+		typedef deque_algorithm<T, Allocator, BuffSize>	Base;
 		typedef typename Base::Node_ptr			Node_ptr;
 		typedef typename Base::Map_ptr			Map_ptr;
 
@@ -707,12 +817,15 @@ namespace FT_NAMESPACE
 		typedef typename Base::iterator			iterator;
 		typedef typename Base::const_iterator	const_iterator;
 
-		typedef reverse_iterator<const_iterator>	const_reverse_iterator;
-		typedef reverse_iterator<iterator>			reverse_iterator;
-		
+		typedef FT_NAMESPACE::reverse_iterator<const_iterator>	const_reverse_iterator;
+		typedef FT_NAMESPACE::reverse_iterator<iterator>		reverse_iterator;
+		typedef Growth								growth_policy;
+
 		/* Import fast typing Base members */
 
-		using iterator::get_node_size;
+		protected:
+
+		using Base::get_node_size;
 		using Base::alg_allocate_node;
 		using Base::alg_deallocate_node;
 		using Base::alg_allocate_map;
@@ -720,6 +833,8 @@ namespace FT_NAMESPACE
 		using Base::alg_destroy_nodes;
 		using Base::alg_create_nodes;
 		using Base::alg_init_map;
+		using Base::alg_move_data;
+		using Base::alg_swap_data;
 
 		using Base::head;
 		using Base::tail;
@@ -731,21 +846,41 @@ namespace FT_NAMESPACE
 
 		private:
 
-		void		dq_destroy_node_in_range(Node_ptr first, Node_ptr last) throw();
-		void		dq_destroy_node(Node_ptr target) throw();
 		void		dq_destroy_in_range(iterator first, iterator last) throw();
+		void		dq_fill_initialize(const_reference value) throw(std::bad_alloc);
+		template <typename InputIt>
+		void		dq_range_initialize(InputIt& first, InputIt& last, void*) throw(std::bad_alloc);
+		template <typename InputIt>
+		void		dq_range_initialize(InputIt n, InputIt& value, int) throw(std::bad_alloc);
+		template <typename InputIt>
+		void		dq_assign_range(InputIt& first, InputIt& last, void*) throw(std::bad_alloc);
+		template <typename InputIt>
+		void		dq_assign_range(InputIt n, InputIt& value, int) throw(std::bad_alloc);
+		void		dq_reallocate_map(size_type nodes_to_add, bool add_at_front) throw(std::bad_alloc);
+		void		dq_reserve_map_at_back(size_type nodes_to_add = 1) throw(std::bad_alloc);
+		void		dq_reserve_map_at_front(size_type nodes_to_add = 1) throw(std::bad_alloc);
+		iterator	dq_reserve_elements_at_back(size_type n) throw(std::bad_alloc);
+		iterator	dq_reserve_elements_at_front(size_type n) throw(std::bad_alloc);
+		void		dq_fill_back(size_type n, const_reference value) throw(std::bad_alloc);
+		void		dq_fill_front(size_type n, const_reference value) throw(std::bad_alloc);
+		void		dq_make_gap(size_type index, size_type n, const_reference filler) throw(std::bad_alloc);
 
 		/* Member functions */
 
 		public:
 
 		deque();
+		explicit deque(const allocator_type& alloc);
 		explicit deque(size_type n, const_reference value = value_type(), const allocator_type& alloc = allocator_type());
 		deque(const deque& other);
+		deque(deque&& other);
 		template <typename InputIt>
-		deque(InputIt first, InputIt last, const allocator_type);
+		deque(InputIt first, InputIt last, const allocator_type& alloc = allocator_type());
 		~deque();
 		deque& 					operator=(const deque& other);
+		deque& 					operator=(deque&& other);
+		allocator_type			get_allocator() const;
+		void					assign(size_type n, const_reference value);
 		template <typename InputIt>
 		void					assign(InputIt first, InputIt last);
 
@@ -766,7 +901,7 @@ namespace FT_NAMESPACE
 		const_iterator			end() const;
 		reverse_iterator		rbegin();
 		const_reverse_iterator	rbegin() const;
-		reverse_iterator		rend():
+		reverse_iterator		rend();
 		const_reverse_iterator	rend() const;
 
 		/* Capacity */
@@ -776,17 +911,24 @@ namespace FT_NAMESPACE
 		bool					empty() const;
 
 		/* Modifiers */
+		void					clear();
 		void					push_front(const_reference x);
+		void					push_front(value_type&& x);
 		void					push_back(const_reference x);
+		void					push_back(value_type&& x);
+		template <typename... Args>
+		reference				emplace_front(Args&&... args);
+		template <typename... Args>
+		reference				emplace_back(Args&&... args);
 		void					pop_front();
 		void					pop_back();
 		iterator				insert(const_iterator pos, const_reference value);
-		void					insert(const_iterator pos, value_type amount, const_reference value);
+		iterator				insert(const_iterator pos, size_type amount, const_reference value);
 		template <typename InputIt>
 		iterator				insert(const_iterator pos, InputIt first, InputIt last);
-		iterator				erase(iterator pos);
-		iterator				erase(iterator first, iterator last);
-		void					swap(const deque& other);
+		iterator				erase(const_iterator pos);
+		iterator				erase(const_iterator first, const_iterator last);
+		void					swap(deque& other);
 	};
 
 	///////////////////////////////
@@ -794,66 +936,324 @@ namespace FT_NAMESPACE
 	///////////////////////////////
 
 	/**
-	 * 	@brief destruct node in range
-	 * 
-	 * 	@param first A pointer to T.
-	 * 	@param last A pointer to T.
-	 * 
-	 * 	Destructs elements in a node range @p first - @p last.
+	 * 	@brief destroy in range
+	 *
+	 * 	@param firts An %iterator.
+	 * 	@param last An %interator.
+	 *
+	 * 	Destroys the elements between @p first and @p last, the nodes
+	 * 	are not deallocated.
 	*/
-	template <class T, class Allocator>
-	inline void
-	deque<T, Allocator>::dq_destroy_node_in_range(Node_ptr first, Node_ptr last)
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::dq_destroy_in_range(iterator first, iterator last)
 	throw()
 	{
-		for (Node_ptr i = first ; i < last ; i++)
-			memory.destroy(i);
+		for ( ; first != last ; ++first)
+			memory.destroy(first.curr);
 	}
 
 	/**
-	 * 	@brief destruct and deallocate a node
-	 * 
-	 * 	@param target The node that each element will be destroyed.
+	 * 	@brief Fill initialize
+	 *
+	 * 	@param value The value of each element.
+	 *
+	 * 	Constructs copies of @p value in the storage given by alg_init_map.
+	 * 	If a construction throws, the constructed elements are destroyed.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::dq_fill_initialize(const_reference value)
+	throw(::std::bad_alloc)
+	{
+		iterator curr = head;
+
+		try {
+			for ( ; curr != tail ; ++curr)
+				memory.construct(curr.curr, value);
+		} catch (...) {
+			dq_destroy_in_range(head, curr);
+			throw;
+		}
+	}
+
+	/**
+	 * 	@brief Range initialize
+	 *
+	 * 	Appends the elements in range @p first - @p last.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	template <typename InputIt>
+	void
+	deque<T, Allocator, Growth, BuffSize>::dq_range_initialize(InputIt& first, InputIt& last, void*)
+	throw(::std::bad_alloc)
+	{
+		alg_init_map(0);
+		try {
+			for ( ; first != last ; ++first)
+				emplace_back(*first);
+		} catch (...) {
+			clear();
+			throw;
+		}
+	}
+
+	/**
+	 * 	@brief used when templates misscall dq_range_initialize willing to
+	 * 	call the fill constructor
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	template <typename InputIt>
 	inline void
-	deque<T, Allocator>::dq_destroy_node(Node_ptr target)
-	throw()
+	deque<T, Allocator, Growth, BuffSize>::dq_range_initialize(InputIt n, InputIt& value, int)
+	throw(::std::bad_alloc)
 	{
-		dq_destroy_node_in_range(target, Node_ptr(target + get_node_size()));
-		alg_deallocate_node(target);
+		alg_init_map(static_cast<size_type>(n));
+		dq_fill_initialize(static_cast<value_type>(value));
 	}
 
 	/**
-	 * 	@brief destroy in range
-	 * 
-	 * 	@param firts An %iterator.
-	 * 	@param last An %interator.
-	 * 
-	 * 	Destroys whatever is between @p first and @p last.
+	 * 	@brief assign range
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	template <typename InputIt>
 	void
-	deque<T, Allocator>::dq_destroy_in_range(iterator first, iterator last)
-	throw()
+	deque<T, Allocator, Growth, BuffSize>::dq_assign_range(InputIt& first, InputIt& last, void*)
+	throw(::std::bad_alloc)
 	{
-		/* Destroy all nodes except the edges */
-		for (Map_ptr i = first.node + 1 ; i < last.node ; i++)
-			dq_destroy_node(*i);
-		/* Destroy the remaining ranges in the edges:
-			- first.curr - firts.tail
-			- last.head - last.curr */
-		if (first.node != last.node)
+		clear();
+		for ( ; first != last ; ++first)
+			emplace_back(*first);
+	}
+
+	/**
+	 * 	@brief used when templates misscall dq_assign_range willing to
+	 * 	call assign amount
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	template <typename InputIt>
+	inline void
+	deque<T, Allocator, Growth, BuffSize>::dq_assign_range(InputIt n, InputIt& value, int)
+	throw(::std::bad_alloc)
+	{ assign(static_cast<size_type>(n), static_cast<value_type>(value)); }
+
+	/**
+	 * 	@brief Reallocate map
+	 *
+	 * 	@param nodes_to_add The amount of free map slots needed.
+	 * 	@param add_at_front True if the slots are needed before the first node.
+	 *
+	 * 	If the %map is at least twice bigger than the nodes it has to hold, the nodes
+	 * 	are only recentered in it. Else a new %map is allocated, its size is given
+	 * 	by the growth policy. Only the node pointers are copied: the nodes and the
+	 * 	elements never move, the references to the elements stay valid.
+	 *
+	 * 	@throw std::bad_alloc, @c *this is then untouched.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::dq_reallocate_map(size_type nodes_to_add, bool add_at_front)
+	throw(::std::bad_alloc)
+	{
+		const size_type	old_num_nodes = size_type(tail.node - head.node) + 1;
+		const size_type	new_num_nodes = old_num_nodes + nodes_to_add;
+		Map_ptr			new_first;
+
+		if (map_size > 2 * new_num_nodes)
 		{
-			dq_destroy_node_in_range(first.curr, first.tail);
-			alg_deallocate_node(first);
-			dq_destroy_node_in_range(last.head, last.curr);
-			alg_deallocate_node(last);
+			new_first = map + (map_size - new_num_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
+			std::memmove(static_cast<void*>(new_first), static_cast<const void*>(head.node),
+			old_num_nodes * sizeof(Node_ptr));
 		}
 		else
 		{
-			dq_destroy_node_in_range(first.curr, last.curr);
-			alg_deallocate_node(first);
+			const size_type	next = size_type(Growth::next_capacity(map_size, sizeof(Node_ptr)));
+			const size_type	new_map_size = (next > new_num_nodes ? next : new_num_nodes) + 2;
+			Map_ptr			new_map = alg_allocate_map(new_map_size);
+
+			new_first = new_map + (new_map_size - new_num_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
+			std::memcpy(static_cast<void*>(new_first), static_cast<const void*>(head.node),
+			old_num_nodes * sizeof(Node_ptr));
+			alg_deallocate_map(map, map_size);
+			map = new_map;
+			map_size = new_map_size;
+		}
+		head.it_change_node(new_first);
+		tail.it_change_node(new_first + old_num_nodes - 1);
+	}
+
+	/**
+	 * 	@brief Reserve map at back
+	 *
+	 * 	@param nodes_to_add The amount of nodes that will be appended.
+	 *
+	 * 	Makes room in the %map after the last node.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline void
+	deque<T, Allocator, Growth, BuffSize>::dq_reserve_map_at_back(size_type nodes_to_add)
+	throw(::std::bad_alloc)
+	{
+		if (nodes_to_add + 1 > map_size - size_type(tail.node - map))
+			dq_reallocate_map(nodes_to_add, false);
+	}
+
+	/**
+	 * 	@brief Reserve map at front
+	 *
+	 * 	@param nodes_to_add The amount of nodes that will be prepended.
+	 *
+	 * 	Makes room in the %map before the first node.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline void
+	deque<T, Allocator, Growth, BuffSize>::dq_reserve_map_at_front(size_type nodes_to_add)
+	throw(::std::bad_alloc)
+	{
+		if (nodes_to_add > size_type(head.node - map))
+			dq_reallocate_map(nodes_to_add, true);
+	}
+
+	/**
+	 * 	@brief Reserve elements at back
+	 *
+	 * 	@param n The amount of elements that will be appended.
+	 * 	@return The future %tail.
+	 *
+	 * 	Allocates at once all the nodes needed after the last one (and reserves
+	 * 	their map slots). Only new nodes are allocated, no element is touched.
+	 *
+	 * 	@throw std::bad_alloc, no node is then added.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::dq_reserve_elements_at_back(size_type n)
+	throw(::std::bad_alloc)
+	{
+		/* %tail must stay in an allocated node */
+		const size_type	vacancies = size_type(tail.tail - tail.curr) - 1;
+
+		if (n > vacancies)
+		{
+			const size_type	new_nodes = (n - vacancies + get_node_size() - 1) / get_node_size();
+
+			dq_reserve_map_at_back(new_nodes);
+			alg_create_nodes(tail.node + 1, tail.node + 1 + new_nodes);
+		}
+		return (tail + difference_type(n));
+	}
+
+	/**
+	 * 	@brief Reserve elements at front
+	 *
+	 * 	@param n The amount of elements that will be prepended.
+	 * 	@return The future %head.
+	 *
+	 * 	Same as dq_reserve_elements_at_back before the first node.
+	 *
+	 * 	@throw std::bad_alloc, no node is then added.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::dq_reserve_elements_at_front(size_type n)
+	throw(::std::bad_alloc)
+	{
+		const size_type	vacancies = size_type(head.curr - head.head);
+
+		if (n > vacancies)
+		{
+			const size_type	new_nodes = (n - vacancies + get_node_size() - 1) / get_node_size();
+
+			dq_reserve_map_at_front(new_nodes);
+			alg_create_nodes(head.node - new_nodes, head.node);
+		}
+		return (head - difference_type(n));
+	}
+
+	/**
+	 * 	@brief Fill back
+	 *
+	 * 	@param n The amount of appended elements.
+	 * 	@param value The value of each element (not an element of @c *this).
+	 *
+	 * 	Appends @p n copies of @p value in the nodes given by dq_reserve_elements_at_back.
+	 * 	If a construction throws, the new elements and nodes are released.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::dq_fill_back(size_type n, const_reference value)
+	throw(::std::bad_alloc)
+	{
+		const iterator	new_tail = dq_reserve_elements_at_back(n);
+		iterator		curr = tail;
+
+		try {
+			for ( ; curr != new_tail ; ++curr)
+				memory.construct(curr.curr, value);
+		} catch (...) {
+			dq_destroy_in_range(tail, curr);
+			alg_destroy_nodes(tail.node + 1, new_tail.node + 1);
+			throw;
+		}
+		tail = new_tail;
+	}
+
+	/**
+	 * 	@brief Fill front
+	 *
+	 * 	@param n The amount of prepended elements.
+	 * 	@param value The value of each element (not an element of @c *this).
+	 *
+	 * 	Same as dq_fill_back before the first element.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::dq_fill_front(size_type n, const_reference value)
+	throw(::std::bad_alloc)
+	{
+		const iterator	new_head = dq_reserve_elements_at_front(n);
+		iterator		curr = new_head;
+
+		try {
+			for ( ; curr != head ; ++curr)
+				memory.construct(curr.curr, value);
+		} catch (...) {
+			dq_destroy_in_range(new_head, curr);
+			alg_destroy_nodes(new_head.node, head.node);
+			throw;
+		}
+		head = new_head;
+	}
+
+	/**
+	 * 	@brief Make gap
+	 *
+	 * 	@param index The index of the gap.
+	 * 	@param n The size of the gap.
+	 * 	@param filler A value used to grow the %deque (not an element of @c *this).
+	 *
+	 * 	Grows the %deque by @p n at the end nearest to @p index, then moves the elements
+	 * 	between this end and @p index. The elements in range [@p index, @p index + @p n)
+	 * 	are then assignable.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::dq_make_gap(size_type index, size_type n, const_reference filler)
+	throw(::std::bad_alloc)
+	{
+		const size_type s = size();
+
+		if (index < s / 2)
+		{
+			dq_fill_front(n, filler);
+			for (size_type i = 0 ; i < index ; i++)
+				(*this)[i] = std::move((*this)[i + n]);
+		}
+		else
+		{
+			dq_fill_back(n, filler);
+			for (size_type i = s ; i > index ; i--)
+				(*this)[i + n - 1] = std::move((*this)[i - 1]);
 		}
 	}
 
@@ -864,23 +1264,34 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief Default Constructor
 	*/
-	template <class T, class Allocator>
-	deque<T, Allocator>::deque()
-	{ }
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	deque<T, Allocator, Growth, BuffSize>::deque()
+	: Base()
+	{ alg_init_map(0); }
+
+	/**
+	 * 	@brief Allocator Constructor
+	 *
+	 * 	@param alloc An allocator type.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	deque<T, Allocator, Growth, BuffSize>::deque(const allocator_type& alloc)
+	: Base(alloc)
+	{ alg_init_map(0); }
 
 	/**
 	 * 	@brief Constructor
-	 * 
+	 *
 	 * 	@param n The number of elements holded by the %deque.
 	 * 	@param value The default value of each element.
 	 * 	@param alloc An allocator type.
 	*/
-	template <class T, class Allocator>
-	deque<T, Allocator>::deque(size_type n, const_reference value = value_type(), const allocator_type& alloc)
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	deque<T, Allocator, Growth, BuffSize>::deque(size_type n, const_reference value, const allocator_type& alloc)
 	: Base(alloc)
 	{
 		alg_init_map(n);
-		assign(head, tail, value); // TO DO: Use it if it definition of assign exist
+		dq_fill_initialize(value);
 	}
 
 	/**
@@ -888,84 +1299,140 @@ namespace FT_NAMESPACE
 	 *
 	 * @param other A %deque with same T of @c *this.
 	*/
-	template <class T, class Allocator>
-	deque<T, Allocator>::deque(const deque& other)
-	: base(other.memory)
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	deque<T, Allocator, Growth, BuffSize>::deque(const deque& other)
+	: Base(other.memory)
 	{
-		alg_init_map(other.size()); // Or capacity ?
-		assign(other.begin(), other.end());
+		const_iterator	first = other.begin();
+		const_iterator	last = other.end();
+
+		dq_range_initialize(first, last, static_cast<void*>(0));
+	}
+
+	/**
+	 * 	@brief Move Constructor
+	 *
+	 * 	@param other A %deque, left empty.
+	 *
+	 * 	Steals the map of @p other, no element is copied. @p other gets
+	 * 	an empty map: it stays usable.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	deque<T, Allocator, Growth, BuffSize>::deque(deque&& other)
+	: Base(other.memory)
+	{
+		alg_init_map(0);
+		alg_swap_data(other);
 	}
 
 	/**
 	 * 	@brief Range Constructor
-	 * 
+	 *
 	 * 	@tparam InputIt An input iterator.
 	 * 	@param first An InputIt.
 	 * 	@param end An InputIt
 	 * 	@param Alloc An allocator type.
-	 * 
+	 *
 	 * 	Init a deque with the values holded in range @p first - @p last.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	template <typename InputIt>
-	deque<T, Allocator>::deque(InputIt first, InputIt last, const allocator_type)
+	deque<T, Allocator, Growth, BuffSize>::deque(InputIt first, InputIt last, const allocator_type& alloc)
 	: Base(alloc)
-	{ assign(first, last); }
+	{ dq_range_initialize(first, last, typename is_integral<InputIt>::type()); }
 
 	/**
 	 * @brief Destructor
+	 *
+	 * NOTE: The nodes and the map are deallocated by the base destructor.
 	*/
-	template <class T, class Allocator>
-	deque<T, Allocator>::~deque()
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	deque<T, Allocator, Growth, BuffSize>::~deque()
 	{ dq_destroy_in_range(begin(), end()); }
 
 	/**
 	 * 	@brief operator=
-	 * 
+	 *
 	 * 	@param other A deque.
 	 * 	@return @c *this.
 	*/
-	template <class T, class Allocator>
-	deque<T, Allocator>&
-	deque<T, Allocator>::operator=(const deque& other)
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	deque<T, Allocator, Growth, BuffSize>&
+	deque<T, Allocator, Growth, BuffSize>::operator=(const deque& other)
 	{
-		dq_destroy_in_range(begin(), end());
-		// copy form copy constructor
-		alg_init_map(other.size()); // Or capacity ?
-		assign(other.begin(), other.end());
+		if (this != &other)
+			assign(other.begin(), other.end());
+		return (*this);
+	}
+
+	/**
+	 * 	@brief operator=
+	 *
+	 * 	@param other A deque, left empty.
+	 * 	@return @c *this.
+	 *
+	 * 	Clears @c *this and swaps the maps (and the allocators), @p other
+	 * 	is left empty.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	deque<T, Allocator, Growth, BuffSize>&
+	deque<T, Allocator, Growth, BuffSize>::operator=(deque&& other)
+	{
+		if (this != &other)
+		{
+			const allocator_type tmp(memory);
+
+			clear();
+			alg_swap_data(other);
+			memory = other.memory;
+			other.memory = tmp;
+		}
+		return (*this);
+	}
+
+	/**
+	 * 	@brief get allocator
+	 *
+	 * 	@return A copy of the allocator used by the %deque.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::allocator_type
+	deque<T, Allocator, Growth, BuffSize>::get_allocator() const
+	{ return (memory); }
+
+	/**
+	 * 	@brief assign
+	 *
+	 * 	@param n The new size.
+	 * 	@param value The value of each element.
+	 *
+	 * 	Replaces the content by @p n copies of @p value.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::assign(size_type n, const_reference value)
+	{
+		/* @p value may be an element of *this */
+		const value_type tmp(value);
+
+		clear();
+		dq_fill_back(n, tmp);
 	}
 
 	/**
 	 * 	@brief assign
-	 * 
+	 *
 	 * 	@tparam InputIt An input iterator.
 	 * 	@param first An InputIt.
 	 * 	@param last An InputIt.
-	 * 
+	 *
 	 * 	Fills the copy with elements in range @p first - @p last.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	template <typename InputIt>
-	void
-	deque<T, Allocator>::assign(InputIt first, InputIt last)
-	{
-		// TO DO:
-
-		/*
-		 1) Need the number of nodes between first and last
-
-		 const size_type s = last - first // need it ?
-			 
-		 2 ) for (node = first ; node < last ; node ++) // Map_ptr
-		 		{
-					for (__node = *node ; __node < get_node_size() ; __node++) // Node_ptr
-						memory.construct(__node, node)
-				}
-			
-		Notes: - Do it using function no scracth code
-				- First and Last node are spetial remember (do like dq_destroy_in_range)
-		*/
-	}
+	inline void
+	deque<T, Allocator, Growth, BuffSize>::assign(InputIt first, InputIt last)
+	{ dq_assign_range(first, last, typename is_integral<InputIt>::type()); }
 
 	////////////////////
 	// Element access //
@@ -973,105 +1440,101 @@ namespace FT_NAMESPACE
 
 	/**
 	 * 	@brief operator[]
-	 * 
+	 *
 	 * 	@param n An index
-	 * 
+	 *
 	 * 	@return A reference to the value indexed at @p n.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::reference
-	deque<T, Allocator>::operator[](size_type n)
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::reference
+	deque<T, Allocator, Growth, BuffSize>::operator[](size_type n)
 	{ return (head[difference_type(n)]); }
 
 	/**
 	 * 	@brief operator[]
-	 * 
+	 *
 	 * 	@param n An index
-	 * 
+	 *
 	 * 	@return A const reference to the value indexed at @p n.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::const_reference
-	deque<T, Allocator>::operator[](size_type n) const
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::const_reference
+	deque<T, Allocator, Growth, BuffSize>::operator[](size_type n) const
 	{ return (head[difference_type(n)]); }
 
 	/**
 	 * 	@brief at
-	 * 
+	 *
 	 * 	@param n An index
-	 * 
+	 *
 	 * 	@return A reference to the value indexed at @p n.
-	 * 	@throw std::out_of_range if @p n > @c this->size().
+	 * 	@throw std::out_of_range if @p n >= @c this->size().
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::reference
-	deque<T, Allocator>::at(size_type n)
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::reference
+	deque<T, Allocator, Growth, BuffSize>::at(size_type n)
 	{
-		if (n > size())
-			throw std::out_of_range(std::string("deque::_M_range_check: __n "
-			       "(which is %zu)>= this->size() "
-			       "(which is %zu)"), n, size()); // TO DO: Need a printf
+		if (n >= size())
+			throw std::out_of_range(std::string("deque::at() out of range"));
 		return (head[difference_type(n)]);
 	}
 
 	/**
 	 * 	@brief at
-	 * 
+	 *
 	 * 	@param n An index
-	 * 
+	 *
 	 * 	@return A const reference to the value indexed at @p n.
-	 * 	@throw std::out_of_range if @p n > @c this->size().
+	 * 	@throw std::out_of_range if @p n >= @c this->size().
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::const_reference
-	deque<T, Allocator>::at(size_type n) const
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::const_reference
+	deque<T, Allocator, Growth, BuffSize>::at(size_type n) const
 	{
-		if (n > size())
-			throw std::out_of_range(std::string("deque::_M_range_check: __n "
-			       "(which is %zu)>= this->size() "
-			       "(which is %zu)"), n, size()); // TO DO: Need a printf
+		if (n >= size())
+			throw std::out_of_range(std::string("deque::at() out of range"));
 		return (head[difference_type(n)]);
 	}
 
 	/**
 	 * 	@brief front
-	 * 
+	 *
 	 * 	@return A reference to the first element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::reference
-	deque<T, Allocator>::front()
-	{ return (reference(*begin())); }
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::reference
+	deque<T, Allocator, Growth, BuffSize>::front()
+	{ return (*head.curr); }
 
 	/**
 	 * 	@brief front
-	 * 
+	 *
 	 * 	@return A const reference to the first element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::const_reference
-	deque<T, Allocator>::front() const
-	{ return (const_reference(*begin())); }
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::const_reference
+	deque<T, Allocator, Growth, BuffSize>::front() const
+	{ return (*head.curr); }
 
 	/**
 	 * 	@brief back
-	 * 
+	 *
 	 * 	@return A reference to the last element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::reference
-	deque<T, Allocator>::back()
-	{ return (reference(*--end())); }
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::reference
+	deque<T, Allocator, Growth, BuffSize>::back()
+	{ return (*(end() - 1)); }
 
 	/**
 	 * 	@brief back
-	 * 
+	 *
 	 * 	@return A const reference to the last element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::const_reference
-	deque<T, Allocator>::back() const
-	{ return (const_reference(*--end())); }
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::const_reference
+	deque<T, Allocator, Growth, BuffSize>::back() const
+	{ return (*(end() - 1)); }
 
 	///////////////
 	// Iterators //
@@ -1079,82 +1542,82 @@ namespace FT_NAMESPACE
 
 	/**
 	 * 	@brief begin
-	 * 
+	 *
 	 * 	@return An iterator to the first element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::iterator
-	deque<T, Allocator>::begin()
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::begin()
 	{ return (head); }
 
 	/**
 	 * 	@brief begin
-	 * 
+	 *
 	 * 	@return A const iterator to the first element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::const_iterator
-	deque<T, Allocator>::begin() const
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::const_iterator
+	deque<T, Allocator, Growth, BuffSize>::begin() const
 	{ return (head); }
 
 	/**
 	 * 	@brief end
-	 * 
-	 * 	@return An iterator to the last element in the %deque.
+	 *
+	 * 	@return An iterator past the last element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::iterator
-	deque<T, Allocator>::end()
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::end()
 	{ return (tail); }
 
 	/**
 	 * 	@brief end
-	 * 
-	 * 	@return A const iterator to the last element in the %deque.
+	 *
+	 * 	@return A const iterator past the last element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::const_iterator
-	deque<T, Allocator>::end() const
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::const_iterator
+	deque<T, Allocator, Growth, BuffSize>::end() const
 	{ return (tail); }
 
 	/**
 	 * 	@brief rbegin
-	 * 
-	 * 	@return A reverse iterator to the first element in the %deque.
+	 *
+	 * 	@return A reverse iterator to the last element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::reverse_iterator
-	deque<T, Allocator>::rbegin()
-	{ return (reverse_iterator(end() - 1)); }
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::reverse_iterator
+	deque<T, Allocator, Growth, BuffSize>::rbegin()
+	{ return (reverse_iterator(end())); }
 
 	/**
 	 * 	@brief rbegin
-	 * 
-	 * 	@return A const reverse iterator to the first element in the %deque.
+	 *
+	 * 	@return A const reverse iterator to the last element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::const_reverse_iterator
-	deque<T, Allocator>::rbegin() const
-	{ return (const_reverse_iterator(end() - 1)); }
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::const_reverse_iterator
+	deque<T, Allocator, Growth, BuffSize>::rbegin() const
+	{ return (const_reverse_iterator(end())); }
 
 	/**
 	 * 	@brief rend
-	 * 
-	 * 	@return A reverse iterator to the last element in the %deque.
+	 *
+	 * 	@return A reverse iterator before the first element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::reverse_iterator
-	deque<T, Allocator>::rend()
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::reverse_iterator
+	deque<T, Allocator, Growth, BuffSize>::rend()
 	{ return (reverse_iterator(begin())); }
 
 	/**
 	 * 	@brief rend
-	 * 
-	 * 	@return A const reverse iterator to the last element in the %deque.
+	 *
+	 * 	@return A const reverse iterator before the first element in the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::const_reverse_iterator
-	deque<T, Allocator>::rend() const
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::const_reverse_iterator
+	deque<T, Allocator, Growth, BuffSize>::rend() const
 	{ return (const_reverse_iterator(begin())); }
 
 	//////////////
@@ -1163,206 +1626,366 @@ namespace FT_NAMESPACE
 
 	/**
 	 * 	@brief size
-	 * 
+	 *
 	 * 	@return The current number of element holded by the %deque.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::size_type
-	deque<T, Allocator>::size() const
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::size_type
+	deque<T, Allocator, Growth, BuffSize>::size() const
 	{ return (size_type(tail - head)); }
 
 	/**
 	 * 	@brief max size
-	 * 
+	 *
 	 * 	@return The maximun amount of element that the %deque can hold.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::size_type
-	deque<T, Allocator>::max_size() const
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::size_type
+	deque<T, Allocator, Growth, BuffSize>::max_size() const
 	{ return (size_type(std::numeric_limits<size_type>::max() / sizeof(value_type))); }
 
 	/**
 	 * 	@brief resize
-	 * 
+	 *
 	 * 	@param new_size The new size.
 	 * 	@param value A T type value.
-	 * 
+	 *
 	 * 	Change the size of the %deque.
 	 * 	Note: if @p new_size > @c this->size() the new elements are itialised with @a value.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	void
-	deque<T, Allocator>::resize(size_type new_size, const_reference value)
+	deque<T, Allocator, Growth, BuffSize>::resize(size_type new_size, const_reference value)
 	{
-		// TO DO:
+		while (size() > new_size)
+			pop_back();
+		if (size() < new_size)
+		{
+			/* @p value may be an element of *this */
+			const value_type tmp(value);
 
-		/*
-			if (new cap > size())
-				append value elems
-			else
-				remove_elems
-		*/
+			dq_fill_back(new_size - size(), tmp);
+		}
 	}
 
 	/**
 	 * 	@brief empty
-	 * 
+	 *
 	 * 	@return True if the @c *this is empty.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline bool
-	deque<T, Allocator>::empty() const
-	{ return (begin() == end()); }
+	deque<T, Allocator, Growth, BuffSize>::empty() const
+	{ return (head.curr == tail.curr); }
 
 	///////////////
 	// Modifiers //
 	///////////////
 
+	/**
+	 * 	@brief clear
+	 *
+	 * 	Destroys all the elements, only the first node is kept.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::clear()
+	{
+		dq_destroy_in_range(begin(), end());
+		alg_destroy_nodes(head.node + 1, tail.node + 1);
+		head.curr = head.head;
+		tail = head;
+	}
+
 	/**
 	 * 	@brief push front
-	 * 
+	 *
 	 *	@param x A T element.
 	 *
 	 * 	Prepend @p x.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline void
-	deque<T, Allocator>::push_front(const_reference x)
+	deque<T, Allocator, Growth, BuffSize>::push_front(const_reference x)
+	{ emplace_front(x); }
+
+	/**
+	 * 	@brief push front
+	 *
+	 *	@param x A T element, it is moved.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline void
+	deque<T, Allocator, Growth, BuffSize>::push_front(value_type&& x)
+	{ emplace_front(std::move(x)); }
+
+	/**
+	 * 	@brief emplace front
+	 *
+	 *	@param args The arguments forwarded to the value_type constructor.
+	 *	@return A reference to the prepended element.
+	 *
+	 * 	Constructs an element in place before the first one. If the first node
+	 * 	is full a node is prepended, amortized O(1).
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	template <typename... Args>
+	typename deque<T, Allocator, Growth, BuffSize>::reference
+	deque<T, Allocator, Growth, BuffSize>::emplace_front(Args&&... args)
 	{
-		if (head.curr == head.head)
+		if (head.curr != head.head)
 		{
-			// TO DO: Resize front ?
-			// To check
+			memory.construct(head.curr - 1, std::forward<Args>(args)...);
+			--head.curr;
 		}
 		else
-			memory.construct(head.curr - 1, x);
-		head.curr--;
+		{
+			/* The elements never move, @p args stay valid */
+			dq_reserve_map_at_front();
+			*(head.node - 1) = alg_allocate_node();
+			try {
+				memory.construct(*(head.node - 1) + difference_type(get_node_size() - 1), std::forward<Args>(args)...);
+			} catch (...) {
+				alg_deallocate_node(*(head.node - 1));
+				throw;
+			}
+			head.it_change_node(head.node - 1);
+			head.curr = head.tail - 1;
+		}
+		return (*head.curr);
 	}
 
 	/**
 	 * 	@brief push back
-	 * 
+	 *
 	 *	@param x A T element.
 	 *
 	 * 	Append @p x.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline void
+	deque<T, Allocator, Growth, BuffSize>::push_back(const_reference x)
+	{ emplace_back(x); }
+
+	/**
+	 * 	@brief push back
+	 *
+	 *	@param x A T element, it is moved.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline void
-	deque<T, Allocator>::push_back(const_reference x)
+	deque<T, Allocator, Growth, BuffSize>::push_back(value_type&& x)
+	{ emplace_back(std::move(x)); }
+
+	/**
+	 * 	@brief emplace back
+	 *
+	 *	@param args The arguments forwarded to the value_type constructor.
+	 *	@return A reference to the appended element.
+	 *
+	 * 	Constructs an element in place after the last one. When it fills
+	 * 	the last node a node is appended (%tail never leaves an allocated node),
+	 * 	amortized O(1).
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	template <typename... Args>
+	typename deque<T, Allocator, Growth, BuffSize>::reference
+	deque<T, Allocator, Growth, BuffSize>::emplace_back(Args&&... args)
 	{
-		if (tail.curr == tail.tail - 1)
-			resize(size_type(size() * 2)); // DO TO: The amount of bytes each time i resize
-		memory.construct(tail.curr++, x);
+		if (tail.curr != tail.tail - 1)
+			memory.construct(tail.curr, std::forward<Args>(args)...);
+		else
+		{
+			/* The elements never move, @p args stay valid */
+			dq_reserve_map_at_back();
+			*(tail.node + 1) = alg_allocate_node();
+			try {
+				memory.construct(tail.curr, std::forward<Args>(args)...);
+			} catch (...) {
+				alg_deallocate_node(*(tail.node + 1));
+				throw;
+			}
+			tail.it_change_node(tail.node + 1);
+			tail.curr = tail.head;
+			return (*(tail.node[-1] + difference_type(get_node_size() - 1)));
+		}
+		return (*tail.curr++);
 	}
 
 	/**
 	 * 	@brief pop front
-	 * 
-	 * 	@removes the first element.
+	 *
+	 * 	Removes the first element, the first node is deallocated
+	 * 	when it becomes empty.
 	*/
-	template <class T, class Allocator>
-	inline void
-	deque<T, Allocator>::pop_front()
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::pop_front()
 	{
 		if (!empty())
 		{
+			memory.destroy(head.curr);
 			if (head.curr == head.tail - 1)
 			{
-				// Check this tail - 1 is the first element ?
+				alg_deallocate_node(head.head);
+				head.it_change_node(head.node + 1);
+				head.curr = head.head;
 			}
 			else
-				memory.destroy(head.curr++);
+				++head.curr;
 		}
 	}
 
 	/**
 	 * 	@brief pop back
-	 * 
-	 * 	@removes the first element.
+	 *
+	 * 	Removes the last element, the last node is deallocated
+	 * 	when it becomes empty.
 	*/
-	template <class T, class Allocator>
-	inline void
-	deque<T, Allocator>::pop_back()
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	void
+	deque<T, Allocator, Growth, BuffSize>::pop_back()
 	{
 		if (!empty())
 		{
 			/* Check if is the begining of a node */
 			if (tail.curr == tail.head)
 			{
-				// TO DO: Change node --> tail = tail - 1
-				// TO DO: Update curr = head.tail - 1
-				// Check if more operations are needed
+				alg_deallocate_node(tail.head);
+				tail.it_change_node(tail.node - 1);
+				tail.curr = tail.tail;
 			}
-			else
-				memory.destroy(head.curr--);
+			memory.destroy(--tail.curr);
 		}
 	}
 
 	/**
 	 * 	@brief insert
-	 * 
-	 * 	@param index A const interator into %deque.
+	 *
+	 * 	@param pos A const interator into %deque.
 	 * 	@param value The iserted value.
 	 * 	@return An iterator to the inserted data.
-	 * 
-	 * 	Insert @c value at @c index (before the current element that is holds at @c index before the call).
+	 *
+	 * 	Insert @c value at @c pos (before the current element that is holds at @c pos before the call).
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::iterator
-	deque<T, Allocator>::insert(const_iterator pos, const_reference value)
-	{
-		insert(pos, size_type(1), value);
-		return (iterator((*this)[pos]));
-	}
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::insert(const_iterator pos, const_reference value)
+	{ return (insert(pos, size_type(1), value)); }
 
-	template <class T, class Allocator>
-	void
-	deque<T, Allocator>::insert(const_iterator pos, value_type amount, const_reference value)
+	/**
+	 * 	@brief insert
+	 *
+	 * 	@param pos A const interator into %deque.
+	 * 	@param amount The amount of copies.
+	 * 	@param value The iserted value.
+	 * 	@return An iterator to the first inserted element.
+	 *
+	 * 	Only the elements between @p pos and the nearest end are moved.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::insert(const_iterator pos, size_type amount, const_reference value)
 	{
-		// TO DO: Today i m so fcking tired
+		const size_type		index = size_type(pos - const_iterator(head));
+		/* @p value may be an element of *this */
+		const value_type	tmp(value);
+
+		dq_make_gap(index, amount, tmp);
+		for (size_type i = 0 ; i < amount ; i++)
+			(*this)[index + i] = tmp;
+		return (begin() + difference_type(index));
 	}
 
-	template <class T, class Allocator>
+	/**
+	 * 	@brief insert
+	 *
+	 * 	@param pos A const interator into %deque.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 	@return An iterator to the first inserted element.
+	 *
+	 * 	Inserts the elements in range @p first - @p last before @p pos.
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	template <typename InputIt>
-	typename deque<T, Allocator>::iterator
-	deque<T, Allocator>::insert(const_iterator pos, InputIt first, Inputit last)
+	typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::insert(const_iterator pos, InputIt first, InputIt last)
 	{
-		// TO DO: Today i m so fcking tired
-	}
-
+		const size_type		index = size_type(pos - const_iterator(head));
+		/* The range may be single pass or inside *this */
+		deque				tmp(first, last, memory);
 
+		if (!tmp.empty())
+		{
+			dq_make_gap(index, tmp.size(), tmp.front());
+			for (size_type i = 0 ; i < tmp.size() ; i++)
+				(*this)[index + i] = std::move(tmp[i]);
+		}
+		return (begin() + difference_type(index));
+	}
 
 	/**
 	 * 	@brief erase
-	 * 
+	 *
 	 * 	@param pos The target iterator.
 	 * 	@return An iterator pointing to the next element.
-	 * 
+	 *
 	 * 	Remove an element at the index @a pos.
 	*/
-	template <class T, class Allocator>
-	inline typename deque<T, Allocator>::iterator
-	deque<T, Allocator>::erase(iterator pos)
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	inline typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::erase(const_iterator pos)
 	{ return (erase(pos, pos + 1)); }
 
-	template <class T, class Allocator>
-	typename deque<T, Allocator>::iterator
-	deque<T, Allocator>::erase(iterator first, iterator last)
+	/**
+	 * 	@brief erase
+	 *
+	 * 	@param first The first erased element.
+	 * 	@param last The element after the last erased.
+	 * 	@return An iterator pointing to the next element.
+	 *
+	 * 	Only the elements between the range and the nearest end are moved
+	 * 	(none for an empty range).
+	*/
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
+	typename deque<T, Allocator, Growth, BuffSize>::iterator
+	deque<T, Allocator, Growth, BuffSize>::erase(const_iterator first, const_iterator last)
 	{
-		// TO DO: Today i m so fcking tired
+		const size_type	index = size_type(first - const_iterator(head));
+		const size_type	n = size_type(last - first);
+		const size_type	s = size();
+
+		if (!n)
+			return (begin() + difference_type(index));
+		if (index < (s - n) / 2)
+		{
+			for (size_type i = index ; i > 0 ; i--)
+				(*this)[i + n - 1] = std::move((*this)[i - 1]);
+			for (size_type i = 0 ; i < n ; i++)
+				pop_front();
+		}
+		else
+		{
+			for (size_type i = index + n ; i < s ; i++)
+				(*this)[i - n] = std::move((*this)[i]);
+			for (size_type i = 0 ; i < n ; i++)
+				pop_back();
+		}
+		return (begin() + difference_type(index));
 	}
 
 	/**
 	 * 	@brief swap
-	 * 
-	 *	@param other A %vector.
+	 *
+	 *	@param other A %deque.
 	 *
 	 * 	Swap the underlying work data of @c *this and @a other.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline void
-	deque<T, Allocator>::swap(const deque& other)
-	{ alg_swap_data(other); // TO DO Implement this fct lke i did in vector }
+	deque<T, Allocator, Growth, BuffSize>::swap(deque& other)
+	{ alg_swap_data(other); }
 
 	/////////////////
 	// Non members //
@@ -1370,47 +1993,54 @@ namespace FT_NAMESPACE
 
 	//@{
 	/** @brief Boolean operators
-	 * 
+	 *
 	 * 	@param lhs A %deque.
 	 * 	@param rhs A %deque of the same type of @a lhs.
-	 * 
+	 *
 	 * 	@return A boolean that is the result of the requested boolean operation.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline bool
-	operator==(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
-	{
-		// TO DO: Is it worth it to implement std::equal ? 
-		return (lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
-	}
+	operator==(const deque<T, Allocator, Growth, BuffSize>& lhs, const deque<T, Allocator, Growth, BuffSize>& rhs)
+	{ return (lhs.size() == rhs.size() && FT_NAMESPACE::equal(lhs.begin(), lhs.end(), rhs.begin())); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline bool
-	operator<(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
-	{ return (std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()))); }
+	operator<(const deque<T, Allocator, Growth, BuffSize>& lhs, const deque<T, Allocator, Growth, BuffSize>& rhs)
+	{ return (FT_NAMESPACE::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline bool
-	operator!=(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+	operator!=(const deque<T, Allocator, Growth, BuffSize>& lhs, const deque<T, Allocator, Growth, BuffSize>& rhs)
 	{ return (!(lhs == rhs)); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline bool
-	operator>(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+	operator>(const deque<T, Allocator, Growth, BuffSize>& lhs, const deque<T, Allocator, Growth, BuffSize>& rhs)
 	{ return (rhs < lhs); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline bool
-	operator>=(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+	operator>=(const deque<T, Allocator, Growth, BuffSize>& lhs, const deque<T, Allocator, Growth, BuffSize>& rhs)
 	{ return (!(lhs < rhs)); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline bool
-	operator<=(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
-	{ return (!(last > rhs)); }
+	operator<=(const deque<T, Allocator, Growth, BuffSize>& lhs, const deque<T, Allocator, Growth, BuffSize>& rhs)
+	{ return (!(rhs < lhs)); }
+	//@}
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth, std::size_t BuffSize>
 	inline void
-	swap(const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs)
+	swap(deque<T, Allocator, Growth, BuffSize>& lhs, deque<T, Allocator, Growth, BuffSize>& rhs)
 	{ lhs.swap(rhs); }
-};
\ No newline at end of file
+
+	/**
+	 * 	@brief Page deque
+	 *
+	 * 	A %deque with page sized nodes: less nodes and map slots for big
+	 * 	elements or huge deques, same interface and iterators.
+	*/
+	template <class T, class Allocator = allocator<T>, class Growth = growth_double>
+	using page_deque = deque<T, Allocator, Growth, FT_DEQUE_PAGE_BUFF_SIZE>;
+};
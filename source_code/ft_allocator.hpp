@@ -9,6 +9,11 @@
 # pragma once
 
 # include "ft_containers.hpp"
+# include "ft_type_traits.hpp"
+
+# include <new>
+# include <memory>
+# include <utility>
 
 namespace FT_NAMESPACE
 {
@@ -48,8 +53,10 @@ namespace FT_NAMESPACE
 		pointer			address(reference x) const throw();
 		const_pointer	address(const_reference x) const throw();
 		pointer			allocate(size_type n, const void* = static_cast<const void*>(0)) throw(std::bad_alloc);
-		void			deallocate(pointer p /*, size_type amount*/) throw();
+		void			deallocate(pointer p, size_type n) throw();
 		void			construct(pointer p, const_reference value) throw(std::bad_alloc);
+		template <typename... Args>
+		void			construct(pointer p, Args&&... args) throw(std::bad_alloc);
 		void			destroy(pointer p) throw();
 		size_type		max_size() const throw();
 		template <typename T1>
@@ -97,13 +104,26 @@ namespace FT_NAMESPACE
 		return (static_cast<pointer>(::operator new(n * sizeof(value_type))));
 	}
 
+	/**
+	 * 	@brief deallocate
+	 *
+	 * 	@param p A pointer given by @c allocate (or NULL).
+	 * 	@param n The amount of objects given to @c allocate.
+	 *
+	 * 	Uses the sized global delete when the compiler supports it.
+	*/
 	template <typename T>
 	inline void
-	allocator<T>::deallocate(pointer p /*, size_type amount*/)
+	allocator<T>::deallocate(pointer p, size_type n)
 	throw()
 	{
-		// DO TO: Check what happens here if p in NULL
-		::operator delete(p/*, size_type(amount  * sizeof(value_type))*/);
+#if defined(__cpp_sized_deallocation)
+		if (p)
+			::operator delete(p, n * sizeof(value_type));
+#else
+		static_cast<void>(n);
+		::operator delete(p);
+#endif
 	}
 
 	template <typename T>
@@ -112,6 +132,19 @@ namespace FT_NAMESPACE
 	throw(::std::bad_alloc)
 	{ ::new(static_cast<void*>(p)) value_type(value); }
 
+	/**
+	 * 	@brief construct
+	 *
+	 * 	@param p A pointer to uninitialised storage.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	*/
+	template <typename T>
+	template <typename... Args>
+	inline void
+	allocator<T>::construct(pointer p, Args&&... args)
+	throw(::std::bad_alloc)
+	{ ::new(static_cast<void*>(p)) value_type(std::forward<Args>(args)...); }
+
 	template <typename T>
 	inline void
 	allocator<T>::destroy(pointer p)
@@ -133,4 +166,27 @@ namespace FT_NAMESPACE
 	inline bool
 	operator!=(const allocator<T1>&, const allocator<T2>&)
 	{ return (false); }
+
+	/**
+	 * 	@brief Allocator reallocate trait
+	 * 
+	 * 	@tparam Alloc An allocator type.
+	 * 
+	 * 	True if @p Alloc has the extension:
+	 * 
+	 * 	pointer reallocate(pointer p, size_type old_n, size_type new_n);
+	 * 
+	 * 	It gives a block of @c new_n objects holding the bytes of the
+	 * 	@c old_n first objects of @c p (grown in place when possible),
+	 * 	@c p must not be used after. On failure it throws std::bad_alloc
+	 * 	and @c p is untouched.
+	 * 
+	 * 	Specialise it for the allocators that provide it.
+	*/
+	template <typename Alloc>
+	struct allocator_can_reallocate
+	{
+		enum { value = 0 };
+		typedef false_type type;
+	};
 };
@@ -0,0 +1,435 @@
+/** @file ft_arena_allocator.hpp
+ *
+ * 	This file contains the monotonic arena and its allocator implementation.
+*/
+
+# pragma once
+
+# include "ft_allocator.hpp"
+
+# include <new>
+# include <memory>
+# include <utility>
+
+/**
+ * 	@brief Arena MACROS
+ *
+ * 	- FT_ARENA_ALIGN: Every block given by an %arena is aligned on it.
+ * 	- FT_ARENA_CHUNK_SIZE: The default size in bytes of an %arena chunk.
+ *
+ * 	Both are overwritable if needed.
+*/
+#ifndef FT_ARENA_ALIGN
+# define FT_ARENA_ALIGN 0x10
+#endif
+
+#ifndef FT_ARENA_CHUNK_SIZE
+# define FT_ARENA_CHUNK_SIZE 0x10000
+#endif
+
+namespace FT_NAMESPACE
+{
+	///////////
+	// Arena //
+	///////////
+
+	/**
+	 * 	@brief Arena
+	 *
+	 * 	Monotonic memory resource. Blocks are bump-allocated from a linked list
+	 * 	of big chunks and are never freed one by one. @c reset rewinds the arena
+	 * 	to its first chunk in O(1) (the chunks are kept and reused), @c release
+	 * 	gives back all the chunks to global delete.
+	 *
+	 * 	NOTE: Nothing is destroyed by the arena, the objects living inside must
+	 * 	be destroyed (or be trivially destructible) before a reset.
+	*/
+	class arena
+	{
+		/* Member types */
+
+		public:
+
+		typedef std::size_t	size_type;
+
+		/* Core types */
+
+		private:
+
+		/* A chunk header, the usable bytes follow it */
+		struct Arena_Chunk
+		{
+			Arena_Chunk*	next;
+			size_type		size;
+		};
+
+		enum { chunk_header_size = (sizeof(Arena_Chunk) + FT_ARENA_ALIGN - 1) & ~(FT_ARENA_ALIGN - 1) };
+
+		/**
+		 * 	Core:
+		 * 	- first -> the first chunk of the list.
+		 * 	- curr -> the chunk where the blocks are currently taken.
+		 * 	- head -> the first free byte in @c curr.
+		 * 	- tail -> the end of @c curr.
+		 * 	- chunk_size -> the minimum size of a new chunk.
+		*/
+		Arena_Chunk*	first;
+		Arena_Chunk*	curr;
+		char*			head;
+		char*			tail;
+		size_type		chunk_size;
+
+		/* Auxiliar functions */
+
+		static char*	arena_chunk_begin(Arena_Chunk* c) throw();
+		static char*	arena_chunk_end(Arena_Chunk* c) throw();
+		void			arena_use_chunk(Arena_Chunk* c) throw();
+		void*			arena_next_chunk(size_type bytes) throw(std::bad_alloc);
+
+		/* Non copyable */
+
+		arena(const arena&);
+		arena&			operator=(const arena&);
+
+		/* Member functions */
+
+		public:
+
+		explicit arena(size_type chunk_size = FT_ARENA_CHUNK_SIZE);
+		~arena();
+
+		void*			allocate(size_type bytes) throw(std::bad_alloc);
+		void			reset() throw();
+		void			release() throw();
+
+		static arena&	default_arena() throw();
+	};
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param chunk_size The minimum size in bytes of each chunk.
+	 *
+	 * 	No memory is taken until the first allocation.
+	*/
+	inline
+	arena::arena(size_type chunk_size)
+	: first(), curr(), head(), tail(), chunk_size(chunk_size)
+	{ }
+
+	/**
+	 * 	@brief Destructor
+	*/
+	inline
+	arena::~arena()
+	{ release(); }
+
+	////////////////////////
+	// Auxiliar functions //
+	////////////////////////
+
+	inline char*
+	arena::arena_chunk_begin(Arena_Chunk* c)
+	throw()
+	{ return (reinterpret_cast<char*>(c) + size_type(chunk_header_size)); }
+
+	inline char*
+	arena::arena_chunk_end(Arena_Chunk* c)
+	throw()
+	{ return (reinterpret_cast<char*>(c) + c->size); }
+
+	/**
+	 * 	@brief Use chunk
+	 *
+	 * 	Makes @p c the chunk where the blocks are taken.
+	*/
+	inline void
+	arena::arena_use_chunk(Arena_Chunk* c)
+	throw()
+	{
+		curr = c;
+		head = arena_chunk_begin(c);
+		tail = arena_chunk_end(c);
+	}
+
+	/**
+	 * 	@brief Next chunk
+	 *
+	 * 	@param bytes A rounded block size that doesn't fit in @c curr.
+	 * 	@return A block of @p bytes.
+	 *
+	 * 	Reuses the next chunk (kept by a reset) if @p bytes fits in it,
+	 * 	else links a new chunk after @c curr.
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	inline void*
+	arena::arena_next_chunk(size_type bytes)
+	throw(::std::bad_alloc)
+	{
+		Arena_Chunk* next = curr ? curr->next : first;
+
+		if (next == 0 || size_type(arena_chunk_end(next) - arena_chunk_begin(next)) < bytes)
+		{
+			const size_type	size = size_type(chunk_header_size) + (bytes > chunk_size ? bytes : chunk_size);
+			Arena_Chunk*	c = static_cast<Arena_Chunk*>(::operator new(size));
+
+			c->size = size;
+			c->next = next;
+			if (curr)
+				curr->next = c;
+			else
+				first = c;
+			next = c;
+		}
+		arena_use_chunk(next);
+		head += bytes;
+		return (head - bytes);
+	}
+
+	//////////////////////
+	// Member functions //
+	//////////////////////
+
+	/**
+	 * 	@brief allocate
+	 *
+	 * 	@param bytes The size of the requested block.
+	 * 	@return A block of at least @p bytes aligned on FT_ARENA_ALIGN.
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	inline void*
+	arena::allocate(size_type bytes)
+	throw(::std::bad_alloc)
+	{
+		bytes = (bytes + size_type(FT_ARENA_ALIGN - 1)) & ~size_type(FT_ARENA_ALIGN - 1);
+		if (size_type(tail - head) < bytes || bytes == 0)
+			return (arena_next_chunk(bytes ? bytes : size_type(FT_ARENA_ALIGN)));
+		head += bytes;
+		return (head - bytes);
+	}
+
+	/**
+	 * 	@brief reset
+	 *
+	 * 	Frees every block given by @c *this in O(1). The chunks are kept
+	 * 	and will be reused by the next allocations.
+	*/
+	inline void
+	arena::reset()
+	throw()
+	{
+		if (first)
+			arena_use_chunk(first);
+	}
+
+	/**
+	 * 	@brief release
+	 *
+	 * 	Frees every block and gives back the chunks to global delete.
+	*/
+	inline void
+	arena::release()
+	throw()
+	{
+		while (first)
+		{
+			Arena_Chunk* tmp = first;
+			first = first->next;
+			::operator delete(tmp);
+		}
+		curr = 0;
+		head = 0;
+		tail = 0;
+	}
+
+	/**
+	 * 	@brief default arena
+	 *
+	 * 	@return The arena used by default constructed %arena_allocator.
+	*/
+	inline arena&
+	arena::default_arena()
+	throw()
+	{
+		static arena a;
+		return (a);
+	}
+
+	/////////////////////
+	// Arena allocator //
+	/////////////////////
+
+	/**
+	 * 	@brief Allocator that bump-allocates from an %arena.
+	 *
+	 * 	@tparam T the type of the allocated/deallocated object.
+	 *
+	 * 	@c deallocate does nothing: the memory of all the containers sharing
+	 * 	an %arena dies together with @c arena::reset or @c arena::release.
+	 * 	Rebound copies share the same %arena.
+	*/
+	template <typename T>
+	class arena_allocator
+	{
+		/* Member types */
+
+		public:
+
+		typedef T				value_type;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+
+		template <typename T1>
+		struct rebind { typedef arena_allocator<T1> other; };
+
+		/* Core */
+
+		private:
+
+		arena*			resource;
+
+		/* Member functions */
+
+		public:
+
+		arena_allocator();
+		arena_allocator(arena& a);
+		arena_allocator(const arena_allocator& other);
+		template <typename T1>
+		arena_allocator(const arena_allocator<T1>& other);
+		~arena_allocator();
+
+		arena&			get_arena() const throw();
+		pointer			address(reference x) const throw();
+		const_pointer	address(const_reference x) const throw();
+		pointer			allocate(size_type n, const void* = static_cast<const void*>(0)) throw(std::bad_alloc);
+		void			deallocate(pointer p, size_type n) throw();
+		void			construct(pointer p, const_reference value) throw(std::bad_alloc);
+		template <typename... Args>
+		void			construct(pointer p, Args&&... args) throw(std::bad_alloc);
+		void			destroy(pointer p) throw();
+		size_type		max_size() const throw();
+	};
+
+	/**
+	 * 	@brief Default Constructor
+	 *
+	 * 	Uses @c arena::default_arena().
+	*/
+	template <typename T>
+	arena_allocator<T>::arena_allocator()
+	: resource(&arena::default_arena())
+	{ }
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param a The %arena where the memory is taken.
+	*/
+	template <typename T>
+	arena_allocator<T>::arena_allocator(arena& a)
+	: resource(&a)
+	{ }
+
+	template <typename T>
+	arena_allocator<T>::arena_allocator(const arena_allocator& other)
+	: resource(other.resource)
+	{ }
+
+	template <typename T>
+	template <typename T1>
+	arena_allocator<T>::arena_allocator(const arena_allocator<T1>& other)
+	: resource(&other.get_arena())
+	{ }
+
+	template <typename T>
+	arena_allocator<T>::~arena_allocator()
+	{ }
+
+	template <typename T>
+	inline arena&
+	arena_allocator<T>::get_arena() const
+	throw()
+	{ return (*resource); }
+
+	template <typename T>
+	inline typename arena_allocator<T>::pointer
+	arena_allocator<T>::address(reference x) const
+	throw()
+	{ return (std::addressof(x)); }
+
+	template <typename T>
+	inline typename arena_allocator<T>::const_pointer
+	arena_allocator<T>::address(const_reference x) const
+	throw()
+	{ return (std::addressof(x)); }
+
+	template <typename T>
+	inline typename arena_allocator<T>::pointer
+	arena_allocator<T>::allocate(size_type n, const void*)
+	throw(::std::bad_alloc)
+	{
+		if (n > max_size())
+			throw std::bad_alloc();
+		return (static_cast<pointer>(resource->allocate(n * sizeof(value_type))));
+	}
+
+	/**
+	 * 	@brief deallocate
+	 *
+	 * 	Does nothing, the memory is given back by the %arena.
+	*/
+	template <typename T>
+	inline void
+	arena_allocator<T>::deallocate(pointer, size_type)
+	throw()
+	{ }
+
+	template <typename T>
+	inline void
+	arena_allocator<T>::construct(pointer p, const_reference value)
+	throw(::std::bad_alloc)
+	{ ::new(static_cast<void*>(p)) value_type(value); }
+
+	/**
+	 * 	@brief construct
+	 *
+	 * 	@param p A pointer to uninitialised storage.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	*/
+	template <typename T>
+	template <typename... Args>
+	inline void
+	arena_allocator<T>::construct(pointer p, Args&&... args)
+	throw(::std::bad_alloc)
+	{ ::new(static_cast<void*>(p)) value_type(std::forward<Args>(args)...); }
+
+	template <typename T>
+	inline void
+	arena_allocator<T>::destroy(pointer p)
+	throw()
+	{ p->~value_type(); }
+
+	template <typename T>
+	inline typename arena_allocator<T>::size_type
+	arena_allocator<T>::max_size() const
+	throw()
+	{ return (size_type(-1) / sizeof(value_type)); }
+
+	/// Equal if they share the same %arena.
+	template <typename T1, typename T2>
+	inline bool
+	operator==(const arena_allocator<T1>& lhs, const arena_allocator<T2>& rhs)
+	{ return (&lhs.get_arena() == &rhs.get_arena()); }
+
+	template <typename T1, typename T2>
+	inline bool
+	operator!=(const arena_allocator<T1>& lhs, const arena_allocator<T2>& rhs)
+	{ return (!(lhs == rhs)); }
+};
@@ -12,6 +12,18 @@
 
 # define FT_NAMESPACE ft
 
+/**
+ * 	@brief Concurrency MACROS
+ *
+ * 	- FT_CACHE_LINE_SIZE: The size of a cache line, the data written by
+ * 	different threads is kept on different lines (no false sharing).
+ *
+ * 	It is overwritable if needed.
+*/
+#ifndef FT_CACHE_LINE_SIZE
+# define FT_CACHE_LINE_SIZE 0x40
+#endif
+
 namespace FT_NAMESPACE
 {
 
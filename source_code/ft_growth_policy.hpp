@@ -0,0 +1,129 @@
+/** @file ft_growth_policy.hpp
+ *
+ * 	This file contains the growth policies of the sequence containers.
+ *
+ * 	Policies: growth_double, growth_one_and_half, growth_page
+*/
+
+# pragma once
+
+# include "ft_containers.hpp"
+
+# include <cstddef>
+
+/**
+ * 	@brief Growth policy MACROS
+ *
+ * 	- FT_GROWTH_MIN_CAPACITY: The smallest capacity given by a growth.
+ * 	- FT_GROWTH_PAGE_SIZE: The page size used by %growth_page.
+ *
+ * 	Both are overwritable if needed.
+*/
+#ifndef FT_GROWTH_MIN_CAPACITY
+# define FT_GROWTH_MIN_CAPACITY 0x8
+#endif
+
+#ifndef FT_GROWTH_PAGE_SIZE
+# define FT_GROWTH_PAGE_SIZE 0x1000
+#endif
+
+namespace FT_NAMESPACE
+{
+	/**
+	 * 	@brief Growth policies
+	 *
+	 * 	A growth policy is given as template parameter to a container, it
+	 * 	chooses the next capacity when the container is full:
+	 *
+	 * 	static std::size_t next_capacity(std::size_t n, std::size_t elem_size);
+	 *
+	 * 	@p n is the amount of elements that must fit, @p elem_size the size in
+	 * 	bytes of an element. The result must be >= @p n. The policies below
+	 * 	never overflow: near the limit they give growth_max_capacity(elem_size),
+	 * 	the container then clamps it to its max_size().
+	 *
+	 * 	ft::vector<int, ft::allocator<int>, ft::growth_one_and_half> v;
+	*/
+
+	/**
+	 * 	@brief Max capacity
+	 *
+	 * 	@param elem_size The size in bytes of an element.
+	 * 	@return The biggest capacity whose size in bytes fits a std::size_t.
+	*/
+	inline std::size_t
+	growth_max_capacity(std::size_t elem_size)
+	throw()
+	{ return (std::size_t(-1) / (elem_size ? elem_size : 1)); }
+
+	/// Doubles the capacity: few reallocations, up to half of the block unused.
+	struct growth_double
+	{
+		static std::size_t	next_capacity(std::size_t n, std::size_t elem_size) throw();
+	};
+
+	inline std::size_t
+	growth_double::next_capacity(std::size_t n, std::size_t elem_size)
+	throw()
+	{
+		const std::size_t max = growth_max_capacity(elem_size);
+
+		if (n < std::size_t(FT_GROWTH_MIN_CAPACITY))
+			return (std::size_t(FT_GROWTH_MIN_CAPACITY));
+		if (n > max / 2)
+			return (n > max ? n : max);
+		return (n * 2);
+	}
+
+	/// Grows by 1.5: less memory wasted, more reallocations.
+	struct growth_one_and_half
+	{
+		static std::size_t	next_capacity(std::size_t n, std::size_t elem_size) throw();
+	};
+
+	inline std::size_t
+	growth_one_and_half::next_capacity(std::size_t n, std::size_t elem_size)
+	throw()
+	{
+		const std::size_t max = growth_max_capacity(elem_size);
+
+		if (n < std::size_t(FT_GROWTH_MIN_CAPACITY))
+			return (std::size_t(FT_GROWTH_MIN_CAPACITY));
+		if (n > max - n / 2)
+			return (n > max ? n : max);
+		return (n + n / 2);
+	}
+
+	/**
+	 * 	@brief Page rounded growth
+	 *
+	 * 	@tparam Growth The policy choosing the capacity.
+	 * 	@tparam PageSize The page size in bytes.
+	 *
+	 * 	Once the block reaches a page, its size is rounded up to a multiple
+	 * 	of @p PageSize: the tail of the last page is used instead of lost.
+	 * 	Meant for huge containers.
+	*/
+	template <typename Growth = growth_double, std::size_t PageSize = FT_GROWTH_PAGE_SIZE>
+	struct growth_page
+	{
+		static std::size_t	next_capacity(std::size_t n, std::size_t elem_size) throw();
+	};
+
+	template <typename Growth, std::size_t PageSize>
+	inline std::size_t
+	growth_page<Growth, PageSize>::next_capacity(std::size_t n, std::size_t elem_size)
+	throw()
+	{
+		const std::size_t cap = Growth::next_capacity(n, elem_size);
+
+		if (cap > growth_max_capacity(elem_size))
+			return (cap);
+
+		const std::size_t bytes = cap * elem_size;
+
+		if (bytes < PageSize || bytes > std::size_t(-1) - PageSize)
+			return (cap);
+		return (((bytes + PageSize - 1) / PageSize * PageSize) / elem_size);
+	}
+};
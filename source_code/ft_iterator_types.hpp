@@ -98,8 +98,8 @@ namespace FT_NAMESPACE
 		typedef random_access_iterator_tag		iterator_category;
 		typedef It_type							value_type;
 		typedef std::ptrdiff_t					difference_type;
-		typedef It_type*						pointer;
-		typedef It_type&						reference;
+		typedef const It_type*					pointer;
+		typedef const It_type&					reference;
 	};
 
 	/**
@@ -0,0 +1,203 @@
+/** @file ft_malloc_allocator.hpp
+ *
+ * 	This file contains the malloc based allocator implementation.
+*/
+
+# pragma once
+
+# include "ft_allocator.hpp"
+
+# include <new>
+# include <memory>
+# include <utility>
+# include <cstdlib>
+
+namespace FT_NAMESPACE
+{
+	//////////////////////
+	// Malloc allocator //
+	//////////////////////
+
+	/**
+	 * 	@brief Allocator that uses malloc/free and can grow a block with realloc.
+	 *
+	 * 	@tparam T the type of the allocated/deallocated object.
+	 *
+	 * 	It provides the @c reallocate extension (see: allocator_can_reallocate),
+	 * 	a %vector of trivially relocatable elements then grows without copying
+	 * 	itself: the C library extends the block in place when the next bytes are
+	 * 	free, and remaps the pages (mremap) for the big blocks.
+	 *
+	 * 	ft::vector<double, ft::malloc_allocator<double> > v;
+	*/
+	template <typename T>
+	class malloc_allocator
+	{
+		/* Member types */
+
+		public:
+
+		typedef T				value_type;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+
+		template <typename T1>
+		struct rebind { typedef malloc_allocator<T1> other; };
+
+		/* Member functions */
+
+		malloc_allocator();
+		malloc_allocator(const malloc_allocator&);
+		template <typename T1>
+		malloc_allocator(const malloc_allocator<T1>&);
+		~malloc_allocator();
+
+		pointer			address(reference x) const throw();
+		const_pointer	address(const_reference x) const throw();
+		pointer			allocate(size_type n, const void* = static_cast<const void*>(0)) throw(std::bad_alloc);
+		pointer			reallocate(pointer p, size_type old_n, size_type new_n) throw(std::bad_alloc);
+		void			deallocate(pointer p, size_type n) throw();
+		void			construct(pointer p, const_reference value) throw(std::bad_alloc);
+		template <typename... Args>
+		void			construct(pointer p, Args&&... args) throw(std::bad_alloc);
+		void			destroy(pointer p) throw();
+		size_type		max_size() const throw();
+	};
+
+	template <typename T>
+	malloc_allocator<T>::malloc_allocator()
+	{ }
+
+	template <typename T>
+	malloc_allocator<T>::malloc_allocator(const malloc_allocator&)
+	{ }
+
+	template <typename T>
+	template <typename T1>
+	malloc_allocator<T>::malloc_allocator(const malloc_allocator<T1>&)
+	{ }
+
+	template <typename T>
+	malloc_allocator<T>::~malloc_allocator()
+	{ }
+
+	template <typename T>
+	inline typename malloc_allocator<T>::pointer
+	malloc_allocator<T>::address(reference x) const
+	throw()
+	{ return (std::addressof(x)); }
+
+	template <typename T>
+	inline typename malloc_allocator<T>::const_pointer
+	malloc_allocator<T>::address(const_reference x) const
+	throw()
+	{ return (std::addressof(x)); }
+
+	/**
+	 * 	@brief allocate
+	 *
+	 * 	@param n The amount of objects.
+	 * 	@return A block of @p n objects (a valid block if @p n is 0).
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	template <typename T>
+	inline typename malloc_allocator<T>::pointer
+	malloc_allocator<T>::allocate(size_type n, const void*)
+	throw(::std::bad_alloc)
+	{
+		if (n > max_size())
+			throw std::bad_alloc();
+
+		void* p = std::malloc(n ? n * sizeof(value_type) : size_type(1));
+
+		if (p == 0)
+			throw std::bad_alloc();
+		return (static_cast<pointer>(p));
+	}
+
+	/**
+	 * 	@brief reallocate
+	 *
+	 * 	@param p A pointer given by allocate/reallocate (or NULL).
+	 * 	@param old_n The amount of objects of @p p (unused, realloc knows it).
+	 * 	@param new_n The new amount of objects.
+	 * 	@return A block of @p new_n objects holding the bytes of @p p.
+	 *
+	 * 	@throw std::bad_alloc, @p p is then untouched.
+	*/
+	template <typename T>
+	inline typename malloc_allocator<T>::pointer
+	malloc_allocator<T>::reallocate(pointer p, size_type old_n, size_type new_n)
+	throw(::std::bad_alloc)
+	{
+		static_cast<void>(old_n);
+		if (new_n > max_size())
+			throw std::bad_alloc();
+
+		void* tmp = std::realloc(static_cast<void*>(p), new_n ? new_n * sizeof(value_type) : size_type(1));
+
+		if (tmp == 0)
+			throw std::bad_alloc();
+		return (static_cast<pointer>(tmp));
+	}
+
+	template <typename T>
+	inline void
+	malloc_allocator<T>::deallocate(pointer p, size_type)
+	throw()
+	{ std::free(static_cast<void*>(p)); }
+
+	template <typename T>
+	inline void
+	malloc_allocator<T>::construct(pointer p, const_reference value)
+	throw(::std::bad_alloc)
+	{ ::new(static_cast<void*>(p)) value_type(value); }
+
+	/**
+	 * 	@brief construct
+	 *
+	 * 	@param p A pointer to uninitialised storage.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	*/
+	template <typename T>
+	template <typename... Args>
+	inline void
+	malloc_allocator<T>::construct(pointer p, Args&&... args)
+	throw(::std::bad_alloc)
+	{ ::new(static_cast<void*>(p)) value_type(std::forward<Args>(args)...); }
+
+	template <typename T>
+	inline void
+	malloc_allocator<T>::destroy(pointer p)
+	throw()
+	{ p->~value_type(); }
+
+	template <typename T>
+	inline typename malloc_allocator<T>::size_type
+	malloc_allocator<T>::max_size() const
+	throw()
+	{ return (size_type(-1) / sizeof(value_type)); }
+
+	/// All the malloc allocators share the C heap.
+	template <typename T1, typename T2>
+	inline bool
+	operator==(const malloc_allocator<T1>&, const malloc_allocator<T2>&)
+	{ return (true); }
+
+	template <typename T1, typename T2>
+	inline bool
+	operator!=(const malloc_allocator<T1>&, const malloc_allocator<T2>&)
+	{ return (false); }
+
+	template <typename T>
+	struct allocator_can_reallocate<malloc_allocator<T> >
+	{
+		enum { value = 1 };
+		typedef true_type type;
+	};
+};
@@ -0,0 +1,449 @@
+/** @file ft_pool_allocator.hpp
+ *
+ * 	This file contains the size-class pooling allocator implementation.
+*/
+
+# pragma once
+
+# include "ft_allocator.hpp"
+
+# include <new>
+# include <memory>
+# include <utility>
+
+/**
+ * 	@brief Pool allocator MACROS
+ *
+ * 	- FT_POOL_ALIGN: The granularity of a size class, every block is
+ * 	rounded up to a multiple of it (keeps the blocks max-aligned).
+ * 	- FT_POOL_MAX_BYTES: The biggest block served by the free lists,
+ * 	bigger requests go directly to global new. It covers the deque nodes
+ * 	(512 bytes by default) and the first node chunks of the trees.
+ * 	- FT_POOL_CHUNK_OBJECTS: The amount of blocks carved per refill.
+ * 	- FT_POOL_REFILL_BYTES: The most bytes carved per refill, big size
+ * 	classes carve less than FT_POOL_CHUNK_OBJECTS blocks.
+ *
+ * 	All of them are overwritable if needed.
+*/
+#ifndef FT_POOL_ALIGN
+# define FT_POOL_ALIGN 0x10
+#endif
+
+#ifndef FT_POOL_MAX_BYTES
+# define FT_POOL_MAX_BYTES 0x1000
+#endif
+
+#ifndef FT_POOL_CHUNK_OBJECTS
+# define FT_POOL_CHUNK_OBJECTS 0x20
+#endif
+
+#ifndef FT_POOL_REFILL_BYTES
+# define FT_POOL_REFILL_BYTES 0x4000
+#endif
+
+namespace FT_NAMESPACE
+{
+	///////////////////////
+	// Pool engine class //
+	///////////////////////
+
+	/**
+	 * 	@brief Pool allocator base
+	 *
+	 * 	Holds the free lists shared by every %pool_allocator, one list per
+	 * 	size class. A size class is a multiple of FT_POOL_ALIGN bytes.
+	 * 	Blocks are carved from big chunks taken from global new and are
+	 * 	recycled through the free lists, chunks are never given back.
+	 *
+	 * 	NOTE: Each thread has its own pool, so no lock is taken. A block
+	 * 	freed by an other thread than the one that allocated it joins the
+	 * 	free lists of the freeing thread. The blocks cached by a thread are
+	 * 	lost when it exits.
+	*/
+	class pool_allocator_base
+	{
+		/* Member types */
+
+		protected:
+
+		typedef std::size_t	size_type;
+
+		/* Core types */
+
+		union Pool_Obj
+		{
+			Pool_Obj*	next;
+			char		data[1];
+		};
+
+		enum { pool_free_lists = FT_POOL_MAX_BYTES / FT_POOL_ALIGN };
+
+		/**
+		 * 	Core:
+		 * 	- free_lists -> the heads of each size class free list.
+		 * 	- chunk_head -> the first free byte in the current chunk.
+		 * 	- chunk_tail -> the end of the current chunk.
+		 * 	- heap_size -> the amount of bytes taken from global new.
+		*/
+		struct Pool_State
+		{
+			Pool_Obj*	free_lists[pool_free_lists];
+			char*		chunk_head;
+			char*		chunk_tail;
+			size_type	heap_size;
+		};
+
+		/* Auxiliar functions */
+
+		static Pool_State&	pool_get_state() throw();
+		static size_type	pool_round_up(size_type bytes) throw();
+		static Pool_Obj*&	pool_get_free_list(size_type bytes) throw();
+		static char*		pool_allocate_chunk(size_type bytes, size_type& nobjs) throw(std::bad_alloc);
+		static void*		pool_refill(size_type bytes) throw(std::bad_alloc);
+
+		/* Member functions */
+
+		static void*		pool_allocate(size_type bytes) throw(std::bad_alloc);
+		static void			pool_deallocate(void* p, size_type bytes) throw();
+	};
+
+	/**
+	 * 	@brief Get state
+	 *
+	 * 	@return The pool state of the calling thread, zero-initialised at
+	 * 	its first call.
+	*/
+	inline pool_allocator_base::Pool_State&
+	pool_allocator_base::pool_get_state()
+	throw()
+	{
+		static thread_local Pool_State state;
+		return (state);
+	}
+
+	/**
+	 * 	@brief Round up
+	 *
+	 * 	@return @p bytes rounded up to the next size class.
+	*/
+	inline pool_allocator_base::size_type
+	pool_allocator_base::pool_round_up(size_type bytes)
+	throw()
+	{ return ((bytes + size_type(FT_POOL_ALIGN - 1)) & ~size_type(FT_POOL_ALIGN - 1)); }
+
+	/**
+	 * 	@brief Get free list
+	 *
+	 * 	@param bytes A block size in range 1 - FT_POOL_MAX_BYTES.
+	 * 	@return A reference to the head of the free list of @p bytes size class.
+	*/
+	inline pool_allocator_base::Pool_Obj*&
+	pool_allocator_base::pool_get_free_list(size_type bytes)
+	throw()
+	{ return (pool_get_state().free_lists[(bytes + size_type(FT_POOL_ALIGN - 1)) / FT_POOL_ALIGN - 1]); }
+
+	/**
+	 * 	@brief Allocate chunk
+	 *
+	 * 	@param bytes A rounded block size.
+	 * 	@param nobjs The amount of requested blocks, updated with the
+	 * 	amount of blocks really given.
+	 * 	@return A pointer to @p nobjs contiguous blocks of @p bytes.
+	 *
+	 * 	Takes the blocks from the current chunk. If the chunk is exhausted
+	 * 	its remaining bytes are pushed into their size class free list
+	 * 	and a bigger chunk is taken from global new.
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	inline char*
+	pool_allocator_base::pool_allocate_chunk(size_type bytes, size_type& nobjs)
+	throw(::std::bad_alloc)
+	{
+		Pool_State&		state = pool_get_state();
+		size_type		total = bytes * nobjs;
+		const size_type	left = size_type(state.chunk_tail - state.chunk_head);
+		char*			ret = state.chunk_head;
+
+		/* Enough space for all the requested blocks or at least one */
+		if (left >= bytes)
+		{
+			if (left < total)
+			{
+				nobjs = left / bytes;
+				total = bytes * nobjs;
+			}
+			state.chunk_head += total;
+			return (ret);
+		}
+
+		/* Recycle the remaining bytes (always a multiple of FT_POOL_ALIGN) */
+		if (left > 0)
+		{
+			Pool_Obj*& free_list = pool_get_free_list(left);
+			reinterpret_cast<Pool_Obj*>(state.chunk_head)->next = free_list;
+			free_list = reinterpret_cast<Pool_Obj*>(state.chunk_head);
+		}
+		state.chunk_head = 0;
+		state.chunk_tail = 0;
+
+		/* Chunks grow with the amount of memory already used by the pool */
+		const size_type	new_size = 2 * total + pool_round_up(state.heap_size >> 4);
+		char*			chunk = static_cast<char*>(::operator new(new_size));
+
+		state.chunk_head = chunk;
+		state.chunk_tail = chunk + new_size;
+		state.heap_size += new_size;
+		return (pool_allocate_chunk(bytes, nobjs));
+	}
+
+	/**
+	 * 	@brief Refill
+	 *
+	 * 	@param bytes A rounded block size.
+	 * 	@return A block of @p bytes.
+	 *
+	 * 	Carves up to FT_POOL_CHUNK_OBJECTS blocks (at most FT_POOL_REFILL_BYTES),
+	 * 	returns the first one and links the others into the (empty) free
+	 * 	list of @p bytes.
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	inline void*
+	pool_allocator_base::pool_refill(size_type bytes)
+	throw(::std::bad_alloc)
+	{
+		size_type	nobjs = size_type(FT_POOL_REFILL_BYTES) / bytes;
+
+		if (nobjs > size_type(FT_POOL_CHUNK_OBJECTS))
+			nobjs = FT_POOL_CHUNK_OBJECTS;
+		if (nobjs == 0)
+			nobjs = 1;
+
+		char*		chunk = pool_allocate_chunk(bytes, nobjs);
+
+		if (nobjs > 1)
+		{
+			Pool_Obj*	curr = reinterpret_cast<Pool_Obj*>(chunk + bytes);
+
+			pool_get_free_list(bytes) = curr;
+			for (size_type i = 2 ; i < nobjs ; i++)
+			{
+				curr->next = reinterpret_cast<Pool_Obj*>(reinterpret_cast<char*>(curr) + bytes);
+				curr = curr->next;
+			}
+			curr->next = 0;
+		}
+		return (chunk);
+	}
+
+	/**
+	 * 	@brief Pool allocate
+	 *
+	 * 	@param bytes The size of the requested block.
+	 * 	@return A block of at least @p bytes.
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	inline void*
+	pool_allocator_base::pool_allocate(size_type bytes)
+	throw(::std::bad_alloc)
+	{
+		if (bytes > size_type(FT_POOL_MAX_BYTES))
+			return (::operator new(bytes));
+		if (bytes == 0)
+			bytes = 1;
+
+		Pool_Obj*& free_list = pool_get_free_list(bytes);
+		Pool_Obj* ret = free_list;
+
+		if (ret == 0)
+			return (pool_refill(pool_round_up(bytes)));
+		free_list = ret->next;
+		return (ret);
+	}
+
+	/**
+	 * 	@brief Pool deallocate
+	 *
+	 * 	@param p A block given by pool_allocate.
+	 * 	@param bytes The size used to allocate @p p.
+	 *
+	 * 	Pushes @p p at the front of its size class free list.
+	*/
+	inline void
+	pool_allocator_base::pool_deallocate(void* p, size_type bytes)
+	throw()
+	{
+		if (p == 0)
+			return ;
+		if (bytes > size_type(FT_POOL_MAX_BYTES))
+			::operator delete(p);
+		else
+		{
+			if (bytes == 0)
+				bytes = 1;
+
+			Pool_Obj*& free_list = pool_get_free_list(bytes);
+			static_cast<Pool_Obj*>(p)->next = free_list;
+			free_list = static_cast<Pool_Obj*>(p);
+		}
+	}
+
+	////////////////////
+	// Pool allocator //
+	////////////////////
+
+	/**
+	 * 	@brief Allocator that uses per size class free lists.
+	 *
+	 * 	@tparam T the type of the allocated/deallocated object.
+	 *
+	 * 	Drop-in for %allocator. Small blocks (up to FT_POOL_MAX_BYTES) are
+	 * 	served by the free lists of %pool_allocator_base, so node based
+	 * 	containers (map, set, multimap, multiset, deque) don't call global
+	 * 	new/delete for each node. Bigger blocks use global new.
+	 *
+	 * 	NOTE: deallocate must receive the amount given to allocate, the
+	 * 	size class is found from it (no per-block header).
+	*/
+	template <typename T>
+	class pool_allocator : protected pool_allocator_base
+	{
+		/* Member types */
+
+		public:
+
+		typedef T				value_type;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+
+		template <typename T1>
+		struct rebind { typedef pool_allocator<T1> other; };
+
+		/* Member functions */
+
+		pool_allocator();
+		pool_allocator(const pool_allocator&);
+		template <typename T1>
+		pool_allocator(const pool_allocator<T1>&);
+		~pool_allocator();
+
+		pointer			address(reference x) const throw();
+		const_pointer	address(const_reference x) const throw();
+		pointer			allocate(size_type n, const void* = static_cast<const void*>(0)) throw(std::bad_alloc);
+		void			deallocate(pointer p, size_type n) throw();
+		void			construct(pointer p, const_reference value) throw(std::bad_alloc);
+		template <typename... Args>
+		void			construct(pointer p, Args&&... args) throw(std::bad_alloc);
+		void			destroy(pointer p) throw();
+		size_type		max_size() const throw();
+	};
+
+	template <typename T>
+	pool_allocator<T>::pool_allocator()
+	{ }
+
+	template <typename T>
+	pool_allocator<T>::pool_allocator(const pool_allocator&)
+	{ }
+
+	template <typename T>
+	template <typename T1>
+	pool_allocator<T>::pool_allocator(const pool_allocator<T1>&)
+	{ }
+
+	template <typename T>
+	pool_allocator<T>::~pool_allocator()
+	{ }
+
+	template <typename T>
+	inline typename pool_allocator<T>::pointer
+	pool_allocator<T>::address(reference x) const
+	throw()
+	{ return (std::addressof(x)); }
+
+	template <typename T>
+	inline typename pool_allocator<T>::const_pointer
+	pool_allocator<T>::address(const_reference x) const
+	throw()
+	{ return (std::addressof(x)); }
+
+	/**
+	 * 	@brief allocate
+	 *
+	 * 	@param n The amount of objects.
+	 * 	@return A pointer to an uninitialised array of @p n T.
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	template <typename T>
+	inline typename pool_allocator<T>::pointer
+	pool_allocator<T>::allocate(size_type n, const void*)
+	throw(::std::bad_alloc)
+	{
+		if (n > max_size())
+			throw std::bad_alloc();
+		return (static_cast<pointer>(pool_allocate(n * sizeof(value_type))));
+	}
+
+	/**
+	 * 	@brief deallocate
+	 *
+	 * 	@param p A pointer given by allocate.
+	 * 	@param n The amount of objects given to allocate.
+	 *
+	 * 	Gives back @p p to its size class free list.
+	*/
+	template <typename T>
+	inline void
+	pool_allocator<T>::deallocate(pointer p, size_type n)
+	throw()
+	{ pool_deallocate(p, n * sizeof(value_type)); }
+
+	template <typename T>
+	inline void
+	pool_allocator<T>::construct(pointer p, const_reference value)
+	throw(::std::bad_alloc)
+	{ ::new(static_cast<void*>(p)) value_type(value); }
+
+	/**
+	 * 	@brief construct
+	 *
+	 * 	@param p A pointer to uninitialised storage.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	*/
+	template <typename T>
+	template <typename... Args>
+	inline void
+	pool_allocator<T>::construct(pointer p, Args&&... args)
+	throw(::std::bad_alloc)
+	{ ::new(static_cast<void*>(p)) value_type(std::forward<Args>(args)...); }
+
+	template <typename T>
+	inline void
+	pool_allocator<T>::destroy(pointer p)
+	throw()
+	{ p->~value_type(); }
+
+	template <typename T>
+	inline typename pool_allocator<T>::size_type
+	pool_allocator<T>::max_size() const
+	throw()
+	{ return (size_type(-1) / sizeof(value_type)); }
+
+	/// All the %pool_allocator share the same pool.
+	template <typename T1, typename T2>
+	inline bool
+	operator==(const pool_allocator<T1>&, const pool_allocator<T2>&)
+	{ return (true); }
+
+	template <typename T1, typename T2>
+	inline bool
+	operator!=(const pool_allocator<T1>&, const pool_allocator<T2>&)
+	{ return (false); }
+};
@@ -9,8 +9,6 @@
  */
 
 // TO DO:
-// - Const iterator incrememtation / decrementation is commented
-// - Change std::distance in count by my distance
 // - Const types in const specilisation equal_range
 // - I've changed lower / lower bound
 // - I've add a const_cast to get_end
@@ -20,8 +18,48 @@
 # include "ft_iterator.hpp"
 # include "ft_allocator.hpp"
 
+# include <iterator> // std::iterator_traits
+# include <limits>
+# include <new>
 # include <utility> // std::pair
 
+/**
+ * 	@brief Red Black tree node pool MACROS
+ *
+ * 	- FT_RBTREE_NODE_POOL: If true (default) each tree takes its nodes from
+ * 	its own slab, else each node is an allocator call.
+ * 	- FT_RBTREE_POOL_CHUNK: The amount of nodes of the first chunk of a slab
+ * 	(at least 2), each next chunk doubles it.
+ * 	- FT_RBTREE_POOL_MAX_CHUNK: The maximum amount of nodes of a chunk.
+ *
+ * 	All of them are overwritable if needed.
+*/
+#ifndef FT_RBTREE_NODE_POOL
+# define FT_RBTREE_NODE_POOL 1
+#endif
+
+#ifndef FT_RBTREE_POOL_CHUNK
+# define FT_RBTREE_POOL_CHUNK 0x20
+#endif
+
+#ifndef FT_RBTREE_POOL_MAX_CHUNK
+# define FT_RBTREE_POOL_MAX_CHUNK 0x1000
+#endif
+
+/**
+ * 	@brief Red Black tree order statistics MACROS
+ *
+ * 	- FT_RBTREE_ORDER_STATISTICS: If true each node holds the size of its
+ * 	subtree: nth(), rank() and the distance between two iterators are
+ * 	logarithmic, but every insert and erase updates the sizes up to the
+ * 	root. Else (default) a node is a word smaller and they are linear.
+ *
+ * 	It is overwritable if needed.
+*/
+#ifndef FT_RBTREE_ORDER_STATISTICS
+# define FT_RBTREE_ORDER_STATISTICS 0
+#endif
+
 namespace FT_NAMESPACE
 {
 	////////////////////
@@ -39,6 +77,26 @@ namespace FT_NAMESPACE
 		RBT_Black = true
 	};
 
+	/////////////////
+	// Sorted tags //
+	/////////////////
+
+	//@{
+	/**
+	 * 	@brief Sorted range tags
+	 * 
+	 * 	Given to the range constructors and inserters of the associative
+	 * 	containers: the range is promised sorted by the container compare
+	 * 	(without equal keys for @c sorted_unique). An empty tree is then
+	 * 	built in linear time without any comparison.
+	*/
+	struct sorted_unique_t { };
+	struct sorted_equivalent_t { };
+
+	static const sorted_unique_t		sorted_unique = sorted_unique_t();
+	static const sorted_equivalent_t	sorted_equivalent = sorted_equivalent_t();
+	//@}
+
 	//////////////////////////////
 	// Red Black tree node base //
 	//////////////////////////////
@@ -61,6 +119,9 @@ namespace FT_NAMESPACE
 		Base_Ptr	parent;
 		Base_Ptr	left;
 		Base_Ptr	right;
+#if FT_RBTREE_ORDER_STATISTICS
+		std::size_t	subtree_size;
+#endif
 
 		/* Static Members */
 
@@ -116,6 +177,63 @@ namespace FT_NAMESPACE
 	*/
 	//@}
 
+	//@{
+	/**
+	 * 	@brief Subtree sizes
+	 * 
+	 * 	- Node_size: The amount of nodes of the subtree of @p x (0 if NULL).
+	 * 	- Node_set_size: Sets the subtree size of @p x.
+	 * 	- Node_update_size: Computes the subtree size of @p x from its children
+	 * 	(after a rotation).
+	 * 	- Node_add_size: Adds @p n to the subtree size of @p x and its parents,
+	 * 	until @p header (after a node is linked or unlinked).
+	 * 
+	 * 	NOTE: They do nothing if not FT_RBTREE_ORDER_STATISTICS.
+	*/
+	inline static std::size_t
+	Node_size(const RBT_Node_Base* x)
+	throw()
+	{
+#if FT_RBTREE_ORDER_STATISTICS
+		return (x ? x->subtree_size : 0);
+#else
+		(void)x;
+		return (0);
+#endif
+	}
+
+	inline static void
+	Node_set_size(RBT_Node_Base* x, std::size_t n)
+	throw()
+	{
+#if FT_RBTREE_ORDER_STATISTICS
+		x->subtree_size = n;
+#else
+		(void)x;
+		(void)n;
+#endif
+	}
+
+	inline static void
+	Node_update_size(RBT_Node_Base* x)
+	throw()
+	{ Node_set_size(x, Node_size(x->left) + Node_size(x->right) + 1); }
+
+	inline static void
+	Node_add_size(RBT_Node_Base* x, const RBT_Node_Base* header, std::ptrdiff_t n)
+	throw()
+	{
+#if FT_RBTREE_ORDER_STATISTICS
+		for ( ; x != header ; x = x->parent)
+			x->subtree_size += n;
+#else
+		(void)x;
+		(void)header;
+		(void)n;
+#endif
+	}
+	//@}
+
 	///////////////////////////
 	// Red Black tree header //
 	///////////////////////////
@@ -149,6 +267,7 @@ namespace FT_NAMESPACE
 	/**
 	 * @brief Constructor
 	*/
+	inline
 	RBT_Header::RBT_Header()
 	{
 		header.color = RBT_Red;
@@ -174,11 +293,17 @@ namespace FT_NAMESPACE
 	 * 	@brief move data
 	 * 
 	 * 	Copy all the data from @p other to @c *this.
+	 * 	NOTE: @p other is left empty.
 	*/
-	void
+	inline void
 	RBT_Header::Header_move_data(RBT_Header& other)
 	throw()
 	{
+		if (other.header.parent == 0)
+		{
+			Header_reset();
+			return ;
+		}
 		header.color = other.header.color;
 		header.parent = other.header.parent;
 		header.left = other.header.left;
@@ -206,7 +331,7 @@ namespace FT_NAMESPACE
 
 		typedef Val						value_type;
 		typedef value_type*				pointer;
-		typedef const pointer			const_pointer;
+		typedef const value_type*		const_pointer;
 		typedef RBT_Node<Val>*			Link_type;
 
 		/* Core */
@@ -236,6 +361,295 @@ namespace FT_NAMESPACE
 	{ return (std::addressof(value)); }
 	//@}
 
+	///////////////////////////
+	// Augmentation policies //
+	///////////////////////////
+
+	/**
+	 * 	@brief Augmentation policies
+	 * 
+	 * 	An augmentation policy is given as last template parameter to a
+	 * 	RedBlackTree, it keeps an aggregate of each subtree in its root node
+	 * 	(the max end of the intervals, a sum, ...):
+	 * 
+	 * 	typedef Data data_type;
+	 * 	template <typename Compare>
+	 * 	static void update(data_type& data, const Val& value,
+	 * 		const data_type* left, const data_type* right, const Compare& comp) throw();
+	 * 
+	 * 	@p update computes the @p data of a node from its @p value and the
+	 * 	data of its children (NULL if they are missing), @p comp is the key
+	 * 	compare object of the tree. The tree calls it
+	 * 	after a rotation and on the path to the root of a linked or unlinked
+	 * 	node, the queries are left to the container (see interval_map).
+	 * 	NOTE: The data may only depend on the keys, a mapped value changed
+	 * 	through an iterator doesn't update it.
+	*/
+
+	/// No augmentation (default): nothing is stored nor updated.
+	struct augment_none { };
+
+	/**
+	 * 	@brief Augmented node
+	 * 
+	 * 	@tparam Val The type of the value holded by the node.
+	 * 	@tparam Augment An augmentation policy.
+	 * 
+	 * 	The node allocated by a tree: a RBT_Node holding the data of
+	 * 	@p Augment too.
+	 * 
+	 * 	- Node_augment: Updates the data of @p x from its children.
+	 * 	- Node_augment_path: Updates @p x and its parents, until @p header.
+	 * 	- Node_copy_augment: Copies the data of @p src to @p dst (same subtree).
+	*/
+	template <typename Val, typename Augment>
+	struct RBT_Augmented_Node : public RBT_Node<Val>
+	{
+		/* Member types */
+
+		typedef typename Augment::data_type		data_type;
+		typedef RBT_Augmented_Node<Val, Augment>	Self;
+
+		/* Core */
+
+		data_type		augment_data;
+
+		/* Static members */
+
+		static const data_type*	Node_get_augment(const RBT_Node_Base* x) throw();
+		template <typename Compare>
+		static void				Node_augment(RBT_Node_Base* x, const Compare& comp) throw();
+		template <typename Compare>
+		static void				Node_augment_path(RBT_Node_Base* x, const RBT_Node_Base* header,
+								const Compare& comp) throw();
+		static void				Node_copy_augment(RBT_Node_Base* dst, const RBT_Node_Base* src) throw();
+	};
+
+	/**
+	 * 	@brief Node_get_augment
+	 * 
+	 * 	@return A pointer to the data of @p x (NULL if @p x is NULL).
+	*/
+	template <typename Val, typename Augment>
+	inline const typename RBT_Augmented_Node<Val, Augment>::data_type*
+	RBT_Augmented_Node<Val, Augment>::Node_get_augment(const RBT_Node_Base* x)
+	throw()
+	{ return (x ? &static_cast<const Self*>(static_cast<const RBT_Node<Val>*>(x))->augment_data : 0); }
+
+	template <typename Val, typename Augment>
+	template <typename Compare>
+	inline void
+	RBT_Augmented_Node<Val, Augment>::Node_augment(RBT_Node_Base* x, const Compare& comp)
+	throw()
+	{
+		Self* const node = static_cast<Self*>(static_cast<RBT_Node<Val>*>(x));
+
+		Augment::update(node->augment_data, node->value, Node_get_augment(x->left),
+		Node_get_augment(x->right), comp);
+	}
+
+	template <typename Val, typename Augment>
+	template <typename Compare>
+	inline void
+	RBT_Augmented_Node<Val, Augment>::Node_augment_path(RBT_Node_Base* x, const RBT_Node_Base* header,
+	const Compare& comp)
+	throw()
+	{
+		for ( ; x != header ; x = x->parent)
+			Node_augment(x, comp);
+	}
+
+	template <typename Val, typename Augment>
+	inline void
+	RBT_Augmented_Node<Val, Augment>::Node_copy_augment(RBT_Node_Base* dst, const RBT_Node_Base* src)
+	throw()
+	{ static_cast<Self*>(static_cast<RBT_Node<Val>*>(dst))->augment_data = *Node_get_augment(src); }
+
+	/// Not augmented node: same size as a RBT_Node, the updates do nothing.
+	template <typename Val>
+	struct RBT_Augmented_Node<Val, augment_none> : public RBT_Node<Val>
+	{
+		template <typename Compare>
+		static void		Node_augment(RBT_Node_Base*, const Compare&) throw() { }
+		template <typename Compare>
+		static void		Node_augment_path(RBT_Node_Base*, const RBT_Node_Base*, const Compare&) throw() { }
+		static void		Node_copy_augment(RBT_Node_Base*, const RBT_Node_Base*) throw() { }
+	};
+
+	////////////////////
+	// Node slab pool //
+	////////////////////
+
+	/**
+	 * 	@brief Node Pool
+	 * 
+	 * 	@tparam Node The type of the nodes (a RBT_Node).
+	 * 	@tparam Alloc The allocator of the tree.
+	 * 
+	 * 	The node slab of a tree: nodes are carved in order from chunks taken
+	 * 	from the node allocator, so the nodes inserted together are close in
+	 * 	memory. Dropped nodes are recycled through an intrusive free list
+	 * 	(linked by their @c parent). The chunks are only given back by
+	 * 	Pool_release, the pool doesn't own an allocator.
+	*/
+	template <typename Node, typename Alloc>
+	struct RBT_Node_Pool
+	{
+		/* Member types */
+
+		typedef std::size_t										size_type;
+		typedef Node*											Link_type;
+		typedef typename Alloc::template rebind<Node>::other	Node_allocator;
+
+		/* The head of a chunk, placed in its first node */
+		struct Pool_Chunk
+		{
+			Pool_Chunk*	next;
+			size_type	size;
+		};
+
+		/* Core:
+		 *
+		 * free_nodes -> The dropped nodes, linked by their parent.
+		 * chunk_head -> The next never used node of the newest chunk.
+		 * chunk_tail -> The end of the newest chunk.
+		 * chunks -> All the chunks, the newest first.
+		*/
+		Link_type	free_nodes;
+		Link_type	chunk_head;
+		Link_type	chunk_tail;
+		Pool_Chunk*	chunks;
+
+		/* Member functions */
+
+		RBT_Node_Pool();
+
+		Link_type	Pool_get(Node_allocator alloc) throw(std::bad_alloc);
+		void		Pool_put(Link_type p) throw();
+		void		Pool_release(Node_allocator alloc) throw();
+		void		Pool_move_data(RBT_Node_Pool& other) throw();
+
+		private:
+
+		void		Pool_refill(Node_allocator& alloc) throw(std::bad_alloc);
+	};
+
+	/**
+	 * 	@brief Constructor
+	 * 
+	 * 	An empty pool, the first chunk is taken by the first Pool_get.
+	*/
+	template <typename Node, typename Alloc>
+	inline
+	RBT_Node_Pool<Node, Alloc>::RBT_Node_Pool()
+	: free_nodes(0), chunk_head(0), chunk_tail(0), chunks(0)
+	{ }
+
+	/**
+	 * 	@brief get
+	 * 
+	 * 	@param alloc The node allocator of the tree.
+	 * 	@return An uninitialised node, the last dropped one if any.
+	 * 	@throw std::bad_alloc
+	*/
+	template <typename Node, typename Alloc>
+	inline typename RBT_Node_Pool<Node, Alloc>::Link_type
+	RBT_Node_Pool<Node, Alloc>::Pool_get(Node_allocator alloc)
+	throw(::std::bad_alloc)
+	{
+		if (free_nodes)
+		{
+			Link_type p = free_nodes;
+
+			free_nodes = static_cast<Link_type>(p->parent);
+			return (p);
+		}
+		if (chunk_head == chunk_tail)
+			Pool_refill(alloc);
+		return (chunk_head++);
+	}
+
+	/**
+	 * 	@brief put
+	 * 
+	 * 	@param p A node given by Pool_get, its value already destroyed.
+	*/
+	template <typename Node, typename Alloc>
+	inline void
+	RBT_Node_Pool<Node, Alloc>::Pool_put(Link_type p)
+	throw()
+	{
+		p->parent = free_nodes;
+		free_nodes = p;
+	}
+
+	/**
+	 * 	@brief release
+	 * 
+	 * 	@param alloc The node allocator of the tree.
+	 * 
+	 * 	Gives all the chunks back to @p alloc.
+	 * 	NOTE: No node of the pool may be in use.
+	*/
+	template <typename Node, typename Alloc>
+	void
+	RBT_Node_Pool<Node, Alloc>::Pool_release(Node_allocator alloc)
+	throw()
+	{
+		for (Pool_Chunk* c = chunks, *next ; c ; c = next)
+		{
+			next = c->next;
+			alloc.deallocate(reinterpret_cast<Link_type>(c), c->size);
+		}
+		free_nodes = chunk_head = chunk_tail = 0;
+		chunks = 0;
+	}
+
+	/**
+	 * 	@brief move data
+	 * 
+	 * 	Takes the chunks of @p other, @c *this must be empty.
+	 * 	NOTE: @p other is left empty.
+	*/
+	template <typename Node, typename Alloc>
+	inline void
+	RBT_Node_Pool<Node, Alloc>::Pool_move_data(RBT_Node_Pool& other)
+	throw()
+	{
+		*this = other;
+		other.free_nodes = other.chunk_head = other.chunk_tail = 0;
+		other.chunks = 0;
+	}
+
+	/**
+	 * 	@brief refill
+	 * 
+	 * 	@param alloc The node allocator of the tree.
+	 * 
+	 * 	Takes a new chunk, twice as large as the previous one (up to
+	 * 	FT_RBTREE_POOL_MAX_CHUNK nodes). Its first node holds the chunk head.
+	 * 	@throw std::bad_alloc
+	*/
+	template <typename Node, typename Alloc>
+	void
+	RBT_Node_Pool<Node, Alloc>::Pool_refill(Node_allocator& alloc)
+	throw(::std::bad_alloc)
+	{
+		size_type n = FT_RBTREE_POOL_CHUNK;
+
+		if (chunks)
+			n = chunks->size << 1 < FT_RBTREE_POOL_MAX_CHUNK ? chunks->size << 1 : FT_RBTREE_POOL_MAX_CHUNK;
+
+		const Link_type		first = alloc.allocate(n);
+		Pool_Chunk* const	c = ::new(static_cast<void*>(first)) Pool_Chunk;
+
+		c->next = chunks;
+		c->size = n;
+		chunks = c;
+		chunk_head = first + 1;
+		chunk_tail = first + n;
+	}
+
 	/////////////////
 	// Key Compare //
 	/////////////////
@@ -383,6 +797,53 @@ namespace FT_NAMESPACE
 	{ return (aux_decrement(const_cast<RBT_Node_Base*>(x))); }
 	//@}
 
+	//////////////////////
+	// Order statistics //
+	//////////////////////
+
+	/**
+	 * 	@brief index
+	 * 
+	 * 	@param x A red black tree node or the header.
+	 * 
+	 * 	@return The amount of nodes before @p x in order (the size of the
+	 * 	tree for the header).
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	*/
+	inline std::size_t
+	RBT_index(const RBT_Node_Base* x)
+	throw()
+	{
+		/* The header is red and it is the parent of the root (or alone) */
+		const bool				is_header = x->color == RBT_Red && (x->parent == 0 || x->parent->parent == x);
+		const RBT_Node_Base*	y = x;
+		std::size_t				i = 0;
+
+		if (FT_RBTREE_ORDER_STATISTICS)
+		{
+			if (is_header)
+				return (Node_size(x->parent));
+
+			/* The left subtree, then the parents on the left and their left subtrees */
+			i = Node_size(x->left);
+			for ( ; x->parent->parent != x ; x = x->parent)
+				if (x == x->parent->right)
+					i += Node_size(x->parent->left) + 1;
+			return (i);
+		}
+
+		/* Go up to the header, then count from its leftmost node */
+		if (!is_header)
+		{
+			while (y->parent->parent != y)
+				y = y->parent;
+			y = y->parent;
+		}
+		for (y = y->left ; y != x ; y = RBT_increment(y))
+			i++;
+		return (i);
+	}
+
 	/////////////////////////////
 	// Red Black tree iterator //
 	/////////////////////////////
@@ -425,8 +886,8 @@ namespace FT_NAMESPACE
 		Self			operator--(int);
 
 		/* Non members */
-		friend bool	operator==(const Self&, const Self&);
-		friend bool	operator!=(const Self&, const Self&);
+		friend bool	operator==(const Self& lhs, const Self& rhs) { return (lhs.node == rhs.node); }
+		friend bool	operator!=(const Self& lhs, const Self& rhs) { return (lhs.node != rhs.node); }
 	};
 
 	/**
@@ -501,20 +962,6 @@ namespace FT_NAMESPACE
 		return (tmp);
 	}
 
-	/////////////////
-	// Non members //
-	/////////////////
-
-	template <typename T>
-	inline bool
-	operator==(const typename RBT_iterator<T>::Self& lhs, const typename RBT_iterator<T>::Self& rhs)
-	{ return (lhs.node == rhs.node); }
-
-	template <typename T>
-	inline bool
-	operator!=(const typename RBT_iterator<T>::Self& lhs, const typename RBT_iterator<T>::Self& rhs)
-	{ return (lhs.node != rhs.node); }
-
 	///////////////////////////////////
 	// Red Black tree const iterator //
 	///////////////////////////////////
@@ -524,9 +971,9 @@ namespace FT_NAMESPACE
 	{
 		/* Member types */
 
-		typedef T			value_type;
-		typedef value_type&	reference;
-		typedef value_type*	pointer;
+		typedef T					value_type;
+		typedef const value_type&	reference;
+		typedef const value_type*	pointer;
 
 		typedef RBT_iterator<value_type> iterator;
 
@@ -534,7 +981,7 @@ namespace FT_NAMESPACE
 		typedef std::ptrdiff_t				difference_type;
 
 		typedef RBT_const_iterator<value_type>	Self;
-		typedef RBT_Node_Base::Const_Base_Ptr	Node_Ptr;
+		typedef const RBT_Node_Base*			Node_Ptr;
 		typedef const RBT_Node<value_type>*		Link_type;
 
 		/* Core */
@@ -561,8 +1008,8 @@ namespace FT_NAMESPACE
 		Self			operator--(int);
 
 		/* Non members */
-		friend bool	operator==(const Self&, const Self&);
-		friend bool	operator!=(const Self&, const Self&);
+		friend bool	operator==(const Self& lhs, const Self& rhs) { return (lhs.node == rhs.node); }
+		friend bool	operator!=(const Self& lhs, const Self& rhs) { return (lhs.node != rhs.node); }
 	};
 
 	template <typename T>
@@ -607,7 +1054,7 @@ namespace FT_NAMESPACE
 	inline typename RBT_const_iterator<T>::Self&
 	RBT_const_iterator<T>::operator++()
 	{
-		//node = RBT_increment(node);
+		node = RBT_increment(node);
 		return (*this);
 	}
 
@@ -628,7 +1075,7 @@ namespace FT_NAMESPACE
 	inline typename RBT_const_iterator<T>::Self&
 	RBT_const_iterator<T>::operator--()
 	{
-		//node = RBT_decrement(node);
+		node = RBT_decrement(node);
 		return (*this);
 	}
 
@@ -641,19 +1088,40 @@ namespace FT_NAMESPACE
 		return (tmp);
 	}
 
-	/////////////////
-	// Non members //
-	/////////////////
+	//////////////////////////////////////
+	// Red Black tree iterator distance //
+	//////////////////////////////////////
 
+	//@{
+	/**
+	 * 	@brief distance
+	 * 
+	 * 	@param first An iterator.
+	 * 	@param last An iterator of the same tree, not before @p first.
+	 * 	@return The amount of elements in [first, last).
+	 * 
+	 * 	Overloads ft::distance for the tree iterators: logarithmic if
+	 * 	FT_RBTREE_ORDER_STATISTICS, else linear.
+	*/
 	template <typename T>
-	inline bool
-	operator==(const typename RBT_const_iterator<T>::Self& lhs, const typename RBT_const_iterator<T>::Self& rhs)
-	{ return (lhs.node == rhs.node); }
+	inline typename RBT_iterator<T>::difference_type
+	distance(RBT_iterator<T> first, RBT_iterator<T> last)
+	{ return (distance(RBT_const_iterator<T>(first), RBT_const_iterator<T>(last))); }
 
 	template <typename T>
-	inline bool
-	operator!=(const typename RBT_const_iterator<T>::Self& lhs, const typename RBT_const_iterator<T>::Self& rhs)
-	{ return (lhs.node != rhs.node); }
+	typename RBT_const_iterator<T>::difference_type
+	distance(RBT_const_iterator<T> first, RBT_const_iterator<T> last)
+	{
+		typename RBT_const_iterator<T>::difference_type dist = 0;
+
+		if (FT_RBTREE_ORDER_STATISTICS)
+			return (static_cast<std::ptrdiff_t>(RBT_index(last.node))
+			- static_cast<std::ptrdiff_t>(RBT_index(first.node)));
+		for ( ; first != last ; ++first)
+			dist++;
+		return (dist);
+	}
+	//@}
 
 	/////////////////////////
 	// Red Black tree base //
@@ -663,8 +1131,9 @@ namespace FT_NAMESPACE
 	 * 	@brief RBT_Base
 	 * 
 	 * 	The base class of RedBlackTree class. Fast type for initialiation.
+	 * 	@p Node is the type of the nodes allocated by the pool.
 	*/
-	template <typename Val, typename Key_Compare, typename Alloc>
+	template <typename Val, typename Key_Compare, typename Alloc, typename Node = RBT_Node<Val> >
 	struct RBT_Base
 	: public RBT_Key_Compare<Key_Compare>, public RBT_Header, public RBT_Node<Val>
 	{
@@ -672,7 +1141,7 @@ namespace FT_NAMESPACE
 
 		typedef RBT_Key_Compare<Key_Compare>	Base_Key_Compare;
 		typedef RBT_Header						RBT_Header;
-		typedef RBT_Node<Val>					RBT_Node;
+		typedef FT_NAMESPACE::RBT_Node<Val>		RBT_Node;
 		typedef Alloc							allocator_type;
 
 		/* Imported members */
@@ -684,6 +1153,7 @@ namespace FT_NAMESPACE
 		/* Core */
 
 		allocator_type			memory;
+		RBT_Node_Pool<Node, Alloc>	pool;
 
 		/* Member functions */
 
@@ -695,24 +1165,24 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief Default Constructor
 	*/
-	template <typename Val, typename Key_Compare, typename Alloc>
-	RBT_Base<Val, Key_Compare, Alloc>::RBT_Base()
+	template <typename Val, typename Key_Compare, typename Alloc, typename Node>
+	RBT_Base<Val, Key_Compare, Alloc, Node>::RBT_Base()
 	: RBT_Node(), memory()
 	{ }
 
 	/**
 	 * 	@brief Constructor
 	*/
-	template <typename Val, typename Key_Compare, typename Alloc>
-	RBT_Base<Val, Key_Compare, Alloc>::RBT_Base(const Key_Compare& cmp, const RBT_Node& x, allocator_type alloc)
+	template <typename Val, typename Key_Compare, typename Alloc, typename Node>
+	RBT_Base<Val, Key_Compare, Alloc, Node>::RBT_Base(const Key_Compare& cmp, const RBT_Node& x, allocator_type alloc)
 	: Base_Key_Compare(cmp), RBT_Node(x), memory(alloc)
 	{ }
 
 	/**
 	 * 	@brief Copy Constructor
 	*/
-	template <typename Val, typename Key_Compare, typename Alloc>
-	RBT_Base<Val, Key_Compare, Alloc>::RBT_Base(const RBT_Base& other)
+	template <typename Val, typename Key_Compare, typename Alloc, typename Node>
+	RBT_Base<Val, Key_Compare, Alloc, Node>::RBT_Base(const RBT_Base& other)
 	: Base_Key_Compare(other.key_compare), RBT_Node(other), memory(other.memory)
 	{ }
 
@@ -728,6 +1198,7 @@ namespace FT_NAMESPACE
 	 * 	@tparam Key_Val
 	 * 	@tparam Compare
 	 * 	@tparam Alloc
+	 * 	@tparam Augment An augmentation policy (see augment_none).
 	 * 
 	 * 	A red-black tree is a kind of Abstract Search Tree specilised using
 	 * 	Nodes defined by a color: Red or Black.
@@ -744,21 +1215,25 @@ namespace FT_NAMESPACE
 	 * 	RBT architecture must be corrected if necesary. This is the complexity.
 	 * 	
 	*/
-	template <typename Key, typename Val, typename Key_Val, typename Compare, typename Alloc = allocator<Val>>
-	class RedBlackTree : public RBT_Base<Val, Compare, Alloc> // check for second param template Base
+	template <typename Key, typename Val, typename Key_Val, typename Compare, typename Alloc = allocator<Val>,
+	typename Augment = augment_none>
+	class RedBlackTree : public RBT_Base<Val, Compare, Alloc, RBT_Augmented_Node<Val, Augment> > // check for second param template Base
 	{
 		/* Engine types */
 
 		protected:
 
 		typedef RBT_Node_Base*							Node_Ptr;
-		typedef const Node_Ptr							Const_Node_Ptr;
+		typedef const RBT_Node_Base*					Const_Node_Ptr;
 		typedef RBT_Node<Val>*							Link_type;
-		typedef const Link_type							Const_Link_type;
+		typedef const RBT_Node<Val>*					Const_Link_type;
+
+		/* The allocated nodes, Link_type plus the augmentation data */
+		typedef RBT_Augmented_Node<Val, Augment>		Node_type;
 
-		// TO DO: Function to recicle a pool of nodes
-		// TO DO: Alloc Node
-		// (perhabs to do, perhabs not) // DO IT !
+		/* Nodes are bigger than Val, they are allocated by a rebound allocator
+			(any %pool_allocator size class can then serve them) */
+		typedef typename Alloc::template rebind<Node_type>::other	Node_allocator;
 
 		/* Members types */
 
@@ -767,7 +1242,7 @@ namespace FT_NAMESPACE
 		typedef Key					key_type;
 		typedef Val					value_type;
 		typedef value_type*			pointer;
-		typedef const pointer		const_pointer;
+		typedef const value_type*	const_pointer;
 		typedef value_type&			reference;
 		typedef const value_type&	const_reference;
 		typedef std::size_t			size_type;
@@ -777,17 +1252,18 @@ namespace FT_NAMESPACE
 		typedef RBT_iterator<value_type>		iterator;
 		typedef RBT_const_iterator<value_type>	const_iterator;
 
-		typedef reverse_iterator<const_iterator>	const_reverse_iterator;
-		typedef reverse_iterator<iterator>			reverse_iterator;
+		typedef FT_NAMESPACE::reverse_iterator<const_iterator>	const_reverse_iterator;
+		typedef FT_NAMESPACE::reverse_iterator<iterator>		reverse_iterator;
 
 		/* Fast type base members */
 
-		using RBT_Base<Val, Compare, Alloc>::header;
-		using RBT_Base<Val, Compare, Alloc>::tree_count;
-		using RBT_Base<Val, Compare, Alloc>::key_compare;
-		using RBT_Base<Val, Compare, Alloc>::memory;
-		using RBT_Base<Val, Compare, Alloc>::Header_reset;
-		using RBT_Base<Val, Compare, Alloc>::Header_move_data;
+		using RBT_Base<Val, Compare, Alloc, Node_type>::header;
+		using RBT_Base<Val, Compare, Alloc, Node_type>::tree_count;
+		using RBT_Base<Val, Compare, Alloc, Node_type>::key_compare;
+		using RBT_Base<Val, Compare, Alloc, Node_type>::memory;
+		using RBT_Base<Val, Compare, Alloc, Node_type>::pool;
+		using RBT_Base<Val, Compare, Alloc, Node_type>::Header_reset;
+		using RBT_Base<Val, Compare, Alloc, Node_type>::Header_move_data;
 
 		/* Auxiliar functions*/
 
@@ -795,11 +1271,11 @@ namespace FT_NAMESPACE
 
 		/* Fast typping / readable basic operations */
 		Node_Ptr&						get_root() throw();
-		Const_Node_Ptr&					get_root() const throw();
+		Const_Node_Ptr					get_root() const throw();
 		Node_Ptr&						get_leftmost() throw();
-		Const_Node_Ptr&					get_leftmost() const throw();
+		Const_Node_Ptr					get_leftmost() const throw();
 		Node_Ptr&						get_rightmost() throw();
-		Const_Node_Ptr&					get_rightmost() const throw();
+		Const_Node_Ptr					get_rightmost() const throw();
 		Link_type						get_begin() throw();
 		Const_Link_type					get_begin() const throw();
 		Const_Node_Ptr					get_end() const throw();
@@ -821,9 +1297,10 @@ namespace FT_NAMESPACE
 		/* Memory handlers */
 		Link_type						get_node() throw(std::bad_alloc);
 		void							put_node(Link_type p) throw();
-		void							construct_node(Link_type target,
-										const_reference value) throw(std::bad_alloc);
-		Link_type						create_node(const_reference value) throw(std::bad_alloc);
+		template <typename... Args>
+		void							construct_node(Link_type target, Args&&... args);
+		template <typename... Args>
+		Link_type						create_node(Args&&... args);
 		void							destroy_node(Link_type p) throw();
 		void							drop_node(Link_type p) throw();
 		template <typename NodeGen>
@@ -831,21 +1308,24 @@ namespace FT_NAMESPACE
 
 		/* Copy handlers */
 		template <typename NodeGen>
-		Link_type						aux_copy(Link_type target, Node_Ptr parent,
+		Link_type						aux_copy(Const_Link_type target, Node_Ptr parent,
 										NodeGen&) throw(std::bad_alloc);
 		template <typename NodeGen>
 		Link_type						aux_copy(const RedBlackTree& src, NodeGen& gen) throw(std::bad_alloc);
 		Link_type						aux_copy(const RedBlackTree& src) throw(std::bad_alloc);
 
 		/* Rebalancing handlers */
-		static void						aux_rotate_left(Node_Ptr const target, Node_Ptr& root) throw();
-		static void						aux_rotate_right(Node_Ptr const target, Node_Ptr& root) throw();
-		static void						aux_rebalance_tree(Node_Ptr& target, Node_Ptr const parent_child,
-										Node_Ptr const grand_parent_child, void (&rot1)(Node_Ptr const, Node_Ptr&),
-										void (&rot2)(Node_Ptr const, Node_Ptr&), RBT_Node_Base& header) throw();
+		/* The rotations update the augmentation data, with the key compare */
+		typedef void					(RedBlackTree::*Rotation)(Node_Ptr const, Node_Ptr&);
+
+		void							aux_rotate_left(Node_Ptr const target, Node_Ptr& root) throw();
+		void							aux_rotate_right(Node_Ptr const target, Node_Ptr& root) throw();
+		void							aux_rebalance_tree(Node_Ptr& target, Node_Ptr const parent_child,
+										Node_Ptr const grand_parent_child, Rotation rot1,
+										Rotation rot2, RBT_Node_Base& header) throw();
 		void 							aux_insert_and_rebalance(bool insert_left, Node_Ptr target,
 										Node_Ptr parent, RBT_Node_Base& header) throw();
-		static bool						aux_erase_rebalance(Node_Ptr& tmp, Node_Ptr& parent_tmp, bool is_right,
+		bool							aux_erase_rebalance(Node_Ptr& tmp, Node_Ptr& parent_tmp, bool is_right,
 										 Node_Ptr& root) throw();
 		Node_Ptr 						aux_rebalance_for_erase(Node_Ptr const target,
 										RBT_Node_Base& header) throw();
@@ -855,22 +1335,32 @@ namespace FT_NAMESPACE
 		::std::pair<Node_Ptr, Node_Ptr>	aux_insert_equal_pos(const key_type& k) throw();
 		::std::pair<Node_Ptr, Node_Ptr>	aux_insert_hint_unique_pos(const_iterator position, const key_type& k) throw();
 		::std::pair<Node_Ptr, Node_Ptr>	aux_insert_hint_equal_pos(const_iterator position, const key_type& k) throw();
-		template <typename NodeGen>
-		iterator						aux_insert_unique(const_iterator pos, const_reference value,
-										NodeGen&) throw(std::bad_alloc);
-		iterator						aux_insert_unique(const_iterator pos, const_reference value)
-										throw(std::bad_alloc);
-		template <typename NodeGen>
-		iterator						aux_insert_equal(const_iterator pos, const_reference value,
-										NodeGen&) throw(std::bad_alloc);
-		iterator						aux_insert_equal(const_iterator pos, const_reference value)
-										throw(std::bad_alloc);
-
-		template <typename NodeGen>
+		template <typename Arg, typename NodeGen>
+		iterator						aux_insert_unique(const_iterator pos, Arg&& value,
+										NodeGen&);
+		template <typename Arg, typename NodeGen>
+		iterator						aux_insert_equal(const_iterator pos, Arg&& value,
+										NodeGen&);
+
+		template <typename Arg, typename NodeGen>
 		iterator						aux_insert(Node_Ptr first, Node_Ptr last,
-										const_reference value, NodeGen&) throw(std::bad_alloc);
-		iterator						aux_insert_lower(Node_Ptr target, const_reference value) throw(std::bad_alloc);
-		iterator						aux_insert_equal_lower(const_reference value) throw(std::bad_alloc);
+										Arg&& value, NodeGen&);
+		iterator						aux_insert_node(Node_Ptr target, Node_Ptr parent, Link_type node) throw();
+		iterator						aux_insert_lower_node(Node_Ptr parent, Link_type node) throw();
+		iterator						aux_insert_equal_lower_node(Link_type node) throw();
+		template <typename Arg>
+		iterator						aux_insert_equal_lower(Arg&& value);
+
+		/* Sorted builders */
+		static bool						aux_is_multipass(const std::forward_iterator_tag*) throw();
+		static bool						aux_is_multipass(const forward_iterator_tag*) throw();
+		static bool						aux_is_multipass(const void*) throw();
+		template <typename InputIt>
+		Link_type						aux_build_balanced(InputIt& first, InputIt last, size_type n,
+										size_type depth, size_type red_depth, bool unique);
+		template <typename InputIt>
+		InputIt							aux_build_sorted(InputIt first, InputIt last, bool unique,
+										bool checked);
 
 		/* Erasers */
 		void							aux_erase(Link_type target) throw();
@@ -897,7 +1387,7 @@ namespace FT_NAMESPACE
 
 			Node_Alloc(RedBlackTree& t);
 			template <typename Arg>
-			Link_type	operator()(const Arg arg) throw(std::bad_alloc);
+			Link_type	operator()(Arg&& arg);
 		};
 
 		/* Member functions */
@@ -907,8 +1397,11 @@ namespace FT_NAMESPACE
 		RedBlackTree();
 		RedBlackTree(const Compare& cmp, const allocator_type& alloc = allocator_type());
 		RedBlackTree(const RedBlackTree& other);
+		RedBlackTree(RedBlackTree&& other);
 		~RedBlackTree();
 		RedBlackTree&					operator=(const RedBlackTree& other);
+		RedBlackTree&					operator=(RedBlackTree&& other);
+		allocator_type					get_allocator() const;
 
 		/* Iterators */
 		iterator						begin();
@@ -926,13 +1419,33 @@ namespace FT_NAMESPACE
 		size_type						max_size() const;
 
 		/* Modifiers */
-		::std::pair<iterator, bool>		aux_insert_unique(const_reference value) throw(std::bad_alloc);
-		iterator						aux_insert_equal(const_reference value) throw(std::bad_alloc);
+		template <typename Arg>
+		::std::pair<iterator, bool>		aux_insert_unique(Arg&& value);
+		template <typename Arg>
+		iterator						aux_insert_equal(Arg&& value);
+		template <typename Arg>
+		iterator						aux_insert_unique(const_iterator pos, Arg&& value);
+		template <typename Arg>
+		iterator						aux_insert_equal(const_iterator pos, Arg&& value);
+		template <typename... Args>
+		::std::pair<iterator, bool>		aux_emplace_unique(Args&&... args);
+		template <typename... Args>
+		iterator						aux_emplace_equal(Args&&... args);
+		template <typename... Args>
+		iterator						aux_emplace_hint_unique(const_iterator pos, Args&&... args);
+		template <typename... Args>
+		iterator						aux_emplace_hint_equal(const_iterator pos, Args&&... args);
 		// CHECK THIS NEED 3 args no 2
 		template <typename InputIt>
 		void							aux_insert_range_unique(InputIt first, InputIt last) throw(std::bad_alloc);
 		template <typename InputIt>
 		void							aux_insert_range_equal(InputIt first, InputIt last) throw(std::bad_alloc);
+		template <typename InputIt>
+		void							aux_insert_range_unique(sorted_unique_t, InputIt first, InputIt last)
+										throw(std::bad_alloc);
+		template <typename InputIt>
+		void							aux_insert_range_equal(sorted_equivalent_t, InputIt first, InputIt last)
+										throw(std::bad_alloc);
 		void							clear();
 		void							erase(iterator pos);
 		void							erase(const_iterator pos);
@@ -952,143 +1465,144 @@ namespace FT_NAMESPACE
 		iterator						upper_bound(const key_type& k);
 		const_iterator					upper_bound(const key_type& k) const;
 
+		/* Order statistics */
+		iterator						nth(size_type k);
+		const_iterator					nth(size_type k) const;
+		size_type						rank(const key_type& k) const;
+
 		/* Observers */
 		Compare							key_comp() const;
 		// TO DO: value_comp
-
-		/* Non members */
-		friend bool	operator==(const RedBlackTree&, const RedBlackTree&);
-		friend bool	operator<(const RedBlackTree&, const RedBlackTree&);
 	};
 
 	///////////////////////////////////////////
 	// Fast type / readable basic operations //
 	///////////////////////////////////////////
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Node_Ptr&
-	RedBlackTree<K, V, KV, C, A>::get_root()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr&
+	RedBlackTree<K, V, KV, C, A, U>::get_root()
 	throw()
 	{ return (header.parent); }
 		
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Node_Ptr&
-	RedBlackTree<K, V, KV, C, A>::get_root() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::get_root() const
 	throw()
 	{ return (header.parent); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Node_Ptr&
-	RedBlackTree<K, V, KV, C, A>::get_leftmost()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr&
+	RedBlackTree<K, V, KV, C, A, U>::get_leftmost()
 	throw()
 	{ return (header.left); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Node_Ptr&
-	RedBlackTree<K, V, KV, C, A>::get_leftmost() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::get_leftmost() const
 	throw()
 	{ return (header.left); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Node_Ptr&
-	RedBlackTree<K, V, KV, C, A>::get_rightmost()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr&
+	RedBlackTree<K, V, KV, C, A, U>::get_rightmost()
 	throw()
 	{ return (header.right); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Node_Ptr&
-	RedBlackTree<K, V, KV, C, A>::get_rightmost() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::get_rightmost() const
 	throw()
 	{ return (header.right); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::get_begin()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::get_begin()
 	throw()
 	{ return (static_cast<Link_type>(header.parent)); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Link_type
-	RedBlackTree<K, V, KV, C, A>::get_begin() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Link_type
+	RedBlackTree<K, V, KV, C, A, U>::get_begin() const
 	throw()
 	{ return (static_cast<Const_Link_type>(header.parent)); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Node_Ptr
-	RedBlackTree<K, V, KV, C, A>::get_end()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::get_end()
 	throw()
 	{ return (&header); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Node_Ptr
-	RedBlackTree<K, V, KV, C, A>::get_end() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::get_end() const
 	throw()
 	{ return (const_cast<Const_Node_Ptr>(&header)); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline const typename RedBlackTree<K, V, KV, C, A>::key_type&
-	RedBlackTree<K, V, KV, C, A>::sget_key(Const_Link_type target)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline const typename RedBlackTree<K, V, KV, C, A, U>::key_type&
+	RedBlackTree<K, V, KV, C, A, U>::sget_key(Const_Link_type target)
 	throw()
 	{ return (KV()(*target->Node_get_value_ptr())); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline const typename RedBlackTree<K, V, KV, C, A>::key_type&
-	RedBlackTree<K, V, KV, C, A>::sget_key(Const_Node_Ptr target)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline const typename RedBlackTree<K, V, KV, C, A, U>::key_type&
+	RedBlackTree<K, V, KV, C, A, U>::sget_key(Const_Node_Ptr target)
 	throw()
 	{ return (sget_key(static_cast<Const_Link_type>(target))); }
 
 	/// Node_Ptr to Link_type conversion
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::sget_left(Node_Ptr target)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::sget_left(Node_Ptr target)
 	throw()
 	{ return (static_cast<Link_type>(target->left)); }
 
 	/// Const_Node_Ptr to Const_Link_type conversion
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Link_type
-	RedBlackTree<K, V, KV, C, A>::sget_left(Const_Node_Ptr target) const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Link_type
+	RedBlackTree<K, V, KV, C, A, U>::sget_left(Const_Node_Ptr target) const
 	throw()
 	{ return (static_cast<Const_Link_type>(target->left)); }
 
 	/// Node_Ptr to Link_type conversion
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::sget_right(Node_Ptr target)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::sget_right(Node_Ptr target)
 	throw()
 	{ return (static_cast<Link_type>(target->right)); }
 
 	/// Const_Node_Ptr to Const_Link_type conversion
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Link_type
-	RedBlackTree<K, V, KV, C, A>::sget_right(Const_Node_Ptr target) const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Link_type
+	RedBlackTree<K, V, KV, C, A, U>::sget_right(Const_Node_Ptr target) const
 	throw()
 	{ return (static_cast<Const_Link_type>(target->right)); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Node_Ptr
-	RedBlackTree<K, V, KV, C, A>::sget_maximum(Node_Ptr target)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::sget_maximum(Node_Ptr target)
 	throw()
 	{ return (Node_maximum(target)); }
 
 /*
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Node_Ptr
-	RedBlackTree<K, V, KV, C, A>::sget_maximum(Const_Node_Ptr target)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::sget_maximum(Const_Node_Ptr target)
 	throw()
 	{ return (Node_maximum(target)); }
 */
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Node_Ptr
-	RedBlackTree<K, V, KV, C, A>::sget_minimum(Node_Ptr target)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::sget_minimum(Node_Ptr target)
 	throw()
 	{ return (Node_minimum(target)); }
 
 /*
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Const_Node_Ptr
-	RedBlackTree<K, V, KV, C, A>::sget_minimum(Const_Node_Ptr target)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Const_Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::sget_minimum(Const_Node_Ptr target)
 	throw()
 	{ return (Node_minimum(target)); }
 */
@@ -1097,38 +1611,58 @@ namespace FT_NAMESPACE
 	// Memory handlers //
 	/////////////////////
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::get_node()
+	/**
+	 * 	@brief get node
+	 * 
+	 * 	@return An uninitialised node, from the node pool if FT_RBTREE_NODE_POOL.
+	 * 	@throw std::bad_alloc
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::get_node()
 	throw(::std::bad_alloc)
-	// TO DO: Check this !
-	{ return (reinterpret_cast<Link_type>(memory.allocate(1ul))); }
-
+	{
+		if (FT_RBTREE_NODE_POOL)
+			return (pool.Pool_get(Node_allocator(memory)));
+		return (Node_allocator(memory).allocate(1ul));
+	}
 
-	template <class K, class V, class KV, class C, class A>
+	/**
+	 * 	@brief put node
+	 * 
+	 * 	@param p A node given by get_node.
+	 * 
+	 * 	Deallocates @p p (or gives it back to the node pool) without
+	 * 	destroying the data it holds.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::put_node(Link_type p)
+	RedBlackTree<K, V, KV, C, A, U>::put_node(Link_type p)
 	throw()
-	// TO DO: Check this
-	{ memory.deallocate(reinterpret_cast<pointer>(p)); }
+	{
+		if (FT_RBTREE_NODE_POOL)
+			pool.Pool_put(static_cast<Node_type*>(p));
+		else
+			Node_allocator(memory).deallocate(static_cast<Node_type*>(p), 1ul);
+	}
 
 	/**
 	 * 	@brief construct node
 	 * 
 	 * 	@param target A pointer to the node to construct.
-	 * 	@param value The data instance to construct.
-	 * 	@throw std::bad_alloc
+	 * 	@param args The arguments forwarded to the value_type constructor.
 	 * 
 	 * 	Fast type + exeption tryer node constructor.
+	 * 	NOTE: If the constructor throws @p target is deallocated.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename... Args>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::construct_node(Link_type target, const_reference value)
-	throw(::std::bad_alloc)
+	RedBlackTree<K, V, KV, C, A, U>::construct_node(Link_type target, Args&&... args)
 	{
 		try {
-			memory.construct(target->Node_get_value_ptr(), value);
-		} catch (std::bad_alloc&) {
+			memory.construct(target->Node_get_value_ptr(), std::forward<Args>(args)...);
+		} catch (...) {
 			put_node(target);
 			throw;
 		}
@@ -1137,18 +1671,18 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief create node
 	 * 
-	 * 	@param value The data instance to construct.
+	 * 	@param args The arguments forwarded to the value_type constructor.
 	 * 	@throw std::bad_alloc
 	 * 
-	 *	@return A pointer to a node holding an constructed instance of @p value.
+	 *	@return A pointer to a node holding a value constructed in place.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::create_node(const_reference value)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename... Args>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::create_node(Args&&... args)
 	{
 		Link_type	new_node = get_node();
-		construct_node(new_node, value);
+		construct_node(new_node, std::forward<Args>(args)...);
 		return (new_node);
 	}
 
@@ -1157,9 +1691,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@param p A pointer to the node where is the data to destroy.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::destroy_node(Link_type p)
+	RedBlackTree<K, V, KV, C, A, U>::destroy_node(Link_type p)
 	throw()
 	{ memory.destroy(p->Node_get_value_ptr()); }
 
@@ -1170,9 +1704,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Destroys the data holded and deallocate the node.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::drop_node(Link_type p)
+	RedBlackTree<K, V, KV, C, A, U>::drop_node(Link_type p)
 	throw()
 	{
 		destroy_node(p);
@@ -1188,16 +1722,18 @@ namespace FT_NAMESPACE
 	 * 	
 	 * 	@return A pointer to the cloned node.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	template <typename NodeGen>
-	inline typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::clone_node(Const_Link_type src, NodeGen& node_gen)
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::clone_node(Const_Link_type src, NodeGen& node_gen)
 	throw()
 	{
 		Link_type	cln = node_gen(*src->Node_get_value_ptr());
 		cln->color = src->color;
 		cln->left = 0;
 		cln->right = 0;
+		Node_set_size(cln, Node_size(src));
+		Node_type::Node_copy_augment(cln, src);
 		return (cln);
 	}
 
@@ -1216,10 +1752,10 @@ namespace FT_NAMESPACE
 	 *
 	 * 	NOTE: @p target and @p parent must be non-null.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	template <typename NodeGen>
-	typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::aux_copy(Link_type target, Node_Ptr parent, NodeGen& node_gen)
+	typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::aux_copy(Const_Link_type target, Node_Ptr parent, NodeGen& node_gen)
 	throw(::std::bad_alloc)
 	{
 		/* Copy the highter node and link to parent */
@@ -1268,10 +1804,10 @@ namespace FT_NAMESPACE
 	 * 	Copies @p src and return the root to the copy.
 	 * 	NOTE: update local members.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	template <typename NodeGen>
-	typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::aux_copy(const RedBlackTree& src, NodeGen& gen)
+	typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::aux_copy(const RedBlackTree& src, NodeGen& gen)
 	throw(::std::bad_alloc)
 	{
 		Link_type root = aux_copy(src.get_begin(), get_end(), gen);
@@ -1281,9 +1817,9 @@ namespace FT_NAMESPACE
 		return (root);
 	}
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::aux_copy(const RedBlackTree& src)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::aux_copy(const RedBlackTree& src)
 	throw(::std::bad_alloc)
 	{
 		Node_Alloc nd(*this);
@@ -1295,9 +1831,9 @@ namespace FT_NAMESPACE
 	/////////////////////////
 
 	/// Rotates the tree to the left
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	void
-	RedBlackTree<K, V, KV, C, A>::
+	RedBlackTree<K, V, KV, C, A, U>::
 	aux_rotate_left(Node_Ptr const target, Node_Ptr& root)
 	throw()
 	{
@@ -1322,19 +1858,25 @@ namespace FT_NAMESPACE
 
 		tmp->left = target;
 		target->parent = tmp;
+
+		/* tmp takes the place of target, target loses the right subtree of tmp */
+		Node_set_size(tmp, Node_size(target));
+		Node_update_size(target);
+		Node_type::Node_augment(target, key_compare);
+		Node_type::Node_augment(tmp, key_compare);
 	}
 
 	/// Rotates the tree to the right
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	void
-	RedBlackTree<K, V, KV, C, A>::
+	RedBlackTree<K, V, KV, C, A, U>::
 	aux_rotate_right(Node_Ptr const target, Node_Ptr& root)
 	throw()
 	{
 		Node_Ptr const tmp = target->left;
 
 		if ((target->left = tmp->right))
-			tmp->right = target;
+			tmp->right->parent = target;
 		tmp->parent = target->parent;
 		if (target == root)
 			root = tmp;
@@ -1343,17 +1885,21 @@ namespace FT_NAMESPACE
 		else
 			target->parent->left = tmp;
 		tmp->right = target;
-		target->parent = target;
+		target->parent = tmp;
+		Node_set_size(tmp, Node_size(target));
+		Node_update_size(target);
+		Node_type::Node_augment(target, key_compare);
+		Node_type::Node_augment(tmp, key_compare);
 	}
 
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	void
-	RedBlackTree<K, V, KV, C, A>::
+	RedBlackTree<K, V, KV, C, A, U>::
 	aux_rebalance_tree(Node_Ptr& target,
 	Node_Ptr const parent_child,
 	Node_Ptr const grand_parent_child,
-	void (&rot1)(Node_Ptr const, Node_Ptr&),
-	void (&rot2)(Node_Ptr const, Node_Ptr&),
+	Rotation rot1,
+	Rotation rot2,
 	RBT_Node_Base& header)
 	throw()
 	{
@@ -1372,17 +1918,17 @@ namespace FT_NAMESPACE
 			if (target == parent_child)
 			{
 				target = target->parent;
-				rot1(target, root);
+				(this->*rot1)(target, root);
 			}
 			target->parent->color = RBT_Black;
 			grand_parent->color = RBT_Red;
-			rot2(grand_parent, root);
+			(this->*rot2)(grand_parent, root);
 		}
 	}
 
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	void
-	RedBlackTree<K, V, KV, C, A>::aux_insert_and_rebalance(bool insert_left,
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_and_rebalance(bool insert_left,
 	Node_Ptr target, Node_Ptr parent, RBT_Node_Base& header)
 	throw()
 	{
@@ -1391,6 +1937,7 @@ namespace FT_NAMESPACE
 		target->left = 0;
 		target->right = 0;
 		target->color = RBT_Red;
+		Node_set_size(target, 1);
 
 		/* 	First, proceed to insert, the new node will be child of the parent.
 			Root's leftmost and rightmost nodes are maintained.
@@ -1416,6 +1963,11 @@ namespace FT_NAMESPACE
 				header.right = target;
 		}
 
+		/* The parents subtrees grow by one (the rotations keep them right) */
+		Node_add_size(parent, &header, 1);
+		Node_type::Node_augment(target, key_compare);
+		Node_type::Node_augment_path(parent, &header, key_compare);
+
 		/* Then, rebalance the tree */
 		while (target != get_root() && target->parent->color == RBT_Red)
 		{
@@ -1423,67 +1975,81 @@ namespace FT_NAMESPACE
 		
 			if (target->parent == grand_parent->left)
 				aux_rebalance_tree(target, target->parent->right, grand_parent->right,
-				aux_rotate_left, aux_rotate_right, header);
+				&RedBlackTree::aux_rotate_left, &RedBlackTree::aux_rotate_right, header);
 			else
 				aux_rebalance_tree(target, target->parent->left, grand_parent->left,
-				aux_rotate_right, aux_rotate_left, header);
+				&RedBlackTree::aux_rotate_right, &RedBlackTree::aux_rotate_left, header);
 		}
 		get_root()->color = RBT_Black;
 	}
 
-	template <class K, class V, class KV, class C, class A>
+	/**
+	 * 	@brief erase rebalance
+	 * 
+	 * 	@param tmp The node with an extra black (can be null).
+	 * 	@param parent_tmp The parent of @p tmp.
+	 * 	@param is_right True if @p tmp is the right child of @p parent_tmp.
+	 * 	@param root The root of the tree.
+	 * 
+	 * 	@return True if the tree is balanced, else @p tmp and @p parent_tmp
+	 * 	go up one level.
+	 * 	NOTE: The right case is the left one with left and right swapped.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
 	bool
-	RedBlackTree<K, V, KV, C, A>::
+	RedBlackTree<K, V, KV, C, A, U>::
 	aux_erase_rebalance(Node_Ptr& tmp, Node_Ptr& parent_tmp, bool is_right, Node_Ptr& root)
 	throw()
 	{
-		Node_Ptr brother =
-		is_right ? parent_tmp->left : parent_tmp->right;
+		Node_Ptr RBT_Node_Base::* const near = is_right ? &RBT_Node_Base::right : &RBT_Node_Base::left;
+		Node_Ptr RBT_Node_Base::* const far = is_right ? &RBT_Node_Base::left : &RBT_Node_Base::right;
+		Node_Ptr brother = parent_tmp->*far;
 
-		static void (*const rot[])(Node_Ptr const, Node_Ptr&) {
-			&aux_rotate_left,
-			&aux_rotate_right
+		static const Rotation rot[] = {
+			&RedBlackTree::aux_rotate_left,
+			&RedBlackTree::aux_rotate_right
 		};
 
+		/* Red brother: rotate to get a black one */
 		if (brother->color == RBT_Red)
 		{
 			brother->color = RBT_Black;
 			parent_tmp->color = RBT_Red;
-			rot[is_right](parent_tmp, root);
-			brother = is_right ? parent_tmp->right : parent_tmp->left;
+			(this->*rot[is_right])(parent_tmp, root);
+			brother = parent_tmp->*far;
 		}
 
-		if ((!is_right && (brother->left == 0 || brother->left->color == RBT_Black)
-			&& (brother->right == 0 || brother->right->color == RBT_Black))
-			|| ((is_right && (brother->right == 0 || brother->right->color == RBT_Black)
-			&& (brother->left == 0 || brother->right->color == RBT_Black))))
+		/* Black nephews: move the extra black up */
+		if ((brother->*near == 0 || (brother->*near)->color == RBT_Black)
+			&& (brother->*far == 0 || (brother->*far)->color == RBT_Black))
 		{
 			brother->color = RBT_Red;
 			tmp = parent_tmp;
 			parent_tmp = parent_tmp->parent;
+			return (false);
 		}
-		else
+
+		/* Black far nephew: rotate the brother to get a red one */
+		if (brother->*far == 0 || (brother->*far)->color == RBT_Black)
 		{
-			if (brother->right == 0 || brother->right->color == RBT_Black)
-			{
-				brother->left->color = RBT_Black;
-				brother->color = RBT_Red;
-				rot[!is_right](brother, root);
-				brother = parent_tmp->right;
-			}
-			brother->color = parent_tmp->color;
-			parent_tmp->color = RBT_Black;
-			if ((is_right && brother->left) || (!is_right && brother->right))
-				!is_right ? brother->right->color : brother->left->color = RBT_Black;
-			rot[is_right](parent_tmp, root);
-			return (true);
+			(brother->*near)->color = RBT_Black;
+			brother->color = RBT_Red;
+			(this->*rot[!is_right])(brother, root);
+			brother = parent_tmp->*far;
 		}
-		return (false);
+
+		/* Red far nephew: the last rotation removes the extra black */
+		brother->color = parent_tmp->color;
+		parent_tmp->color = RBT_Black;
+		if (brother->*far)
+			(brother->*far)->color = RBT_Black;
+		(this->*rot[is_right])(parent_tmp, root);
+		return (true);
 	}
 
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::Node_Ptr
-	RedBlackTree<K, V, KV, C, A>::
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr
+	RedBlackTree<K, V, KV, C, A, U>::
 	aux_rebalance_for_erase(Node_Ptr const target, RBT_Node_Base& header)
 	throw()
 	{
@@ -1510,6 +2076,9 @@ namespace FT_NAMESPACE
 			}
 		}
 
+		/* The parents of the unlinked node (successor, else target) lose one */
+		Node_add_size(successor->parent, &header, -1);
+
 		/* target has no null children */
 		if (successor != target)
 		{
@@ -1536,6 +2105,8 @@ namespace FT_NAMESPACE
 				target->parent->left = successor;
 			else
 				target->parent->right = successor;
+			successor->parent = target->parent;
+			Node_set_size(successor, Node_size(target));
 			std::swap(successor->color, target->color);
 			successor = target; // NOTE: successor point to the node to be deleted now
 		}
@@ -1574,19 +2145,17 @@ namespace FT_NAMESPACE
 			}
 		}
 
+		/* The subtrees changed from the parent of the unlinked node */
+		Node_type::Node_augment_path(tmp_parent, &header, key_compare);
+
 		/* Rebalance */
 		if (successor->color == RBT_Black)
 		{
 			while (tmp != get_root() && (!tmp || tmp->color == RBT_Black))
-			{
-				if (tmp == tmp_parent->left && aux_erase_rebalance(tmp, tmp_parent, false, get_root()))
+				if (aux_erase_rebalance(tmp, tmp_parent, tmp != tmp_parent->left, get_root()))
 					break ;
-				else if (aux_erase_rebalance(tmp, tmp_parent, true, get_root()))
-					break ;
-
-				if (tmp)
-					tmp->color = RBT_Black;
-			}
+			if (tmp)
+				tmp->color = RBT_Black;
 		}
 		return (successor);
 	}
@@ -1598,12 +2167,13 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief aux insert unique pos.
 	 * 
-	 * 	@return A pair of Node_ptr pointing to the maching subsequence
-	 * 	 with @p k, a key.
+	 * 	@return The insertion position of @p k: (target, parent) where the
+	 * 	new node is linked under parent, on its left if target isn't NULL.
+	 * 	If @p k already exists (node, NULL).
 	*/
-	template <class K, class V, class KV, class C, class A>
-	::std::pair<typename RedBlackTree<K, V, KV, C, A>::Node_Ptr, typename RedBlackTree<K, V, KV, C, A>::Node_Ptr>
-	RedBlackTree<K, V, KV, C, A>::aux_insert_unique_pos(const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	::std::pair<typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr, typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr>
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_unique_pos(const key_type& k)
 	throw()
 	{
 		Link_type x = get_begin();
@@ -1627,14 +2197,14 @@ namespace FT_NAMESPACE
 		{
 			/* If is the first one return else decrement */
 			if (i == begin())
-				return (std::pair<Node_Ptr, Node_Ptr>(0, y));
+				return (std::pair<Node_Ptr, Node_Ptr>(y, y));
 			else
 				i--;
 		}
 
 		/* If reverse conparison no match return */
 		if (key_compare(sget_key(i.node), k))
-			return (std::pair<Node_Ptr, Node_Ptr>(0, y));
+			return (std::pair<Node_Ptr, Node_Ptr>(cmp ? y : 0, y));
 
 		/* If macthes */
 		return (std::pair<Node_Ptr, Node_Ptr>(i.node, 0));
@@ -1643,39 +2213,44 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief aux insert equal pos.
 	 * 
-	 * 	@return A pair of Node_ptr pointing to the maching subsequence
-	 * 	 with @p k, a key.
+	 * 	@return The insertion position of @p k, after its equal keys:
+	 * 	(target, parent) where the new node is linked under parent, on its
+	 * 	left if target isn't NULL.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	::std::pair<typename RedBlackTree<K, V, KV, C, A>::Node_Ptr, typename RedBlackTree<K, V, KV, C, A>::Node_Ptr>
-	RedBlackTree<K, V, KV, C, A>::aux_insert_equal_pos(const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	::std::pair<typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr, typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr>
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_equal_pos(const key_type& k)
 	throw()
 	{
 		Link_type x = get_begin();
 		Node_Ptr y = get_end();
+		bool cmp = true;
 
 		/* Search for the lower maching node and store it on y */
 		while (x)
 		{
 			y = x;
-			// TO DO: Check this function
-			if (key_compare(k, sget_key(x)))
+			if ((cmp = key_compare(k, sget_key(x))))
 				x = sget_left(x);
 			else
 				x = sget_right(x);
 		}
-		return (std::pair<Node_Ptr, Node_Ptr>(0, y));
+		return (std::pair<Node_Ptr, Node_Ptr>(cmp ? y : 0, y));
 	}
 
 	/**
 	 * 	@brief aux insert hint unique pos
 	 * 
-	 * 	@return A pair of Node_Ptr pointnig to position to insert.
-	 * 	NOTE: Uses @p pos and @p k to find the index to the insertion.
+	 * 	@return The insertion position of @p k, as aux_insert_unique_pos.
+	 * 
+	 * 	If @p k goes just before @p position or just after it (the key of
+	 * 	@p position and of one neighbor are compared) the position is found
+	 * 	without any descent: amortized O(1), a single comparison at end().
+	 * 	Else falls back to aux_insert_unique_pos.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	::std::pair<typename RedBlackTree<K, V, KV, C, A>::Node_Ptr, typename RedBlackTree<K, V, KV, C, A>::Node_Ptr>
-	RedBlackTree<K, V, KV, C, A>::aux_insert_hint_unique_pos(const_iterator position, const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	::std::pair<typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr, typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr>
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_hint_unique_pos(const_iterator position, const key_type& k)
 	throw()
 	{
 		iterator pos = position.it_const_cast();
@@ -1702,7 +2277,7 @@ namespace FT_NAMESPACE
 				return (std::pair<Node_Ptr, Node_Ptr>(get_leftmost(), get_leftmost()));
 
 			/* Else try comparison with the predecend node (if false) */
-			else if (key_compare(sget_key(--before.node), k))
+			else if (key_compare(sget_key((--before).node), k))
 				return (sget_right(before.node) ? std::pair<Node_Ptr, Node_Ptr>(pos.node, pos.node)
 					: std::pair<Node_Ptr, Node_Ptr>(0, before.node));
 
@@ -1720,7 +2295,7 @@ namespace FT_NAMESPACE
 				return (std::pair<Node_Ptr, Node_Ptr>(0, get_rightmost()));
 
 			/* Else try comparison with the next node (if false) */
-			else if (key_compare(k, sget_key(++after.node)))
+			else if (key_compare(k, sget_key((++after).node)))
 				return (sget_right(pos.node) ? std::pair<Node_Ptr, Node_Ptr>(after.node, after.node)
 					: std::pair<Node_Ptr, Node_Ptr>(0, pos.node));
 
@@ -1735,12 +2310,16 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief aux insert hint equal pos
 	 * 
-	 * 	@return A pair of Node_Ptr pointnig to position to insert.
-	 * 	NOTE: Uses @p pos and @p k to find the index to the insertion.
+	 * 	@return The insertion position of @p k, as aux_insert_equal_pos.
+	 * 
+	 * 	As aux_insert_hint_unique_pos but equal keys are accepted next to
+	 * 	@p position. If @p k is after the next node of @p position returns
+	 * 	(NULL, NULL): the caller inserts it before its equal keys with
+	 * 	aux_insert_equal_lower.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	::std::pair<typename RedBlackTree<K, V, KV, C, A>::Node_Ptr, typename RedBlackTree<K, V, KV, C, A>::Node_Ptr>
-	RedBlackTree<K, V, KV, C, A>::aux_insert_hint_equal_pos(const_iterator position, const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	::std::pair<typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr, typename RedBlackTree<K, V, KV, C, A, U>::Node_Ptr>
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_hint_equal_pos(const_iterator position, const key_type& k)
 	throw()
 	{
 		iterator pos = position.it_const_cast();
@@ -1765,7 +2344,7 @@ namespace FT_NAMESPACE
 				return (std::pair<Node_Ptr, Node_Ptr>(get_leftmost(), get_leftmost()));
 
 			/* Else try comparison with the predecend node (if false) */
-			else if (!key_compare(k, sget_key(--before.node)))
+			else if (!key_compare(k, sget_key((--before).node)))
 				return (sget_right(before.node) ? std::pair<Node_Ptr, Node_Ptr>(pos.node, pos.node)
 					: std::pair<Node_Ptr, Node_Ptr>(0, before.node));
 
@@ -1783,8 +2362,8 @@ namespace FT_NAMESPACE
 				return (std::pair<Node_Ptr, Node_Ptr>(0, get_rightmost()));
 
 			/* Else try comparison with the next node (if false) */
-			else if (!key_compare(sget_key(++after.node), k))
-				return (sget_right(after.node) ? std::pair<Node_Ptr, Node_Ptr>(after.node, after.node)
+			else if (!key_compare(sget_key((++after).node), k))
+				return (sget_right(pos.node) ? std::pair<Node_Ptr, Node_Ptr>(after.node, after.node)
 					: std::pair<Node_Ptr, Node_Ptr>(0, pos.node));
 
 			return (std::pair<Node_Ptr, Node_Ptr>(0, 0));
@@ -1800,10 +2379,10 @@ namespace FT_NAMESPACE
 	 * 	NOTE: @p value is unique in the %RBT else the insertion
 	 * 	is not performed. 
 	*/
-	template <class K, class V, class KV, class C, class A>
-	::std::pair<typename RedBlackTree<K, V, KV, C, A>::iterator, bool>
-	RedBlackTree<K, V, KV, C, A>::aux_insert_unique(const_reference value)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename Arg>
+	::std::pair<typename RedBlackTree<K, V, KV, C, A, U>::iterator, bool>
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_unique(Arg&& value)
 	{
 		/* Get the position to insert */
 		std::pair<Node_Ptr, Node_Ptr> pos = aux_insert_unique_pos(KV()(value));
@@ -1813,7 +2392,7 @@ namespace FT_NAMESPACE
 		{
 			/* Insert the data */
 			Node_Alloc nd(*this);
-			return (std::pair<iterator, bool>(aux_insert(pos.first, pos.second, value, nd), true));
+			return (std::pair<iterator, bool>(aux_insert(pos.first, pos.second, std::forward<Arg>(value), nd), true));
 		}
 
 		/* Else if value already exist */
@@ -1827,17 +2406,17 @@ namespace FT_NAMESPACE
 	 *
 	 * 	Perfom an insertion of @p value on the %RBT. 
 	*/
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_insert_equal(const_reference value)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename Arg>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_equal(Arg&& value)
 	{
 		/* Get the position to insert */
 		std::pair<Node_Ptr, Node_Ptr> pos = aux_insert_equal_pos(KV()(value));
 
 		/* Insert the data */
 		Node_Alloc nd(*this);
-		return (aux_insert(pos.first, pos.second, value, nd));
+		return (aux_insert(pos.first, pos.second, std::forward<Arg>(value), nd));
 	}
 
 	/**
@@ -1850,80 +2429,217 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Performs an insertion if @p value at @p pos using @p @node_gen.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	template <typename NodeGen>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_insert_unique(const_iterator p, const_reference value, NodeGen& node_gen)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename Arg, typename NodeGen>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_unique(const_iterator p, Arg&& value, NodeGen& node_gen)
 	{
 		/* Get the index of the insertion */
 		std::pair<Node_Ptr, Node_Ptr> pos = aux_insert_hint_unique_pos(p, KV()(value));
 
 		/* If the value is unique proceed to the insertion */
 		if (pos.second)
-			return (aux_insert(pos.first, pos.second, value, node_gen));
+			return (aux_insert(pos.first, pos.second, std::forward<Arg>(value), node_gen));
 
 		/* Else if the value already exist */
 		return (iterator(pos.first));
 	}
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_insert_unique(const_iterator pos, const_reference value)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename Arg>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_unique(const_iterator pos, Arg&& value)
 	{
 		Node_Alloc	nd(*this);
-		return (aux_insert_unique(pos, value, nd));
+		return (aux_insert_unique(pos, std::forward<Arg>(value), nd));
 	}
 
-	template <class K, class V, class KV, class C, class A>
-	template <typename NodeGen>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_insert_equal(const_iterator p, const_reference value, NodeGen& node_gen)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename Arg, typename NodeGen>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_equal(const_iterator p, Arg&& value, NodeGen& node_gen)
 	{
 		/* Get the index of the insertion */
 		std::pair<Node_Ptr, Node_Ptr> pos = aux_insert_hint_equal_pos(p, KV()(value));
 
 		/* Check for no match and then proced to insert */
 		if (pos.second)
-			return (aux_insert(pos.first, pos.second, value, node_gen));
+			return (aux_insert(pos.first, pos.second, std::forward<Arg>(value), node_gen));
 
 		/* If match */
-		return (aux_insert_equal_lower(value));
+		return (aux_insert_equal_lower(std::forward<Arg>(value)));
 	}
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_insert_equal(const_iterator pos, const_reference value)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename Arg>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_equal(const_iterator pos, Arg&& value)
 	{
 		Node_Alloc	nd(*this);
-		return (aux_insert_equal(pos, value, nd));
+		return (aux_insert_equal(pos, std::forward<Arg>(value), nd));
+	}
+
+	/**
+	 * 	@brief emplace unique
+	 * 
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return A pair of an iterator to the element with the same key and
+	 * 	true if the insertion was performed.
+	 * 
+	 * 	The node is built first to get its key, it is dropped if the key
+	 * 	already exist.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename... Args>
+	::std::pair<typename RedBlackTree<K, V, KV, C, A, U>::iterator, bool>
+	RedBlackTree<K, V, KV, C, A, U>::aux_emplace_unique(Args&&... args)
+	{
+		Link_type nd = create_node(std::forward<Args>(args)...);
+		std::pair<Node_Ptr, Node_Ptr> pos = aux_insert_unique_pos(sget_key(nd));
+
+		if (pos.second)
+			return (std::pair<iterator, bool>(aux_insert_node(pos.first, pos.second, nd), true));
+		drop_node(nd);
+		return (std::pair<iterator, bool>(iterator(pos.first), false));
+	}
+
+	/**
+	 * 	@brief emplace equal
+	 * 
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the emplaced data.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename... Args>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_emplace_equal(Args&&... args)
+	{
+		Link_type nd = create_node(std::forward<Args>(args)...);
+		std::pair<Node_Ptr, Node_Ptr> pos = aux_insert_equal_pos(sget_key(nd));
+
+		return (aux_insert_node(pos.first, pos.second, nd));
+	}
+
+	/**
+	 * 	@brief emplace hint unique
+	 * 
+	 * 	@param p A hint of the insertion position.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the element with the same key.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename... Args>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_emplace_hint_unique(const_iterator p, Args&&... args)
+	{
+		Link_type nd = create_node(std::forward<Args>(args)...);
+		std::pair<Node_Ptr, Node_Ptr> pos = aux_insert_hint_unique_pos(p, sget_key(nd));
+
+		if (pos.second)
+			return (aux_insert_node(pos.first, pos.second, nd));
+		drop_node(nd);
+		return (iterator(pos.first));
+	}
+
+	/**
+	 * 	@brief emplace hint equal
+	 * 
+	 * 	@param p A hint of the insertion position.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the emplaced data.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename... Args>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_emplace_hint_equal(const_iterator p, Args&&... args)
+	{
+		Link_type nd = create_node(std::forward<Args>(args)...);
+		std::pair<Node_Ptr, Node_Ptr> pos = aux_insert_hint_equal_pos(p, sget_key(nd));
+
+		if (pos.second)
+			return (aux_insert_node(pos.first, pos.second, nd));
+		return (aux_insert_equal_lower_node(nd));
 	}
 
-	template <class K, class V, class KV, class C, class A>
+	/**
+	 * 	@brief insert range unique
+	 * 
+	 * 	@param first An input iterator.
+	 * 	@param last An input iterator.
+	 * 
+	 * 	If the %RBT is empty the sorted prefix of the range is built in
+	 * 	linear time (equal keys skipped), the rest is inserted one by one.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
 	template <typename InputIt>
-	inline void
-	RedBlackTree<K, V, KV, C, A>::aux_insert_range_unique(InputIt first, InputIt last)
+	void
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_range_unique(InputIt first, InputIt last)
 	throw(::std::bad_alloc)
 	{
 		Node_Alloc nd(*this);
+
+		if (empty())
+			first = aux_build_sorted(first, last, true, true);
 		for (; first != last ; first++)
 			aux_insert_unique(end(), *first, nd);
 	}
 
-	template <class K, class V, class KV, class C, class A>
+	/**
+	 * 	@brief insert range equal
+	 * 
+	 * 	@param first An input iterator.
+	 * 	@param last An input iterator.
+	 * 
+	 * 	If the %RBT is empty the sorted prefix of the range is built in
+	 * 	linear time, the rest is inserted one by one.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
 	template <typename InputIt>
-	inline void
-	RedBlackTree<K, V, KV, C, A>::aux_insert_range_equal(InputIt first, InputIt last)
+	void
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_range_equal(InputIt first, InputIt last)
 	throw(::std::bad_alloc)
 	{
 		Node_Alloc nd(*this);
+
+		if (empty())
+			first = aux_build_sorted(first, last, false, true);
 		for (; first != last ; first++)
 			aux_insert_equal(end(), *first, nd);
 	}
 
+	//@{
+	/**
+	 * 	@brief insert sorted range
+	 * 
+	 * 	@param first An input iterator.
+	 * 	@param last An input iterator.
+	 * 
+	 * 	The range is trusted to be sorted (see %sorted_unique), an empty %RBT
+	 * 	is built without any comparison.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename InputIt>
+	inline void
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_range_unique(sorted_unique_t, InputIt first, InputIt last)
+	throw(::std::bad_alloc)
+	{
+		if (empty())
+			first = aux_build_sorted(first, last, true, false);
+		aux_insert_range_unique(first, last);
+	}
+
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename InputIt>
+	inline void
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_range_equal(sorted_equivalent_t, InputIt first, InputIt last)
+	throw(::std::bad_alloc)
+	{
+		if (empty())
+			first = aux_build_sorted(first, last, false, false);
+		aux_insert_range_equal(first, last);
+	}
+	//@}
+
 	/**
 	 * 	@brief aux insert
 	 * 
@@ -1937,61 +2653,81 @@ namespace FT_NAMESPACE
 	 * Insert copies of @p value in range @p first - @p last,
 	 * 	using NodeGen as function to allocates nodes.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	template <typename NodeGen>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_insert(Node_Ptr target, Node_Ptr parent, const_reference value, NodeGen& node_gen)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename Arg, typename NodeGen>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert(Node_Ptr target, Node_Ptr parent, Arg&& value, NodeGen& node_gen)
 	{
-		/* Check if is a left insertion */
-		bool is_left_insertion = target || parent == get_end() || key_compare(KV()(value), sget_key(parent));
-
 		/* Allocate a new node */
-		Link_type nd = node_gen(value);
+		Link_type nd = node_gen(std::forward<Arg>(value));
+
+		/* Link it */
+		return (aux_insert_node(target, parent, nd));
+	}
+
+	/**
+	 * 	@brief aux insert node
+	 * 
+	 * 	@param target Not NULL for a left insertion.
+	 * 	@param parent The parent of the new node.
+	 * 	@param node A constructed node.
+	 * 
+	 * 	@return An iterator to @p node.
+	 * 
+	 * 	Links @p node under @p parent and rebalances the tree. The side is
+	 * 	given by the insert pos functions, no key is compared.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_node(Node_Ptr target, Node_Ptr parent, Link_type node)
+	throw()
+	{
+		/* Check if is a left insertion */
+		bool is_left_insertion = target || parent == get_end();
 
 		/* Insert the value and rebalance the branches if necesary */
-		aux_insert_and_rebalance(is_left_insertion, nd, parent, header);
+		aux_insert_and_rebalance(is_left_insertion, node, parent, header);
 
 		/* Increment the size counter */
 		tree_count++;
 
-		return (iterator(nd));
+		return (iterator(node));
 	}
 
 	/**
-	 * 	@brief  aux insert lower
+	 * 	@brief  aux insert lower node
 	 * 
-	 * 	TO DO target coukd be parent
+	 * 	@param parent The parent of the new node.
+	 * 	@param node A constructed node.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_insert_lower(Node_Ptr target, const_reference value)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_lower_node(Node_Ptr parent, Link_type node)
+	throw()
 	{
 		/* Check if is a left insertion */
-		bool is_left_insertion = target == get_end() || !key_compare(sget_key(target), KV()(value));
-
-		/* Allocate a new node */
-		Link_type nd = create_node(value);
+		bool is_left_insertion = parent == get_end() || !key_compare(sget_key(parent), sget_key(node));
 
 		/* Insert the value and rebalance the branches if necesary */
-		aux_insert_and_rebalance(is_left_insertion, nd, target, header);
+		aux_insert_and_rebalance(is_left_insertion, node, parent, header);
 
 		/* Increment the size counter */
 		tree_count++;
 
-		return (iterator(nd));
+		return (iterator(node));
 	}
 
 	/**
-	 * 	@brief Insert equal lower
+	 * 	@brief Insert equal lower node
 	 * 
-	 * 	TO DO
+	 * 	@param node A constructed node.
+	 * 
+	 * 	Inserts @p node before the elements with the same key.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_insert_equal_lower(const_reference value)
-	throw(::std::bad_alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_equal_lower_node(Link_type node)
+	throw()
 	{
 		/* Iterate from the root until a null node to find the
 			equal lower node target */
@@ -2003,12 +2739,159 @@ namespace FT_NAMESPACE
 		{
 			target = i;
 			/* Search the lower equal node */
-			if (!key_compare(sget_key(i), KV()(value)))
-				sget_left(i);
+			if (!key_compare(sget_key(i), sget_key(node)))
+				i = sget_left(i);
 			else
-				sget_right(i);
+				i = sget_right(i);
 		}
-		return (aux_insert_lower(target, value));
+		return (aux_insert_lower_node(target, node));
+	}
+
+	/**
+	 * 	@brief Insert equal lower
+	 * 
+	 * 	@param value The value to insert.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename Arg>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_insert_equal_lower(Arg&& value)
+	{ return (aux_insert_equal_lower_node(create_node(std::forward<Arg>(value)))); }
+
+	/////////////////////
+	// Sorted builders //
+	/////////////////////
+
+	//@{
+	/**
+	 * 	@brief aux is multipass
+	 * 
+	 * 	@return True if the iterator category (std or ft) is at least forward,
+	 * 	the range can then be read twice.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	inline bool
+	RedBlackTree<K, V, KV, C, A, U>::aux_is_multipass(const std::forward_iterator_tag*)
+	throw()
+	{ return (true); }
+
+	template <class K, class V, class KV, class C, class A, class U>
+	inline bool
+	RedBlackTree<K, V, KV, C, A, U>::aux_is_multipass(const forward_iterator_tag*)
+	throw()
+	{ return (true); }
+
+	template <class K, class V, class KV, class C, class A, class U>
+	inline bool
+	RedBlackTree<K, V, KV, C, A, U>::aux_is_multipass(const void*)
+	throw()
+	{ return (false); }
+	//@}
+
+	/**
+	 * 	@brief aux build balanced
+	 * 
+	 * 	@param first The first value, moved after the used values.
+	 * 	@param last The end of the range.
+	 * 	@param n The amount of nodes to create.
+	 * 	@param depth The depth of the built subtree root.
+	 * 	@param red_depth The depth of the incomplete last level.
+	 * 	@param unique If true the values equal to a used one are skipped.
+	 * 	@return The root of a subtree holding the @p n next values in order.
+	 * 
+	 * 	The nodes are created in order and linked at once. Both subtrees of a
+	 * 	node differ by one node at most: all the levels are full but the last
+	 * 	one. The full levels are black and the last one is red, every path has
+	 * 	the same amount of black nodes and no red node has children.
+	 * 	NOTE: If a node creation throws the nodes created by the call are dropped.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename InputIt>
+	typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::aux_build_balanced(InputIt& first, InputIt last, size_type n,
+	size_type depth, size_type red_depth, bool unique)
+	{
+		if (n == 0)
+			return (0);
+
+		const size_type	left_n = (n - 1) / 2;
+		Link_type		left = aux_build_balanced(first, last, left_n, depth + 1, red_depth, unique);
+		Link_type		root;
+
+		try {
+			root = create_node(*first);
+		} catch (...) {
+			aux_erase(left);
+			throw;
+		}
+		root->left = left;
+		root->right = 0;
+		root->color = depth < red_depth ? RBT_Black : RBT_Red;
+		if (left)
+			left->parent = root;
+		for (first++ ; unique && first != last && !key_compare(sget_key(root), KV()(*first)) ; first++)
+			;
+		try {
+			root->right = aux_build_balanced(first, last, n - 1 - left_n, depth + 1, red_depth, unique);
+		} catch (...) {
+			aux_erase(root);
+			throw;
+		}
+		if (root->right)
+			root->right->parent = root;
+		Node_update_size(root);
+		Node_type::Node_augment(root, key_compare);
+		return (root);
+	}
+
+	/**
+	 * 	@brief aux build sorted
+	 * 
+	 * 	@param first An input iterator.
+	 * 	@param last An input iterator.
+	 * 	@param unique If true the equal keys are skipped.
+	 * 	@param checked If false the range is trusted to be sorted.
+	 * 	@return The position after the values used to build the %RBT.
+	 * 
+	 * 	Builds the empty %RBT in linear time from the sorted prefix of a
+	 * 	multipass range: a first read counts the prefix (cheap, the range is
+	 * 	only read), then each node is created and linked in order.
+	 * 	A single pass range is left as is (@p first is returned), inserting
+	 * 	it at end() is already amortized O(1) per sorted value.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	template <typename InputIt>
+	InputIt
+	RedBlackTree<K, V, KV, C, A, U>::aux_build_sorted(InputIt first, InputIt last, bool unique,
+	bool checked)
+	{
+		typedef typename std::iterator_traits<InputIt>::iterator_category	category;
+
+		if (first == last || !aux_is_multipass(static_cast<category*>(0)))
+			return (first);
+
+		InputIt		stop = first;
+		size_type	n = 1;
+
+		for (InputIt prev = stop++ ; stop != last ; prev = stop++)
+		{
+			if (checked && key_compare(KV()(*stop), KV()(*prev)))
+				break ;
+			if (!(checked && unique) || key_compare(KV()(*prev), KV()(*stop)))
+				n++;
+		}
+
+		size_type	red_depth = 0;
+
+		/* The amount of full levels */
+		while ((size_type(2) << red_depth) - 1 <= n)
+			red_depth++;
+		get_root() = aux_build_balanced(first, stop, n, 0, red_depth, checked && unique);
+		get_root()->parent = get_end();
+		get_leftmost() = Node_minimum(get_root());
+		get_rightmost() = Node_maximum(get_root());
+		tree_count = n;
+		return (stop);
 	}
 
 	/////////////
@@ -2021,9 +2904,9 @@ namespace FT_NAMESPACE
 	 * 	Starting from @p target erases all the lower and equal nodes.
 	 * 	NOTE: Does not rebalance the tree.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	void
-	RedBlackTree<K, V, KV, C, A>::aux_erase(Link_type target)
+	RedBlackTree<K, V, KV, C, A, U>::aux_erase(Link_type target)
 	throw()
 	{
 		while (target)
@@ -2040,9 +2923,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Erase the data at @p pos and rebalance the tree.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	void
-	RedBlackTree<K, V, KV, C, A>::aux_erase(const_iterator pos)
+	RedBlackTree<K, V, KV, C, A, U>::aux_erase(const_iterator pos)
 	throw()
 	{
 		/* Unlink and rebalance */
@@ -2060,9 +2943,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Erase the data in range @p first - @p past.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	void
-	RedBlackTree<K, V, KV, C, A>::aux_erase(const_iterator first, const_iterator last)
+	RedBlackTree<K, V, KV, C, A, U>::aux_erase(const_iterator first, const_iterator last)
 	throw()
 	{
 		/* Check if no rebalance is needed */
@@ -2088,9 +2971,9 @@ namespace FT_NAMESPACE
 	 * 	@return An iterator of the last element of the maching subsequence
 	 * 	 with @p k.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_lower_bound(Link_type x, Node_Ptr y, const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_lower_bound(Link_type x, Node_Ptr y, const key_type& k)
 	throw()
 	{
 		while (x)
@@ -2118,31 +3001,12 @@ namespace FT_NAMESPACE
 	 * 	@return A const iterator of the last element of the maching subsequence
 	 * 	 with @p k.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::const_iterator
-	RedBlackTree<K, V, KV, C, A>::aux_lower_bound(Const_Link_type x, Const_Node_Ptr y, const key_type& k) const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_lower_bound(Const_Link_type x, Const_Node_Ptr y, const key_type& k) const
 	throw()
-	{
-		return (const_iterator(aux_lower_bound(const_cast<Link_type>(x), const_cast<Node_Ptr>(y), k)));
-		/*
-		while (x)
-		{
-			1) 
-			
-			if (!key_compare(sget_key(x), k))
-			{
-				y = x;
-				x = sget_left(x);
-			}
-			else
-				x = sget_right(x);
-		}
-		2) 
-		return (const_iterator(y));
-		*/
-		// 1) /* For each comparision update y */
-		// 2) /* Return a const iterator to the last maching comparision */
-	}
+	{ return (const_iterator(const_cast<RedBlackTree*>(this)->aux_lower_bound(const_cast<Link_type>(x),
+	const_cast<Node_Ptr>(y), k))); }
 
 	/**
 	 * 	@brief aux upper bound
@@ -2154,9 +3018,9 @@ namespace FT_NAMESPACE
 	 * 	@return An iterator of the first element of the maching subsequence
 	 * 	 with @p k.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::aux_upper_bound(Link_type x, Node_Ptr y, const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_upper_bound(Link_type x, Node_Ptr y, const key_type& k)
 	throw()
 	{
 		while (x)
@@ -2184,31 +3048,12 @@ namespace FT_NAMESPACE
 	 * 	@return A const iterator of the first element of the maching subsequence
 	 * 	 with @p k.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::const_iterator
-	RedBlackTree<K, V, KV, C, A>::aux_upper_bound(Const_Link_type x, Const_Node_Ptr y, const key_type& k) const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_iterator
+	RedBlackTree<K, V, KV, C, A, U>::aux_upper_bound(Const_Link_type x, Const_Node_Ptr y, const key_type& k) const
 	throw()
-	{
-		return (const_iterator(aux_upper_bound(static_cast<Link_type>(x), static_cast<Node_Ptr>(y), k)));
-
-/*
-		while (x)
-		{
-			1)
-			if (key_compare(k, sget_key(x)))
-			{
-				y = x;
-				x = sget_left(x);
-			}
-			else
-				x = sget_right(x);
-		}
-		2)
-		return (const_iterator(y));
-	*/
-	// 1)  /* For each false comparision update y */
-	// 2)  /* For each false comparision update y */
-	}
+	{ return (const_iterator(const_cast<RedBlackTree*>(this)->aux_upper_bound(const_cast<Link_type>(x),
+	const_cast<Node_Ptr>(y), k))); }
 
 	////////////////////
 	// Node allocator //
@@ -2219,8 +3064,8 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Init a Red Black tree.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	RedBlackTree<K, V, KV, C, A>::Node_Alloc::Node_Alloc(RedBlackTree& t)
+	template <class K, class V, class KV, class C, class A, class U>
+	RedBlackTree<K, V, KV, C, A, U>::Node_Alloc::Node_Alloc(RedBlackTree& t)
 	: rbtree(t)
 	{ }
 
@@ -2229,12 +3074,11 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Allocates a new node in the constructed tree
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	template <typename Arg>
-	typename RedBlackTree<K, V, KV, C, A>::Link_type
-	RedBlackTree<K, V, KV, C, A>::Node_Alloc::operator()(const Arg arg)
-	throw (::std::bad_alloc)
-	{ return (rbtree.create_node(arg)); }
+	typename RedBlackTree<K, V, KV, C, A, U>::Link_type
+	RedBlackTree<K, V, KV, C, A, U>::Node_Alloc::operator()(Arg&& arg)
+	{ return (rbtree.create_node(std::forward<Arg>(arg))); }
 
 
 	//////////////////////
@@ -2244,8 +3088,8 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief Default Constructor
 	*/
-	template <class K, class V, class KV, class C, class A>
-	RedBlackTree<K, V, KV, C, A>::RedBlackTree()
+	template <class K, class V, class KV, class C, class A, class U>
+	RedBlackTree<K, V, KV, C, A, U>::RedBlackTree()
 	{ }
 
 	/**
@@ -2254,9 +3098,9 @@ namespace FT_NAMESPACE
 	 * 	@param cmp A compare function
 	 * 	@param alloc An allocator.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	RedBlackTree<K, V, KV, C, A>::RedBlackTree(const C& cmp, const allocator_type& alloc)
-	: RBT_Base<V, C, A>(cmp, RBT_Node<V>(), alloc)
+	template <class K, class V, class KV, class C, class A, class U>
+	RedBlackTree<K, V, KV, C, A, U>::RedBlackTree(const C& cmp, const allocator_type& alloc)
+	: RBT_Base<V, C, A, Node_type>(cmp, RBT_Node<V>(), alloc)
 	// TO DO: Check this
 	{ }
 
@@ -2265,30 +3109,50 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@param other A RedBlackTree with the same type of @c *this.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	RedBlackTree<K, V, KV, C, A>::RedBlackTree(const RedBlackTree& other)
+	template <class K, class V, class KV, class C, class A, class U>
+	RedBlackTree<K, V, KV, C, A, U>::RedBlackTree(const RedBlackTree& other)
+	: RBT_Base<V, C, A, Node_type>(other)
 	{
-		// TO DO: Parent classes need to be init
 		if (other.get_root())
 			get_root() = aux_copy(other);
 	}
 
+	/**
+	 * 	@brief Move Contructor
+	 * 
+	 * 	@param other A RedBlackTree with the same type of @c *this, left empty.
+	 * 
+	 * 	Steals the nodes (and the node pool) of @p other, no node is allocated.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	RedBlackTree<K, V, KV, C, A, U>::RedBlackTree(RedBlackTree&& other)
+	: RBT_Base<V, C, A, Node_type>(other)
+	{
+		Header_move_data(other);
+		pool.Pool_move_data(other.pool);
+	}
+
 	/**
 	 * 	@brief Destructor
+	 * 
+	 * 	Drops the nodes and gives the node pool chunks back.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	RedBlackTree<K, V, KV, C, A>::~RedBlackTree()
-	{ aux_erase(get_begin()); }
+	template <class K, class V, class KV, class C, class A, class U>
+	RedBlackTree<K, V, KV, C, A, U>::~RedBlackTree()
+	{
+		aux_erase(get_begin());
+		pool.Pool_release(Node_allocator(memory));
+	}
 
-	template <class K, class V, class KV, class C, class A>
-	RedBlackTree<K, V, KV, C, A>&
-	RedBlackTree<K, V, KV, C, A>::operator=(const RedBlackTree& other)
+	template <class K, class V, class KV, class C, class A, class U>
+	RedBlackTree<K, V, KV, C, A, U>&
+	RedBlackTree<K, V, KV, C, A, U>::operator=(const RedBlackTree& other)
 	{
 		if (this != &other)
 		{
 			// Change by reuse or alloc
 			Node_Alloc nd(*this);
-			header.Header_reset();
+			clear();
 			key_compare = other.key_compare;
 			if (other.get_root())
 				get_root() = aux_copy(other, nd);
@@ -2296,6 +3160,40 @@ namespace FT_NAMESPACE
 		return (*this);
 	}
 
+	/**
+	 * 	@brief operator=
+	 * 
+	 * 	@param other A RedBlackTree with the same type of @c *this, left empty.
+	 * 
+	 * 	Drops the nodes of @c *this and steals the nodes (and the node pool)
+	 * 	of @p other.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	RedBlackTree<K, V, KV, C, A, U>&
+	RedBlackTree<K, V, KV, C, A, U>::operator=(RedBlackTree&& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			pool.Pool_release(Node_allocator(memory));
+			key_compare = other.key_compare;
+			memory = other.memory;
+			Header_move_data(other);
+			pool.Pool_move_data(other.pool);
+		}
+		return (*this);
+	}
+
+	/**
+	 * 	@brief get allocator
+	 * 
+	 * 	@return A copy of the allocator used by the %RBT.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::allocator_type
+	RedBlackTree<K, V, KV, C, A, U>::get_allocator() const
+	{ return (memory); }
+
 	///////////////
 	// Iterators //
 	///////////////
@@ -2305,9 +3203,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return An iterator to the first position.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::begin()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::begin()
 	{ return (iterator(get_leftmost())); }
 
 	/**
@@ -2315,9 +3213,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A const iterator to the first position.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::const_iterator
-	RedBlackTree<K, V, KV, C, A>::begin() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_iterator
+	RedBlackTree<K, V, KV, C, A, U>::begin() const
 	{ return (const_iterator(get_leftmost())); }
 
 	/**
@@ -2325,9 +3223,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return An iterator to the last position.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::end()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::end()
 	{ return (iterator(&header)); }
 
 	/**
@@ -2335,9 +3233,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A const iterator to the last position.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::const_iterator
-	RedBlackTree<K, V, KV, C, A>::end() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_iterator
+	RedBlackTree<K, V, KV, C, A, U>::end() const
 	{ return (const_iterator(&header)); }
 
 	/**
@@ -2345,9 +3243,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A reverse iterator to the last position.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::reverse_iterator
-	RedBlackTree<K, V, KV, C, A>::rbegin()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::reverse_iterator
+	RedBlackTree<K, V, KV, C, A, U>::rbegin()
 	{ return (reverse_iterator(end())); }
 
 	/**
@@ -2355,9 +3253,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A const reverse iterator to the last position.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::const_reverse_iterator
-	RedBlackTree<K, V, KV, C, A>::rbegin() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_reverse_iterator
+	RedBlackTree<K, V, KV, C, A, U>::rbegin() const
 	{ return (const_reverse_iterator(end())); }
 
 	/**
@@ -2365,9 +3263,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A reverse iterator to the first position.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::reverse_iterator
-	RedBlackTree<K, V, KV, C, A>::rend()
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::reverse_iterator
+	RedBlackTree<K, V, KV, C, A, U>::rend()
 	{ return (reverse_iterator(begin())); }
 
 	/**
@@ -2375,9 +3273,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A const reverse iterator to the first position.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::const_reverse_iterator
-	RedBlackTree<K, V, KV, C, A>::rend() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_reverse_iterator
+	RedBlackTree<K, V, KV, C, A, U>::rend() const
 	{ return (const_reverse_iterator(begin())); }
 
 	//////////////
@@ -2389,9 +3287,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return True if the %RedBlackTree is empty.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline bool
-	RedBlackTree<K, V, KV, C, A>::empty() const
+	RedBlackTree<K, V, KV, C, A, U>::empty() const
 	{ return (tree_count == 0); }
 
 	/**
@@ -2399,9 +3297,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return The number of nodes holded by the %RBT.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::size_type
-	RedBlackTree<K, V, KV, C, A>::size() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::size_type
+	RedBlackTree<K, V, KV, C, A, U>::size() const
 	{ return (tree_count); }
 
 	/**
@@ -2409,9 +3307,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return The maximun number of elemens that %RBT can hold.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::size_type
-	RedBlackTree<K, V, KV, C, A>::max_size() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::size_type
+	RedBlackTree<K, V, KV, C, A, U>::max_size() const
 	{ return (min(size_type(std::numeric_limits<size_type>::max() / sizeof(value_type)), memory.max_size())); }
 
 	///////////////
@@ -2422,12 +3320,14 @@ namespace FT_NAMESPACE
 	 * 	@brief clear
 	 * 
 	 * 	Empty the %RBT.
+	 * 	NOTE: The nodes stay in the node pool, they are reused by the next
+	 * 	insertions.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::clear()
+	RedBlackTree<K, V, KV, C, A, U>::clear()
 	{
-		aux_erase(begin());
+		aux_erase(get_begin());
 		Header_reset();
 	}
 
@@ -2438,9 +3338,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Removes the values holded at @p pos.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::erase(iterator pos)
+	RedBlackTree<K, V, KV, C, A, U>::erase(iterator pos)
 	{ aux_erase(static_cast<const_iterator>(pos)); }
 
 	/**
@@ -2450,9 +3350,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Removes the values holded at @p pos.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::erase(const_iterator pos)
+	RedBlackTree<K, V, KV, C, A, U>::erase(const_iterator pos)
 	{ aux_erase(pos); }
 
 	/**
@@ -2462,9 +3362,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Removes the values maching with the key @p k.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::size_type
-	RedBlackTree<K, V, KV, C, A>::erase(const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::size_type
+	RedBlackTree<K, V, KV, C, A, U>::erase(const key_type& k)
 	{
 		const size_type old_size = size();
 		std::pair<iterator, iterator> pos = equal_range(k);
@@ -2481,9 +3381,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Removes the values in range @p first - @p last.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::erase(iterator first, iterator last)
+	RedBlackTree<K, V, KV, C, A, U>::erase(iterator first, iterator last)
 	{ aux_erase(first, last); }
 
 	/**
@@ -2494,9 +3394,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Removes the values in range @p first - @p last.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline void
-	RedBlackTree<K, V, KV, C, A>::erase(const_iterator first, const_iterator last)
+	RedBlackTree<K, V, KV, C, A, U>::erase(const_iterator first, const_iterator last)
 	{ aux_erase(first, last); }
 
 	/**	
@@ -2504,9 +3404,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Swap @c *this with @p other.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	void
-	RedBlackTree<K, V, KV, C, A>::swap(RedBlackTree& other)
+	RedBlackTree<K, V, KV, C, A, U>::swap(RedBlackTree& other)
 	{
 		/* *this is empty */
 		if (get_root() == 0 && other.get_root())
@@ -2528,9 +3428,10 @@ namespace FT_NAMESPACE
 			other.get_root()->parent = other.get_end();
 		}
 
-		/* Swap key_compares & allocators */
+		/* Swap key_compares, allocators & node pools */
 		std::swap(key_compare, other.key_compare);
 		std::swap(memory, other.memory);
+		std::swap(pool, other.pool);
 	}
 
 	////////////
@@ -2541,13 +3442,15 @@ namespace FT_NAMESPACE
 	 * 	@brief count
 	 * 
 	 * 	@return The number of matches with the key @p k.
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::size_type
-	RedBlackTree<K, V, KV, C, A>::count(const key_type& k) const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::size_type
+	RedBlackTree<K, V, KV, C, A, U>::count(const key_type& k) const
 	{
 		std::pair<const_iterator, const_iterator> match = equal_range(k);
-		return (size_type(/*std::distance(match.first, match.second)*/));
+
+		return (distance(match.first, match.second));
 	}
 
 	/**
@@ -2558,9 +3461,9 @@ namespace FT_NAMESPACE
 	 * 	Search for a pair unsing the given @p k key and return an
 	 * 	iterator pointing to the matching node.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::find(const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::find(const key_type& k)
 	{
 		/* Get the last match in a subsequence that matchs with the key k. */
 		iterator match = aux_lower_bound(get_begin(), get_end(), k);
@@ -2580,9 +3483,9 @@ namespace FT_NAMESPACE
 	 * 	Search for a pair unsing the given @p k key and return an
 	 * 	iterator pointing to the matching node.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	typename RedBlackTree<K, V, KV, C, A>::const_iterator
-	RedBlackTree<K, V, KV, C, A>::find(const key_type& k) const
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::const_iterator
+	RedBlackTree<K, V, KV, C, A, U>::find(const key_type& k) const
 	{
 		/* Get the last match in a subsequence that matchs with the key k. */
 		const_iterator match = aux_lower_bound(get_begin(), get_end(), k);
@@ -2601,9 +3504,9 @@ namespace FT_NAMESPACE
 	 * 	@return Return a pair of iterators pointing the maching
 	 * 	 @p k key.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	::std::pair<typename RedBlackTree<K, V, KV, C, A>::iterator, typename RedBlackTree<K, V, KV, C, A>::iterator>
-	RedBlackTree<K, V, KV, C, A>::equal_range(const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	::std::pair<typename RedBlackTree<K, V, KV, C, A, U>::iterator, typename RedBlackTree<K, V, KV, C, A, U>::iterator>
+	RedBlackTree<K, V, KV, C, A, U>::equal_range(const key_type& k)
 	{
 		/* Update y, iterate with x */
 		Link_type x = get_begin();
@@ -2626,12 +3529,14 @@ namespace FT_NAMESPACE
 			/* Match */
 			else
 			{
-				/* Calc the range of the matches and return them */
+				/* Calc the range of the matches and return them,
+					the upper bound starts from the last left node */
 				Link_type x_right = sget_right(x);
+				Node_Ptr y_right = y;
 				y = x;
 				x = sget_left(x);
 				return (std::pair<iterator, iterator>(aux_lower_bound(x, y, k),
-					 aux_upper_bound(x_right, y, k)));
+					 aux_upper_bound(x_right, y_right, k)));
 			}
 		}
 			
@@ -2647,15 +3552,13 @@ namespace FT_NAMESPACE
 	 * 	@return Return a pair of const iterators pointing the maching
 	 * 	 @p k key.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	std::pair<typename RedBlackTree<K, V, KV, C, A>::const_iterator, typename RedBlackTree<K, V, KV, C, A>::const_iterator>
-	RedBlackTree<K, V, KV, C, A>::equal_range(const key_type& k) const
+	template <class K, class V, class KV, class C, class A, class U>
+	std::pair<typename RedBlackTree<K, V, KV, C, A, U>::const_iterator, typename RedBlackTree<K, V, KV, C, A, U>::const_iterator>
+	RedBlackTree<K, V, KV, C, A, U>::equal_range(const key_type& k) const
 	{
 		/* Update y, iterate with x */
-		//Const_Link_type x = get_begin();
-		//Const_Node_Ptr y = get_end();
-		Link_type x = get_begin();
-		Node_Ptr y = get_end();
+		Const_Link_type x = get_begin();
+		Const_Node_Ptr y = get_end();
 
 		while (x)
 		{
@@ -2674,39 +3577,123 @@ namespace FT_NAMESPACE
 			/* Match */
 			else
 			{
-				/* Calc the range of the matches and return them */
+				/* Calc the range of the matches and return them,
+					the upper bound starts from the last left node */
 				Const_Link_type x_right = sget_right(x);
+				Const_Node_Ptr y_right = y;
 				y = x;
 				x = sget_left(x);
 				return (std::pair<const_iterator, const_iterator>(aux_lower_bound(x, y, k),
-					 aux_upper_bound(x_right, y, k)));
+					 aux_upper_bound(x_right, y_right, k)));
 			}
 		}
 			
 		/* No match */
-		return (std::pair<const_iterator, const_iterator>(iterator(y), iterator(y)));
+		return (std::pair<const_iterator, const_iterator>(const_iterator(y), const_iterator(y)));
 	}
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::lower_bound(const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::lower_bound(const key_type& k)
 	{ return (aux_lower_bound(get_begin(), get_end(), k)); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::const_iterator
-	RedBlackTree<K, V, KV, C, A>::lower_bound(const key_type& k) const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_iterator
+	RedBlackTree<K, V, KV, C, A, U>::lower_bound(const key_type& k) const
 	{ return (aux_lower_bound(get_begin(), get_end(), k)); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::iterator
-	RedBlackTree<K, V, KV, C, A>::upper_bound(const key_type& k)
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::upper_bound(const key_type& k)
 	{ return (aux_upper_bound(get_begin(), get_end(), k)); }
 
-	template <class K, class V, class KV, class C, class A>
-	inline typename RedBlackTree<K, V, KV, C, A>::const_iterator
-	RedBlackTree<K, V, KV, C, A>::upper_bound(const key_type& k) const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_iterator
+	RedBlackTree<K, V, KV, C, A, U>::upper_bound(const key_type& k) const
 	{ return (aux_upper_bound(get_begin(), get_end(), k)); }
 
+	//////////////////////
+	// Order statistics //
+	//////////////////////
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return An iterator to the @p k th element in order (from 0), end()
+	 * 	if @p k isn't less than size().
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::iterator
+	RedBlackTree<K, V, KV, C, A, U>::nth(size_type k)
+	{
+		Node_Ptr x = get_root();
+
+		if (k >= size())
+			return (end());
+		if (!FT_RBTREE_ORDER_STATISTICS)
+		{
+			iterator it = begin();
+
+			while (k--)
+				++it;
+			return (it);
+		}
+
+		/* Go down: the left subtree holds the first indexes, then x, then the right one */
+		while (k != Node_size(x->left))
+		{
+			if (k < Node_size(x->left))
+				x = x->left;
+			else
+			{
+				k -= Node_size(x->left) + 1;
+				x = x->right;
+			}
+		}
+		return (iterator(x));
+	}
+
+	template <class K, class V, class KV, class C, class A, class U>
+	inline typename RedBlackTree<K, V, KV, C, A, U>::const_iterator
+	RedBlackTree<K, V, KV, C, A, U>::nth(size_type k) const
+	{ return (const_iterator(const_cast<RedBlackTree*>(this)->nth(k))); }
+
+	/**
+	 * 	@brief rank
+	 * 
+	 * 	@param k A key.
+	 * 
+	 * 	@return The amount of elements with a key less than @p k (the index
+	 * 	of lower_bound(k)).
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	*/
+	template <class K, class V, class KV, class C, class A, class U>
+	typename RedBlackTree<K, V, KV, C, A, U>::size_type
+	RedBlackTree<K, V, KV, C, A, U>::rank(const key_type& k) const
+	{
+		Const_Node_Ptr	x = get_root();
+		size_type		n = 0;
+
+		if (!FT_RBTREE_ORDER_STATISTICS)
+			return (RBT_index(lower_bound(k).node));
+
+		/* As lower_bound, counting the left subtrees left behind */
+		while (x)
+		{
+			if (!key_compare(sget_key(x), k))
+				x = x->left;
+			else
+			{
+				n += Node_size(x->left) + 1;
+				x = x->right;
+			}
+		}
+		return (n);
+	}
+
 	///////////////
 	// Observers //
 	///////////////
@@ -2716,9 +3703,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return The %RedBlackTree key compare.
 	*/
-	template <class K, class V, class KV, class C, class A>
-	inline C // mmm //typename RedBlackTree<K, V, KV, C, A>::Compare
-	RedBlackTree<K, V, KV, C, A>::key_comp() const
+	template <class K, class V, class KV, class C, class A, class U>
+	inline C // mmm //typename RedBlackTree<K, V, KV, C, A, U>::Compare
+	RedBlackTree<K, V, KV, C, A, U>::key_comp() const
 	{ return (key_compare); }
 
 	/////////////////
@@ -2734,34 +3721,34 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return The boolean result of the requested operation.
 	*/
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline bool
-	operator==(const RedBlackTree<K, V, KV, C, A>& lhs, const RedBlackTree<K, V, KV, C, A>& rhs)
-	{ return (lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
+	operator==(const RedBlackTree<K, V, KV, C, A, U>& lhs, const RedBlackTree<K, V, KV, C, A, U>& rhs)
+	{ return (lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin())); }
 
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline bool
-	operator<(const RedBlackTree<K, V, KV, C, A>& lhs, const RedBlackTree<K, V, KV, C, A>& rhs)
+	operator<(const RedBlackTree<K, V, KV, C, A, U>& lhs, const RedBlackTree<K, V, KV, C, A, U>& rhs)
 	{ return (std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
 
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline bool
-	operator!=(const RedBlackTree<K, V, KV, C, A>& lhs, const RedBlackTree<K, V, KV, C, A>& rhs)
+	operator!=(const RedBlackTree<K, V, KV, C, A, U>& lhs, const RedBlackTree<K, V, KV, C, A, U>& rhs)
 	{ return (!(lhs == rhs)); }
 
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline bool
-	operator>(const RedBlackTree<K, V, KV, C, A>& lhs, const RedBlackTree<K, V, KV, C, A>& rhs)
+	operator>(const RedBlackTree<K, V, KV, C, A, U>& lhs, const RedBlackTree<K, V, KV, C, A, U>& rhs)
 	{ return (rhs < lhs); }
 
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline bool
-	operator<=(const RedBlackTree<K, V, KV, C, A>& lhs, const RedBlackTree<K, V, KV, C, A>& rhs)
+	operator<=(const RedBlackTree<K, V, KV, C, A, U>& lhs, const RedBlackTree<K, V, KV, C, A, U>& rhs)
 	{ return (!(lhs > rhs)); }
 
-	template <class K, class V, class KV, class C, class A>
+	template <class K, class V, class KV, class C, class A, class U>
 	inline bool
-	operator>=(const RedBlackTree<K, V, KV, C, A>& lhs, const RedBlackTree<K, V, KV, C, A>& rhs)
+	operator>=(const RedBlackTree<K, V, KV, C, A, U>& lhs, const RedBlackTree<K, V, KV, C, A, U>& rhs)
 	{ return (!(lhs < rhs)); }
 	//@}
 
@@ -2770,9 +3757,10 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Specialised swap made to swap %RBT.
 	*/
-	template <typename Key, typename T, typename Key_Val, typename Compare, typename Alloc>
+	template <typename Key, typename T, typename Key_Val, typename Compare, typename Alloc, typename Augment>
 	inline void
-	swap(const RedBlackTree<Key, T, Key_Val, Compare, Alloc>& lhs, const RedBlackTree<Key, T, Key_Val, Compare, Alloc>& rhs)
+	swap(RedBlackTree<Key, T, Key_Val, Compare, Alloc, Augment>& lhs,
+	RedBlackTree<Key, T, Key_Val, Compare, Alloc, Augment>& rhs)
 	{ lhs.swap(rhs); }
 
 	// TO DO: l 1764 operator= NOT IMPL HERE 	// TO DO: l 1764 operator= NOT IMPL HERE 
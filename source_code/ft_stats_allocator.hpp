@@ -0,0 +1,401 @@
+/** @file ft_stats_allocator.hpp
+ *
+ * 	This file contains the instrumented allocator adaptor implementation.
+*/
+
+# pragma once
+
+# include "ft_allocator.hpp"
+
+# include <new>
+# include <memory>
+# include <utility>
+
+/**
+ * 	@brief Stats allocator MACROS
+ *
+ * 	- FT_STATS_HISTOGRAM_SIZE: The number of buckets of the size histogram.
+ * 	The bucket i counts the requests of [2^i, 2^(i + 1)) bytes, the last
+ * 	one also counts all the bigger requests.
+ *
+ * 	It is overwritable if needed.
+*/
+#ifndef FT_STATS_HISTOGRAM_SIZE
+# define FT_STATS_HISTOGRAM_SIZE 0x20
+#endif
+
+namespace FT_NAMESPACE
+{
+	//////////////////////
+	// Allocation stats //
+	//////////////////////
+
+	/**
+	 * 	@brief Allocation stats
+	 *
+	 * 	Counters filled by the %stats_allocator objects that share them.
+	 * 	All the sizes are in bytes.
+	*/
+	struct allocation_stats
+	{
+		/* Member types */
+
+		typedef std::size_t	size_type;
+
+		/* Counters */
+
+		size_type	allocations;
+		size_type	deallocations;
+		size_type	bytes_in_use;
+		size_type	peak_bytes;
+		size_type	histogram[FT_STATS_HISTOGRAM_SIZE];
+
+		/* Member functions */
+
+		allocation_stats();
+
+		void						reset() throw();
+		void						record_allocation(size_type bytes) throw();
+		void						record_deallocation(size_type bytes) throw();
+
+		static size_type			get_bucket(size_type bytes) throw();
+		static allocation_stats&	default_stats() throw();
+	};
+
+	/**
+	 * 	@brief Default Constructor
+	 *
+	 * 	All the counters start at 0.
+	*/
+	inline
+	allocation_stats::allocation_stats()
+	{ reset(); }
+
+	/**
+	 * 	@brief reset
+	 *
+	 * 	Sets all the counters to 0.
+	*/
+	inline void
+	allocation_stats::reset()
+	throw()
+	{
+		allocations = 0;
+		deallocations = 0;
+		bytes_in_use = 0;
+		peak_bytes = 0;
+		for (size_type i = 0 ; i < size_type(FT_STATS_HISTOGRAM_SIZE) ; i++)
+			histogram[i] = 0;
+	}
+
+	/**
+	 * 	@brief record allocation
+	 *
+	 * 	@param bytes The size of the allocated block.
+	*/
+	inline void
+	allocation_stats::record_allocation(size_type bytes)
+	throw()
+	{
+		allocations++;
+		bytes_in_use += bytes;
+		if (bytes_in_use > peak_bytes)
+			peak_bytes = bytes_in_use;
+		histogram[get_bucket(bytes)]++;
+	}
+
+	/**
+	 * 	@brief record deallocation
+	 *
+	 * 	@param bytes The size of the deallocated block.
+	*/
+	inline void
+	allocation_stats::record_deallocation(size_type bytes)
+	throw()
+	{
+		deallocations++;
+		bytes_in_use -= bytes;
+	}
+
+	/**
+	 * 	@brief get bucket
+	 *
+	 * 	@param bytes A request size.
+	 * 	@return The index of the histogram bucket counting @p bytes.
+	*/
+	inline allocation_stats::size_type
+	allocation_stats::get_bucket(size_type bytes)
+	throw()
+	{
+		size_type i = 0;
+
+		while ((bytes >>= 1) && i < size_type(FT_STATS_HISTOGRAM_SIZE - 1))
+			i++;
+		return (i);
+	}
+
+	/**
+	 * 	@brief default stats
+	 *
+	 * 	@return The stats used by default constructed %stats_allocator.
+	*/
+	inline allocation_stats&
+	allocation_stats::default_stats()
+	throw()
+	{
+		static allocation_stats s;
+		return (s);
+	}
+
+	/////////////////////
+	// Stats allocator //
+	/////////////////////
+
+	/**
+	 * 	@brief Allocator adaptor that counts the requests.
+	 *
+	 * 	@tparam T the type of the allocated/deallocated object.
+	 * 	@tparam Alloc the wrapped allocator, it does the real work.
+	 *
+	 * 	Each allocate/deallocate is recorded in an %allocation_stats,
+	 * 	rebound copies record in the same one. Pass a different
+	 * 	%allocation_stats to each container to get per-container counts:
+	 *
+	 * 	ft::allocation_stats s;
+	 * 	ft::vector<int, ft::stats_allocator<int> > v((ft::stats_allocator<int>(s)));
+	 * 	...
+	 * 	ft::get_allocation_stats(v).peak_bytes;
+	*/
+	template <typename T, typename Alloc = allocator<T> >
+	class stats_allocator
+	{
+		/* Member types */
+
+		public:
+
+		typedef typename Alloc::template rebind<T>::other	inner_allocator_type;
+		typedef T											value_type;
+		typedef std::size_t									size_type;
+		typedef std::ptrdiff_t								difference_type;
+		typedef T*											pointer;
+		typedef const T*									const_pointer;
+		typedef T&											reference;
+		typedef const T&									const_reference;
+
+		template <typename T1>
+		struct rebind { typedef stats_allocator<T1, typename Alloc::template rebind<T1>::other> other; };
+
+		/* Core */
+
+		private:
+
+		inner_allocator_type	inner;
+		allocation_stats*		stats;
+
+		/* Member functions */
+
+		public:
+
+		stats_allocator();
+		stats_allocator(allocation_stats& s, const inner_allocator_type& alloc = inner_allocator_type());
+		stats_allocator(const stats_allocator& other);
+		template <typename T1, typename Alloc1>
+		stats_allocator(const stats_allocator<T1, Alloc1>& other);
+		~stats_allocator();
+
+		allocation_stats&			get_stats() const throw();
+		const inner_allocator_type&	get_inner_allocator() const throw();
+		pointer						address(reference x) const throw();
+		const_pointer				address(const_reference x) const throw();
+		pointer						allocate(size_type n, const void* hint = static_cast<const void*>(0)) throw(std::bad_alloc);
+		pointer						reallocate(pointer p, size_type old_n, size_type new_n) throw(std::bad_alloc);
+		void						deallocate(pointer p, size_type n) throw();
+		void						construct(pointer p, const_reference value) throw(std::bad_alloc);
+		template <typename... Args>
+		void						construct(pointer p, Args&&... args) throw(std::bad_alloc);
+		void						destroy(pointer p) throw();
+		size_type					max_size() const throw();
+	};
+
+	/**
+	 * 	@brief Default Constructor
+	 *
+	 * 	Records in @c allocation_stats::default_stats().
+	*/
+	template <typename T, typename Alloc>
+	stats_allocator<T, Alloc>::stats_allocator()
+	: inner(), stats(&allocation_stats::default_stats())
+	{ }
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param s The stats where the requests are recorded.
+	 * 	@param alloc The wrapped allocator.
+	*/
+	template <typename T, typename Alloc>
+	stats_allocator<T, Alloc>::stats_allocator(allocation_stats& s, const inner_allocator_type& alloc)
+	: inner(alloc), stats(&s)
+	{ }
+
+	template <typename T, typename Alloc>
+	stats_allocator<T, Alloc>::stats_allocator(const stats_allocator& other)
+	: inner(other.inner), stats(other.stats)
+	{ }
+
+	template <typename T, typename Alloc>
+	template <typename T1, typename Alloc1>
+	stats_allocator<T, Alloc>::stats_allocator(const stats_allocator<T1, Alloc1>& other)
+	: inner(other.get_inner_allocator()), stats(&other.get_stats())
+	{ }
+
+	template <typename T, typename Alloc>
+	stats_allocator<T, Alloc>::~stats_allocator()
+	{ }
+
+	template <typename T, typename Alloc>
+	inline allocation_stats&
+	stats_allocator<T, Alloc>::get_stats() const
+	throw()
+	{ return (*stats); }
+
+	template <typename T, typename Alloc>
+	inline const typename stats_allocator<T, Alloc>::inner_allocator_type&
+	stats_allocator<T, Alloc>::get_inner_allocator() const
+	throw()
+	{ return (inner); }
+
+	template <typename T, typename Alloc>
+	inline typename stats_allocator<T, Alloc>::pointer
+	stats_allocator<T, Alloc>::address(reference x) const
+	throw()
+	{ return (std::addressof(x)); }
+
+	template <typename T, typename Alloc>
+	inline typename stats_allocator<T, Alloc>::const_pointer
+	stats_allocator<T, Alloc>::address(const_reference x) const
+	throw()
+	{ return (std::addressof(x)); }
+
+	/**
+	 * 	@brief allocate
+	 *
+	 * 	@param n The amount of objects.
+	 * 	@return The block given by the wrapped allocator.
+	 *
+	 * 	A failed request is not recorded.
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	template <typename T, typename Alloc>
+	inline typename stats_allocator<T, Alloc>::pointer
+	stats_allocator<T, Alloc>::allocate(size_type n, const void* hint)
+	throw(::std::bad_alloc)
+	{
+		pointer p = inner.allocate(n, hint);
+		stats->record_allocation(n * sizeof(value_type));
+		return (p);
+	}
+
+	/**
+	 * 	@brief reallocate
+	 *
+	 * 	@param p A pointer given by allocate/reallocate.
+	 * 	@param old_n The amount of objects of @p p.
+	 * 	@param new_n The new amount of objects.
+	 * 	@return The block given by the wrapped allocator.
+	 *
+	 * 	Recorded as a deallocation of @p old_n objects followed by an
+	 * 	allocation of @p new_n objects.
+	 * 	NOTE: Only usable if the wrapped allocator can reallocate.
+	 *
+	 * 	@throw std::bad_alloc.
+	*/
+	template <typename T, typename Alloc>
+	inline typename stats_allocator<T, Alloc>::pointer
+	stats_allocator<T, Alloc>::reallocate(pointer p, size_type old_n, size_type new_n)
+	throw(::std::bad_alloc)
+	{
+		pointer tmp = inner.reallocate(p, old_n, new_n);
+		if (p)
+			stats->record_deallocation(old_n * sizeof(value_type));
+		stats->record_allocation(new_n * sizeof(value_type));
+		return (tmp);
+	}
+
+	/**
+	 * 	@brief deallocate
+	 *
+	 * 	@param p A pointer given by allocate (or NULL).
+	 * 	@param n The amount of objects given to allocate.
+	*/
+	template <typename T, typename Alloc>
+	inline void
+	stats_allocator<T, Alloc>::deallocate(pointer p, size_type n)
+	throw()
+	{
+		if (p)
+			stats->record_deallocation(n * sizeof(value_type));
+		inner.deallocate(p, n);
+	}
+
+	template <typename T, typename Alloc>
+	inline void
+	stats_allocator<T, Alloc>::construct(pointer p, const_reference value)
+	throw(::std::bad_alloc)
+	{ inner.construct(p, value); }
+
+	/**
+	 * 	@brief construct
+	 *
+	 * 	@param p A pointer to uninitialised storage.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	*/
+	template <typename T, typename Alloc>
+	template <typename... Args>
+	inline void
+	stats_allocator<T, Alloc>::construct(pointer p, Args&&... args)
+	throw(::std::bad_alloc)
+	{ inner.construct(p, std::forward<Args>(args)...); }
+
+	template <typename T, typename Alloc>
+	inline void
+	stats_allocator<T, Alloc>::destroy(pointer p)
+	throw()
+	{ inner.destroy(p); }
+
+	template <typename T, typename Alloc>
+	inline typename stats_allocator<T, Alloc>::size_type
+	stats_allocator<T, Alloc>::max_size() const
+	throw()
+	{ return (inner.max_size()); }
+
+	/// Equal if they record in the same stats and their wrapped allocators are equal.
+	template <typename T1, typename A1, typename T2, typename A2>
+	inline bool
+	operator==(const stats_allocator<T1, A1>& lhs, const stats_allocator<T2, A2>& rhs)
+	{ return (&lhs.get_stats() == &rhs.get_stats() && lhs.get_inner_allocator() == rhs.get_inner_allocator()); }
+
+	template <typename T1, typename A1, typename T2, typename A2>
+	inline bool
+	operator!=(const stats_allocator<T1, A1>& lhs, const stats_allocator<T2, A2>& rhs)
+	{ return (!(lhs == rhs)); }
+
+	/// Reallocates if the wrapped allocator does.
+	template <typename T, typename Alloc>
+	struct allocator_can_reallocate<stats_allocator<T, Alloc> >
+	: public allocator_can_reallocate<Alloc>
+	{ };
+
+	/**
+	 * 	@brief get allocation stats
+	 *
+	 * 	@tparam Container Any container using a %stats_allocator.
+	 * 	@param c A container.
+	 * 	@return The stats where the allocations of @p c are recorded.
+	*/
+	template <typename Container>
+	inline allocation_stats&
+	get_allocation_stats(const Container& c)
+	{ return (c.get_allocator().get_stats()); }
+};
@@ -3,13 +3,26 @@
  *
  * 	This file contains function templates that perform types operations.
  * 
- * 	Functions: enable_if, conditional_type
+ * 	Functions: enable_if, conditional_type, are_same,
+ * 	is_trivially_copyable, is_trivially_destructible,
+ * 	is_trivially_relocatable, is_trivially_default_constructible
 */
 
 # pragma once
 
 # include "ft_containers.hpp"
 
+/**
+ * 	@brief FT_IS_TRIVIALLY_DESTRUCTIBLE
+ * 
+ * 	Clang deprecates __has_trivial_destructor, gcc only has it.
+*/
+#if defined(__clang__)
+# define FT_IS_TRIVIALLY_DESTRUCTIBLE(T) __is_trivially_destructible(T)
+#else
+# define FT_IS_TRIVIALLY_DESTRUCTIBLE(T) __has_trivial_destructor(T)
+#endif
+
 namespace FT_NAMESPACE
 {
 	/// Nested type, contains the @c type if the bool is true.
@@ -19,14 +32,12 @@ namespace FT_NAMESPACE
 	template <typename T>
 	struct enable_if<true, T> { typedef T type; };
 
-/*
 	/// Conditional nested type.
 	template <bool Cond, typename Iftrue, typename Iffalse>
 	struct conditional_type { typedef Iffalse type; };
 
-	template <bool Cond, typename Iftrue, typename Iffalse>
+	template <typename Iftrue, typename Iffalse>
 	struct conditional_type<true, Iftrue, Iffalse> { typedef Iftrue type; };
-*/
 
 	struct true_type { };
 	struct false_type { };
@@ -46,4 +57,60 @@ namespace FT_NAMESPACE
 		typedef true_type type;
 	};
 
+	/**
+	 * 	@brief Trivially copyable
+	 * 
+	 * 	The objects of type T can be copied (and relocated) with
+	 * 	memcpy/memmove. Uses the compiler intrinsic.
+	*/
+	template <typename T>
+	struct is_trivially_copyable
+	{
+		enum { value = __is_trivially_copyable(T) };
+		typedef typename conditional_type<value, true_type, false_type>::type type;
+	};
+
+	/**
+	 * 	@brief Trivially destructible
+	 * 
+	 * 	The destructor of T does nothing, destructor loops can be skipped.
+	*/
+	template <typename T>
+	struct is_trivially_destructible
+	{
+		enum { value = FT_IS_TRIVIALLY_DESTRUCTIBLE(T) };
+		typedef typename conditional_type<value, true_type, false_type>::type type;
+	};
+
+	/**
+	 * 	@brief Trivially relocatable
+	 * 
+	 * 	Moving a T to a new address and then releasing the old storage without
+	 * 	destroying it is the same as a memcpy. It is true for the trivially copyable
+	 * 	types, specialise it for the types that own their data by pointer:
+	 * 
+	 * 	template <>
+	 * 	struct ft::is_trivially_relocatable<my_type>
+	 * 	{ enum { value = 1 }; typedef ft::true_type type; };
+	*/
+	template <typename T>
+	struct is_trivially_relocatable
+	{
+		enum { value = is_trivially_copyable<T>::value };
+		typedef typename is_trivially_copyable<T>::type type;
+	};
+
+	/**
+	 * 	@brief Trivially default constructible
+	 * 
+	 * 	The default constructor of T does nothing, a default-initialised
+	 * 	T is left with the bytes of its storage. Uses the compiler intrinsic.
+	*/
+	template <typename T>
+	struct is_trivially_default_constructible
+	{
+		enum { value = __is_trivially_constructible(T) };
+		typedef typename conditional_type<value, true_type, false_type>::type type;
+	};
+
 };
\ No newline at end of file
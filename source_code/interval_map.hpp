@@ -0,0 +1,811 @@
+/** @file interval_map.hpp
+ *
+ * 	This file contains the implementation of @c interval_map container.
+*/
+
+# pragma once
+
+# include "ft_rbtree.hpp"
+# include "algorithm.hpp"
+# include <functional>
+
+namespace FT_NAMESPACE
+{
+	//////////////
+	// Interval //
+	//////////////
+
+	/**
+	 * 	@brief interval
+	 *
+	 * 	@tparam T The type of the bounds.
+	 *
+	 * 	The closed interval [low, high], @c low must not be after @c high.
+	*/
+	template <typename T>
+	struct interval
+	{
+		/* Member types */
+
+		typedef T	bound_type;
+
+		/* Core */
+
+		T	low;
+		T	high;
+
+		/* Member functions */
+
+		interval();
+		interval(const T& low, const T& high);
+	};
+
+	/**
+	 * 	@brief Default Constructor
+	*/
+	template <typename T>
+	inline
+	interval<T>::interval()
+	: low(), high()
+	{ }
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param low The first bound.
+	 * 	@param high The last bound (included).
+	*/
+	template <typename T>
+	inline
+	interval<T>::interval(const T& low, const T& high)
+	: low(low), high(high)
+	{ }
+
+	//@{
+	/**
+	 * 	@brief Boolean comparison
+	 *
+	 * 	@return The boolean result of the requested operation, on the low
+	 * 	bounds then on the high bounds.
+	*/
+	template <typename T>
+	inline bool
+	operator==(const interval<T>& lhs, const interval<T>& rhs)
+	{ return (lhs.low == rhs.low && lhs.high == rhs.high); }
+
+	template <typename T>
+	inline bool
+	operator!=(const interval<T>& lhs, const interval<T>& rhs)
+	{ return (!(lhs == rhs)); }
+
+	template <typename T>
+	inline bool
+	operator<(const interval<T>& lhs, const interval<T>& rhs)
+	{ return (lhs.low < rhs.low || (!(rhs.low < lhs.low) && lhs.high < rhs.high)); }
+	//@}
+
+	//////////////////
+	// Interval map //
+	//////////////////
+
+	/**
+	 * 	@brief interval_map
+	 *
+	 * 	@tparam Key The type of the interval bounds.
+	 * 	@tparam T The mapped type.
+	 * 	@tparam Compare Orders the bounds.
+	 * 	@tparam Alloc An allocator type.
+	 *
+	 * 	A %multimap from closed intervals of @p Key (IP ranges, time windows,
+	 * 	...) to @p T, ordered by low bound then by high bound, that finds the
+	 * 	intervals overlapping a given one.
+	 *
+	 * 	The tree is augmented with the maximum high bound of each subtree
+	 * 	(see augment_none), an overlap search skips the subtrees ending before
+	 * 	the query and the ones beginning after it: O(log n + k) for k results
+	 * 	next to each other in key order, O((k + 1) log n) in the worst case.
+	*/
+	template <typename Key, typename T, typename Compare = ::std::less<Key>,
+	typename Alloc = allocator< ::std::pair<const interval<Key>, T> > >
+	class interval_map
+	{
+		/* Member types */
+
+		public:
+
+		typedef interval<Key>						key_type;
+		typedef Key									bound_type;
+		typedef T									mapped_type;
+		typedef std::pair<const key_type, T>		value_type;
+		typedef Compare								bound_compare;
+		typedef Alloc								allocator_type;
+
+		/* Orders the intervals by low bound, then by high bound */
+		struct key_compare : public std::binary_function<key_type, key_type, bool>
+		{
+			bound_compare comp;
+
+			key_compare(const bound_compare& c = bound_compare()) : comp(c) { }
+
+			bool operator()(const key_type& lhs, const key_type& rhs) const
+			{ return (comp(lhs.low, rhs.low) || (!comp(rhs.low, lhs.low) && comp(lhs.high, rhs.high))); }
+		};
+
+		private:
+
+		/* Keeps the maximum high bound of each subtree */
+		struct Interval_augment
+		{
+			typedef bound_type	data_type;
+
+			static void	update(data_type& data, const value_type& value, const data_type* left,
+						const data_type* right, const key_compare& comp) throw();
+		};
+
+		typedef RedBlackTree<key_type, value_type, Select_1st<value_type>, key_compare, allocator_type,
+		Interval_augment>	Tree_base;
+
+		/* The tree with the overlap search, it needs the nodes */
+		class Tree : public Tree_base
+		{
+			typedef typename Tree_base::Node_Ptr	Node_Ptr;
+			typedef typename Tree_base::Node_type	Node_type;
+
+			template <typename Visitor>
+			bool	aux_visit_overlaps(Node_Ptr x, const key_type& k, Visitor& visit);
+
+			public:
+
+			Tree();
+			Tree(const key_compare& comp, const allocator_type& alloc);
+
+			template <typename Visitor>
+			void	visit_overlaps(const key_type& k, Visitor& visit) const;
+		};
+
+		/* Overlap visitors: return false to stop the search */
+		struct Overlap_first;
+		struct Overlap_count;
+		template <typename Function, typename Reference>
+		struct Overlap_apply;
+
+		Tree	tree;
+
+		public:
+
+		/* Imported member types */
+
+		typedef typename Tree::reference		reference;
+		typedef typename Tree::const_reference	const_reference;
+		typedef typename Tree::pointer			pointer;
+		typedef typename Tree::const_pointer	const_pointer;
+		typedef typename Tree::size_type		size_type;
+		typedef typename Tree::difference_size	difference_type;
+
+		typedef typename Tree::iterator			iterator;
+		typedef typename Tree::const_iterator	const_iterator;
+
+		typedef typename Tree::reverse_iterator			reverse_iterator;
+		typedef typename Tree::const_reverse_iterator	const_reverse_iterator;
+
+		/* Member functions */
+
+		interval_map();
+		interval_map(const bound_compare& comp, const allocator_type& alloc = allocator_type());
+		template <typename InputIt>
+		interval_map(InputIt first, InputIt last, const bound_compare& comp = bound_compare(),
+			const allocator_type& alloc = allocator_type());
+		interval_map(const interval_map& other);
+		interval_map(interval_map&& other);
+
+		interval_map&	operator=(const interval_map& other);
+		interval_map&	operator=(interval_map&& other);
+		allocator_type	get_allocator() const;
+
+		/* Iterators */
+		iterator				begin();
+		const_iterator			begin() const;
+		iterator				end();
+		const_iterator			end() const;
+		reverse_iterator		rbegin();
+		const_reverse_iterator	rbegin() const;
+		reverse_iterator		rend();
+		const_reverse_iterator	rend() const;
+
+		/* Capacity */
+		bool			empty() const;
+		size_type		size() const;
+		size_type		max_size() const;
+
+		/* Modifiers */
+		void			clear();
+		iterator		insert(const_reference value);
+		iterator		insert(value_type&& value);
+		iterator		insert(const_iterator pos, const_reference value);
+		template <typename... Args>
+		iterator		emplace(Args&&... args);
+		template <typename InputIt>
+		void			insert(InputIt first, InputIt last);
+		void 			erase(iterator pos);
+		size_type		erase(const key_type& k);
+		void			erase(iterator first, iterator last);
+		void			swap(interval_map& other);
+
+		/* Lookup */
+		iterator		find(const key_type& k);
+		const_iterator	find(const key_type& k) const;
+		size_type		count(const key_type& k) const;
+		::std::pair<iterator, iterator>	equal_range(const key_type& k);
+		iterator		lower_bound(const key_type& k);
+		const_iterator	lower_bound(const key_type& k) const;
+		iterator		upper_bound(const key_type& k);
+		const_iterator	upper_bound(const key_type& k) const;
+
+		/* Overlap lookup */
+		iterator		find_overlap(const key_type& k);
+		const_iterator	find_overlap(const key_type& k) const;
+		size_type		count_overlaps(const key_type& k) const;
+		template <typename Function>
+		Function		for_each_overlap(const key_type& k, Function f);
+		template <typename Function>
+		Function		for_each_overlap(const key_type& k, Function f) const;
+
+		/* Observers */
+		key_compare		key_comp() const;
+		bound_compare	bound_comp() const;
+
+		/* Non members */
+		template <typename K1, typename T1, typename C1, typename A1>
+		friend bool	operator==(const interval_map<K1, T1, C1, A1>& lhs, const interval_map<K1, T1, C1, A1>& rhs);
+	};
+
+	//////////////////////
+	// Interval augment //
+	//////////////////////
+
+	/**
+	 * 	@brief update
+	 *
+	 * 	The maximum of the high bound of @p value and of the children data,
+	 * 	ordered by the bound compare of the tree.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline void
+	interval_map<Key, T, Compare, Alloc>::Interval_augment::update(data_type& data, const value_type& value,
+	const data_type* left, const data_type* right, const key_compare& comp)
+	throw()
+	{
+		data = value.first.high;
+		if (left && comp.comp(data, *left))
+			data = *left;
+		if (right && comp.comp(data, *right))
+			data = *right;
+	}
+
+	///////////////////
+	// Interval tree //
+	///////////////////
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline
+	interval_map<Key, T, Compare, Alloc>::Tree::Tree()
+	: Tree_base()
+	{ }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline
+	interval_map<Key, T, Compare, Alloc>::Tree::Tree(const key_compare& comp, const allocator_type& alloc)
+	: Tree_base(comp, alloc)
+	{ }
+
+	/**
+	 * 	@brief aux visit overlaps
+	 *
+	 * 	@param x The root of a subtree.
+	 * 	@param k An interval.
+	 * 	@param visit Called with an iterator to each interval overlapping
+	 * 	@p k, in key order.
+	 * 	@return False if @p visit stopped the search.
+	 *
+	 * 	A subtree whose maximum high bound is before @p k is skipped, and so
+	 * 	are the nodes (with their right subtree) beginning after @p k.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename Visitor>
+	bool
+	interval_map<Key, T, Compare, Alloc>::Tree::aux_visit_overlaps(Node_Ptr x, const key_type& k, Visitor& visit)
+	{
+		const Compare& comp = this->key_compare.comp;
+
+		while (x)
+		{
+			if (comp(*Node_type::Node_get_augment(x), k.low))
+				return (true);
+			if (!aux_visit_overlaps(x->left, k, visit))
+				return (false);
+			if (comp(k.high, Tree_base::sget_key(x).low))
+				return (true);
+			if (!comp(Tree_base::sget_key(x).high, k.low) && !visit(iterator(x)))
+				return (false);
+			x = x->right;
+		}
+		return (true);
+	}
+
+	/**
+	 * 	@brief visit overlaps
+	 *
+	 * 	@param k An interval.
+	 * 	@param visit The visitor of the overlapping intervals.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename Visitor>
+	inline void
+	interval_map<Key, T, Compare, Alloc>::Tree::visit_overlaps(const key_type& k, Visitor& visit) const
+	{
+		Tree* const self = const_cast<Tree*>(this);
+
+		self->aux_visit_overlaps(self->get_root(), k, visit);
+	}
+
+	//////////////////////
+	// Overlap visitors //
+	//////////////////////
+
+	/// Keeps the first overlapping interval.
+	template <class Key, class T, class Compare, class Alloc>
+	struct interval_map<Key, T, Compare, Alloc>::Overlap_first
+	{
+		iterator	found;
+
+		Overlap_first(iterator end) : found(end) { }
+
+		bool operator()(iterator it)
+		{
+			found = it;
+			return (false);
+		}
+	};
+
+	/// Counts the overlapping intervals.
+	template <class Key, class T, class Compare, class Alloc>
+	struct interval_map<Key, T, Compare, Alloc>::Overlap_count
+	{
+		size_type	n;
+
+		Overlap_count() : n(0) { }
+
+		bool operator()(iterator)
+		{
+			n++;
+			return (true);
+		}
+	};
+
+	/// Calls a function with each overlapping value.
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename Function, typename Reference>
+	struct interval_map<Key, T, Compare, Alloc>::Overlap_apply
+	{
+		Function&	f;
+
+		Overlap_apply(Function& f) : f(f) { }
+
+		bool operator()(iterator it)
+		{
+			f(static_cast<Reference>(*it));
+			return (true);
+		}
+	};
+
+	//////////////////////
+	// Member functions //
+	//////////////////////
+
+	/**
+	 * 	@brief Default Constructor
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	interval_map<Key, T, Compare, Alloc>::interval_map()
+	: tree()
+	{ }
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param comp A bound comparison object.
+	 * 	@param alloc An allocator.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	interval_map<Key, T, Compare, Alloc>::interval_map(const bound_compare& comp, const allocator_type& alloc)
+	: tree(key_compare(comp), alloc)
+	{ }
+
+	/**
+	 * 	@brief Range Constructor
+	 *
+	 * 	@tparam InputIt An input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 	@param comp A bound comparison object.
+	 * 	@param alloc An allocator.
+	 *
+	 * 	Create an %interval_map filled with copies of @p first - @p last range
+	 * 	(in linear time if it is sorted).
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename InputIt>
+	interval_map<Key, T, Compare, Alloc>::interval_map(InputIt first, InputIt last, const bound_compare& comp,
+	const allocator_type& alloc)
+	: tree(key_compare(comp), alloc)
+	{ tree.aux_insert_range_equal(first, last); }
+
+	/**
+	 * 	@brief Copy Constructor
+	 *
+	 * 	@param other An %interval_map of the same type of @c *this.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	interval_map<Key, T, Compare, Alloc>::interval_map(const interval_map& other)
+	: tree(other.tree)
+	{ }
+
+	/**
+	 * 	@brief Move Constructor
+	 *
+	 * 	@param other An %interval_map of the same type of @c *this, left empty.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	interval_map<Key, T, Compare, Alloc>::interval_map(interval_map&& other)
+	: tree(std::move(other.tree))
+	{ }
+
+	/**
+	 * 	@brief operator=
+	 *
+	 * 	@param other An %interval_map with the same type of @c *this.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	interval_map<Key, T, Compare, Alloc>&
+	interval_map<Key, T, Compare, Alloc>::operator=(const interval_map& other)
+	{
+		tree = other.tree;
+		return (*this);
+	}
+
+	/**
+	 * 	@brief operator=
+	 *
+	 * 	@param other An %interval_map with the same type of @c *this, left empty.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	interval_map<Key, T, Compare, Alloc>&
+	interval_map<Key, T, Compare, Alloc>::operator=(interval_map&& other)
+	{
+		tree = std::move(other.tree);
+		return (*this);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::allocator_type
+	interval_map<Key, T, Compare, Alloc>::get_allocator() const
+	{ return (tree.get_allocator()); }
+
+	///////////////
+	// Iterators //
+	///////////////
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::begin()
+	{ return (tree.begin()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::const_iterator
+	interval_map<Key, T, Compare, Alloc>::begin() const
+	{ return (tree.begin()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::end()
+	{ return (tree.end()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::const_iterator
+	interval_map<Key, T, Compare, Alloc>::end() const
+	{ return (tree.end()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::reverse_iterator
+	interval_map<Key, T, Compare, Alloc>::rbegin()
+	{ return (tree.rbegin()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::const_reverse_iterator
+	interval_map<Key, T, Compare, Alloc>::rbegin() const
+	{ return (tree.rbegin()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::reverse_iterator
+	interval_map<Key, T, Compare, Alloc>::rend()
+	{ return (tree.rend()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::const_reverse_iterator
+	interval_map<Key, T, Compare, Alloc>::rend() const
+	{ return (tree.rend()); }
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline bool
+	interval_map<Key, T, Compare, Alloc>::empty() const
+	{ return (tree.empty()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::size_type
+	interval_map<Key, T, Compare, Alloc>::size() const
+	{ return (tree.size()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::size_type
+	interval_map<Key, T, Compare, Alloc>::max_size() const
+	{ return (tree.max_size()); }
+
+	///////////////
+	// Modifiers //
+	///////////////
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline void
+	interval_map<Key, T, Compare, Alloc>::clear()
+	{ tree.clear(); }
+
+	/**
+	 * 	@brief insert
+	 *
+	 * 	@param value An interval and its mapped value.
+	 * 	@return An iterator to the inserted value.
+	 *
+	 * 	Equal intervals are kept, in insertion order.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::insert(const_reference value)
+	{ return (tree.aux_insert_equal(value)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::insert(value_type&& value)
+	{ return (tree.aux_insert_equal(std::move(value))); }
+
+	/**
+	 * 	@brief insert
+	 *
+	 * 	@param pos A hint of the insertion position.
+	 * 	@param value An interval and its mapped value.
+	 * 	@return An iterator to the inserted value.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::insert(const_iterator pos, const_reference value)
+	{ return (tree.aux_insert_equal(pos, value)); }
+
+	/**
+	 * 	@brief emplace
+	 *
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the emplaced value.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename... Args>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::emplace(Args&&... args)
+	{ return (tree.aux_emplace_equal(std::forward<Args>(args)...)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename InputIt>
+	inline void
+	interval_map<Key, T, Compare, Alloc>::insert(InputIt first, InputIt last)
+	{ tree.aux_insert_range_equal(first, last); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline void
+	interval_map<Key, T, Compare, Alloc>::erase(iterator pos)
+	{ tree.erase(pos); }
+
+	/**
+	 * 	@brief erase
+	 *
+	 * 	@param k An interval.
+	 * 	@return The amount of erased values, the ones with an interval equal
+	 * 	to @p k (not the overlapping ones).
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::size_type
+	interval_map<Key, T, Compare, Alloc>::erase(const key_type& k)
+	{ return (tree.erase(k)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline void
+	interval_map<Key, T, Compare, Alloc>::erase(iterator first, iterator last)
+	{ tree.erase(first, last); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline void
+	interval_map<Key, T, Compare, Alloc>::swap(interval_map& other)
+	{ tree.swap(other.tree); }
+
+	////////////
+	// Lookup //
+	////////////
+
+	/**
+	 * 	@brief find
+	 *
+	 * 	@param k An interval.
+	 * 	@return An iterator to a value with an interval equal to @p k, end()
+	 * 	if none (see find_overlap).
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::find(const key_type& k)
+	{ return (tree.find(k)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::const_iterator
+	interval_map<Key, T, Compare, Alloc>::find(const key_type& k) const
+	{ return (tree.find(k)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::size_type
+	interval_map<Key, T, Compare, Alloc>::count(const key_type& k) const
+	{ return (tree.count(k)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline ::std::pair<typename interval_map<Key, T, Compare, Alloc>::iterator,
+	typename interval_map<Key, T, Compare, Alloc>::iterator>
+	interval_map<Key, T, Compare, Alloc>::equal_range(const key_type& k)
+	{ return (tree.equal_range(k)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::lower_bound(const key_type& k)
+	{ return (tree.lower_bound(k)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::const_iterator
+	interval_map<Key, T, Compare, Alloc>::lower_bound(const key_type& k) const
+	{ return (tree.lower_bound(k)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::upper_bound(const key_type& k)
+	{ return (tree.upper_bound(k)); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::const_iterator
+	interval_map<Key, T, Compare, Alloc>::upper_bound(const key_type& k) const
+	{ return (tree.upper_bound(k)); }
+
+	////////////////////
+	// Overlap lookup //
+	////////////////////
+
+	/**
+	 * 	@brief find overlap
+	 *
+	 * 	@param k An interval (interval(p, p) for a point).
+	 * 	@return An iterator to the first value, in key order, whose interval
+	 * 	overlaps @p k. end() if none.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	typename interval_map<Key, T, Compare, Alloc>::iterator
+	interval_map<Key, T, Compare, Alloc>::find_overlap(const key_type& k)
+	{
+		Overlap_first first(end());
+
+		tree.visit_overlaps(k, first);
+		return (first.found);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::const_iterator
+	interval_map<Key, T, Compare, Alloc>::find_overlap(const key_type& k) const
+	{ return (const_cast<interval_map*>(this)->find_overlap(k)); }
+
+	/**
+	 * 	@brief count overlaps
+	 *
+	 * 	@param k An interval.
+	 * 	@return The amount of values whose interval overlaps @p k.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	typename interval_map<Key, T, Compare, Alloc>::size_type
+	interval_map<Key, T, Compare, Alloc>::count_overlaps(const key_type& k) const
+	{
+		Overlap_count counter;
+
+		tree.visit_overlaps(k, counter);
+		return (counter.n);
+	}
+
+	/**
+	 * 	@brief for each overlap
+	 *
+	 * 	@param k An interval.
+	 * 	@param f A function called with each value whose interval overlaps
+	 * 	@p k, in key order. The intervals must not be modified.
+	 * 	@return @p f.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename Function>
+	Function
+	interval_map<Key, T, Compare, Alloc>::for_each_overlap(const key_type& k, Function f)
+	{
+		Overlap_apply<Function, reference> apply(f);
+
+		tree.visit_overlaps(k, apply);
+		return (f);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename Function>
+	Function
+	interval_map<Key, T, Compare, Alloc>::for_each_overlap(const key_type& k, Function f) const
+	{
+		Overlap_apply<Function, const_reference> apply(f);
+
+		tree.visit_overlaps(k, apply);
+		return (f);
+	}
+
+	///////////////
+	// Observers //
+	///////////////
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::key_compare
+	interval_map<Key, T, Compare, Alloc>::key_comp() const
+	{ return (tree.key_comp()); }
+
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename interval_map<Key, T, Compare, Alloc>::bound_compare
+	interval_map<Key, T, Compare, Alloc>::bound_comp() const
+	{ return (tree.key_comp().comp); }
+
+	/////////////////
+	// Non members //
+	/////////////////
+
+	//@{
+	/**
+	 * 	@brief Equality
+	 *
+	 * 	@param lhs An %interval_map.
+	 * 	@param rhs An %interval_map of the same type of @p lhs.
+	 * 	@return True if both hold the same values in the same order.
+	*/
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool
+	operator==(const interval_map<Key, T, Compare, Alloc>& lhs, const interval_map<Key, T, Compare, Alloc>& rhs)
+	{ return (lhs.tree == rhs.tree); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool
+	operator!=(const interval_map<Key, T, Compare, Alloc>& lhs, const interval_map<Key, T, Compare, Alloc>& rhs)
+	{ return (!(lhs == rhs)); }
+	//@}
+
+	/**
+	 * 	@brief swap
+	 *
+	 * 	Specilisated version of swap made for %interval_map objects.
+	*/
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline void
+	swap(interval_map<Key, T, Compare, Alloc>& lhs, interval_map<Key, T, Compare, Alloc>& rhs)
+	{ lhs.swap(rhs); }
+};
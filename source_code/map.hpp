@@ -7,7 +7,9 @@
 # pragma once
 
 # include "ft_rbtree.hpp"
+# include "algorithm.hpp"
 # include <functional>
+# include <tuple>
 
 namespace FT_NAMESPACE
 {
@@ -78,11 +80,18 @@ namespace FT_NAMESPACE
 		map(InputIt first, InputIt last);
 		template <typename InputIt>
 		map(InputIt first, InputIt last, const key_compare& comp, const allocator_type& alloc = allocator_type());
+		template <typename InputIt>
+		map(sorted_unique_t, InputIt first, InputIt last, const key_compare& comp = key_compare(),
+			const allocator_type& alloc = allocator_type());
 		map(const map& other);
+		map(map&& other);
 		map&					operator=(const map& other);
+		map&					operator=(map&& other);
+		allocator_type			get_allocator() const;
 
 		/* Element access */
 		mapped_type& 			operator[](const key_type& k);
+		mapped_type& 			operator[](key_type&& k);
 		// TO DO: only 1 operator[] signature ?
 		mapped_type& 			at(const key_type& k); // C++11
 		const mapped_type& 		at(const key_type& k) const; // C++11
@@ -105,9 +114,21 @@ namespace FT_NAMESPACE
 		/* Modifiers */
 		void					clear();
 		::std::pair<iterator, bool>	insert(const_reference pair);
-		iterator				insert(iterator pos, const_reference pair);
+		::std::pair<iterator, bool>	insert(value_type&& pair);
+		iterator				insert(const_iterator pos, const_reference pair);
+		iterator				insert(const_iterator pos, value_type&& pair);
+		template <typename... Args>
+		::std::pair<iterator, bool>	emplace(Args&&... args);
+		template <typename... Args>
+		iterator				emplace_hint(const_iterator pos, Args&&... args);
+		template <typename... Args>
+		::std::pair<iterator, bool>	try_emplace(const key_type& k, Args&&... args);
+		template <typename... Args>
+		::std::pair<iterator, bool>	try_emplace(key_type&& k, Args&&... args);
 		template <typename InputIt>
 		void					insert(InputIt first, InputIt last);
+		template <typename InputIt>
+		void					insert(sorted_unique_t, InputIt first, InputIt last);
 		void 					erase(iterator pos);
 		size_type				erase(const key_type& k);
 		void					erase(iterator first, iterator last);
@@ -115,13 +136,20 @@ namespace FT_NAMESPACE
 
 		/* Lookup */
 		iterator				find(const key_type& k);
+		const_iterator			find(const key_type& k) const;
 		size_type				count(const key_type& k) const;
 		::std::pair<iterator, iterator>	equal_range(const key_type& k);
+		::std::pair<const_iterator, const_iterator>	equal_range(const key_type& k) const;
 		iterator				lower_bound(const key_type& k);
 		const_iterator			lower_bound(const key_type& k) const;
 		iterator				upper_bound(const key_type& k);
 		const_iterator			upper_bound(const key_type& k) const;
 
+		/* Order statistics */
+		iterator				nth(size_type k);
+		const_iterator			nth(size_type k) const;
+		size_type				rank(const key_type& k) const;
+
 		/* Observers */
 		key_compare				key_comp() const;
 		value_compare			value_comp() const;
@@ -184,6 +212,24 @@ namespace FT_NAMESPACE
 	: tree(comp, alloc)
 	{ tree.aux_insert_range_unique(first, last); }
 
+	/**
+	 * 	@brief Sorted Range Constructor
+	 * 
+	 * 	@tparam InputIt An input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 	@param comp A comparison object.
+	 * 	@param alloc An allocator.
+	 *
+	 * 	Create a map filled with copies of @p first - @p last range, in linear time.
+	 * 	NOTE: The range must be sorted with @p comp without equal keys.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename InputIt>
+	map<Key, T, Compare, Alloc>::map(sorted_unique_t, InputIt first, InputIt last, const key_compare& comp, const allocator_type& alloc)
+	: tree(comp, alloc)
+	{ tree.aux_insert_range_unique(sorted_unique_t(), first, last); }
+
 	/**
 	 * 	@brief Copy Constructor
 	 * 
@@ -194,6 +240,16 @@ namespace FT_NAMESPACE
 	: tree(other.tree)
 	{ }
 
+	/**
+	 * 	@brief Move Constructor
+	 * 
+	 * 	@param other A %map of the same type of @c *this, left empty.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	map<Key, T, Compare, Alloc>::map(map&& other)
+	: tree(std::move(other.tree))
+	{ }
+
 	/**
 	 * 	@brief operator=
 	 * 
@@ -207,6 +263,29 @@ namespace FT_NAMESPACE
 		return (*this);
 	}
 
+	/**
+	 * 	@brief operator=
+	 * 
+	 * 	@param other A %map with the same type of @c *this, left empty.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	map<Key, T, Compare, Alloc>&
+	map<Key, T, Compare, Alloc>::operator=(map&& other)
+	{
+		tree = std::move(other.tree);
+		return (*this);
+	}
+
+	/**
+	 * 	@brief get allocator
+	 * 
+	 * 	@return A copy of the allocator used by the %map.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename map<Key, T, Compare, Alloc>::allocator_type
+	map<Key, T, Compare, Alloc>::get_allocator() const
+	{ return (tree.get_allocator()); }
+
 	////////////////////
 	// Element access //
 	////////////////////
@@ -220,16 +299,19 @@ namespace FT_NAMESPACE
 	 * 	in it exist and can perform an insertion.
 	*/
 	template <class Key, class T, class Compare, class Alloc>
-	typename map<Key, T, Compare, Alloc>::mapped_type& 
+	inline typename map<Key, T, Compare, Alloc>::mapped_type& 
 	map<Key, T, Compare, Alloc>::operator[](const key_type& k)
-	{
-		iterator i = lower_bound(k);
+	{ return ((*try_emplace(k).first).second); }
 
-		// If i->first >= k or i is the last insert it and return the inserted data.
-		if (i == end() || key_comp()(k, (*i).first))
-			i = insert(i, value_type(k, mapped_type()));
-		return ((*i).second);
-	}
+	/**
+	 * 	@brief operator[]
+	 * 	
+	 * 	@param k A key search, moved into the %map if it is inserted.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename map<Key, T, Compare, Alloc>::mapped_type& 
+	map<Key, T, Compare, Alloc>::operator[](key_type&& k)
+	{ return ((*try_emplace(std::move(k)).first).second); }
 
 	/**
 	 * 	@brief at
@@ -321,7 +403,7 @@ namespace FT_NAMESPACE
 	template <class Key, class T, class Compare, class Alloc>
 	inline typename map<Key, T, Compare, Alloc>::reverse_iterator
 	map<Key, T, Compare, Alloc>::rbegin()
-	{ return (tree.begin()); }
+	{ return (tree.rbegin()); }
 
 	/**
 	 * 	@brief rbegin
@@ -421,12 +503,111 @@ namespace FT_NAMESPACE
 	 * 	@return An iterator to the inserted value.
 	 * 
 	 * 	Attemps to insert @p pair into %map at @p pos index.
+	 * 	If @p pair goes just before @p pos (or just after it) the position is
+	 * 	found in amortized constant time, logarithmic otherwise: appending
+	 * 	with end() as hint costs a single comparison. With
+	 * 	FT_RBTREE_ORDER_STATISTICS the subtree sizes of the parents are
+	 * 	updated too (logarithmic, no comparison).
 	*/
 	template <class Key, class T, class Compare, class Alloc>
 	inline typename map<Key, T, Compare, Alloc>::iterator
-	map<Key, T, Compare, Alloc>::insert(iterator pos, const_reference pair)
+	map<Key, T, Compare, Alloc>::insert(const_iterator pos, const_reference pair)
 	{ return (tree.aux_insert_unique(pos, pair)); }
 
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param pair A value pair, it is moved.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline ::std::pair<typename map<Key, T, Compare, Alloc>::iterator, bool>
+	map<Key, T, Compare, Alloc>::insert(value_type&& pair)
+	{ return (tree.aux_insert_unique(std::move(pair))); }
+
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param pos An iterator.
+	 * 	@param pair A value pair, it is moved.
+	 * 	@return An iterator to the inserted value.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename map<Key, T, Compare, Alloc>::iterator
+	map<Key, T, Compare, Alloc>::insert(const_iterator pos, value_type&& pair)
+	{ return (tree.aux_insert_unique(pos, std::move(pair))); }
+
+	/**
+	 * 	@brief emplace
+	 * 
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return A pair of an iterator to the element with the same key
+	 * 	and true if the insertion was performed.
+	 * 
+	 * 	The value is constructed in place in a new node, the node is
+	 * 	dropped if its key already exist.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename... Args>
+	inline ::std::pair<typename map<Key, T, Compare, Alloc>::iterator, bool>
+	map<Key, T, Compare, Alloc>::emplace(Args&&... args)
+	{ return (tree.aux_emplace_unique(std::forward<Args>(args)...)); }
+
+	/**
+	 * 	@brief emplace hint
+	 * 
+	 * 	@param pos A hint of the insertion position.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the element with the same key.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename... Args>
+	inline typename map<Key, T, Compare, Alloc>::iterator
+	map<Key, T, Compare, Alloc>::emplace_hint(const_iterator pos, Args&&... args)
+	{ return (tree.aux_emplace_hint_unique(pos, std::forward<Args>(args)...)); }
+
+	/**
+	 * 	@brief try emplace
+	 * 
+	 * 	@param k The key.
+	 * 	@param args The arguments forwarded to the mapped_type constructor.
+	 * 	@return A pair of an iterator to the element with the key @p k
+	 * 	and true if the insertion was performed.
+	 * 
+	 * 	Unlike emplace, nothing is constructed if @p k already exist.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename... Args>
+	::std::pair<typename map<Key, T, Compare, Alloc>::iterator, bool>
+	map<Key, T, Compare, Alloc>::try_emplace(const key_type& k, Args&&... args)
+	{
+		iterator i = lower_bound(k);
+
+		// If i->first >= k or i is the last insert it and return the inserted data.
+		if (i == end() || key_comp()(k, (*i).first))
+			return (::std::pair<iterator, bool>(tree.aux_emplace_hint_unique(i, ::std::piecewise_construct,
+			::std::forward_as_tuple(k), ::std::forward_as_tuple(std::forward<Args>(args)...)), true));
+		return (::std::pair<iterator, bool>(i, false));
+	}
+
+	/**
+	 * 	@brief try emplace
+	 * 
+	 * 	@param k The key, moved into the %map if it is inserted.
+	 * 	@param args The arguments forwarded to the mapped_type constructor.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename... Args>
+	::std::pair<typename map<Key, T, Compare, Alloc>::iterator, bool>
+	map<Key, T, Compare, Alloc>::try_emplace(key_type&& k, Args&&... args)
+	{
+		iterator i = lower_bound(k);
+
+		if (i == end() || key_comp()(k, (*i).first))
+			return (::std::pair<iterator, bool>(tree.aux_emplace_hint_unique(i, ::std::piecewise_construct,
+			::std::forward_as_tuple(std::move(k)), ::std::forward_as_tuple(std::forward<Args>(args)...)), true));
+		return (::std::pair<iterator, bool>(i, false));
+	}
+
 	/**
 	 * 	@brief insert
 	 * 
@@ -442,6 +623,22 @@ namespace FT_NAMESPACE
 	map<Key, T, Compare, Alloc>::insert(InputIt first, InputIt last)
 	{ tree.aux_insert_range_unique(first, last); }
 
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@tparam InputIt an input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 
+	 * 	Inserts the sorted range @p first - @p last (without equal keys),
+	 * 	if @c *this is empty it is built in linear time.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename InputIt>
+	inline void
+	map<Key, T, Compare, Alloc>::insert(sorted_unique_t, InputIt first, InputIt last)
+	{ tree.aux_insert_range_unique(sorted_unique_t(), first, last); }
+
 	/**
 	 * 	@brief erase
 	 * 
@@ -507,6 +704,18 @@ namespace FT_NAMESPACE
 	map<Key, T, Compare, Alloc>::find(const key_type& k)
 	{ return (tree.find(k)); }
 
+	/**
+	 * 	@brief find
+	 * 
+	 * 	@param k The key of the pair to find.
+	 * 
+	 * 	@return A const iterator pointing to the pair maching with @p k key.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename map<Key, T, Compare, Alloc>::const_iterator
+	map<Key, T, Compare, Alloc>::find(const key_type& k) const
+	{ return (tree.find(k)); }
+
 	/**
 	 * 	@brief find
 	 * 
@@ -531,6 +740,18 @@ namespace FT_NAMESPACE
 	map<Key, T, Compare, Alloc>::equal_range(const key_type& k)
 	{ return (tree.equal_range(k)); }
 
+	/**
+	 * 	@brief equal_range
+	 * 
+	 * 	@param k A key.
+	 * 
+	 * 	@return A pair of const iterators pointing to the maching @p k value.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline ::std::pair<typename map<Key, T, Compare, Alloc>::const_iterator, typename map<Key, T, Compare, Alloc>::const_iterator>
+	map<Key, T, Compare, Alloc>::equal_range(const key_type& k) const
+	{ return (tree.equal_range(k)); }
+
 	/**
 	 * 	@brief lower_bound
 	 * 
@@ -583,6 +804,50 @@ namespace FT_NAMESPACE
 	map<Key, T, Compare, Alloc>::upper_bound(const key_type& k) const
 	{ return (tree.upper_bound(k)); }
 
+	//////////////////////
+	// Order statistics //
+	//////////////////////
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return An iterator to the @p k th element in key order (from 0),
+	 * 	end() if @p k isn't less than size().
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename map<Key, T, Compare, Alloc>::iterator
+	map<Key, T, Compare, Alloc>::nth(size_type k)
+	{ return (tree.nth(k)); }
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return A const iterator to the @p k th element in key order.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename map<Key, T, Compare, Alloc>::const_iterator
+	map<Key, T, Compare, Alloc>::nth(size_type k) const
+	{ return (tree.nth(k)); }
+
+	/**
+	 * 	@brief rank
+	 * 
+	 * 	@param k A key.
+	 * 
+	 * 	@return The amount of elements with a key less than @p k.
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	 * 	ft::distance() between two iterators is logarithmic too.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename map<Key, T, Compare, Alloc>::size_type
+	map<Key, T, Compare, Alloc>::rank(const key_type& k) const
+	{ return (tree.rank(k)); }
+
 	///////////////
 	// Observers //
 	///////////////
@@ -0,0 +1,541 @@
+/** @file mpmc_queue.hpp
+ *
+ * 	This file contains the bounded multi producer multi consumer queue.
+*/
+
+# pragma once
+
+# include <ft_allocator.hpp>
+
+# include <atomic>
+# include <new>
+# include <thread>
+# include <climits>
+# include <cstdint>
+
+# ifdef __linux__
+#  include <unistd.h>
+#  include <sys/syscall.h>
+#  include <linux/futex.h>
+# endif
+
+/**
+ * 	@brief MPMC queue MACROS
+ *
+ * 	- FT_QUEUE_SPIN_COUNT: The amount of tries (yielding between them) of
+ * 	a blocking push/pop before sleeping.
+ *
+ * 	It is overwritable if needed.
+*/
+#ifndef FT_QUEUE_SPIN_COUNT
+# define FT_QUEUE_SPIN_COUNT 0x40
+#endif
+
+namespace FT_NAMESPACE
+{
+	/**
+	 * 	@brief Futex wait
+	 *
+	 * 	@param addr The watched word.
+	 * 	@param expected The value of @p addr before sleeping.
+	 *
+	 * 	Sleeps while *@p addr == @p expected (can wake up spuriously).
+	 * 	NOTE: Yields outside linux.
+	*/
+	inline void
+	aux_futex_wait(std::atomic<int>* addr, int expected)
+	throw()
+	{
+# ifdef __linux__
+		syscall(SYS_futex, reinterpret_cast<int*>(addr), FUTEX_WAIT_PRIVATE, expected, 0, 0, 0);
+# else
+		if (addr->load(std::memory_order_relaxed) == expected)
+			std::this_thread::yield();
+# endif
+	}
+
+	/**
+	 * 	@brief Futex wake
+	 *
+	 * 	@param addr The watched word.
+	 * 	@param n The maximum amount of threads woken up.
+	*/
+	inline void
+	aux_futex_wake(std::atomic<int>* addr, int n)
+	throw()
+	{
+# ifdef __linux__
+		syscall(SYS_futex, reinterpret_cast<int*>(addr), FUTEX_WAKE_PRIVATE, n, 0, 0, 0);
+# else
+		(void)addr;
+		(void)n;
+# endif
+	}
+
+	/**
+	 * 	@brief Bounded multi producer multi consumer queue
+	 *
+	 * 	@tparam T The type holded by the queue.
+	 * 	@tparam Allocator An allocator type.
+	 *
+	 * 	A fixed capacity ring (power of two) usable by any amount of threads
+	 * 	without lock. Each slot has a sequence number:
+	 *
+	 * 	- sequence == pos: The slot is free for the push at counter pos.
+	 * 	- sequence == pos + 1: The slot holds the element pushed at pos.
+	 *
+	 * 	A push (a pop) claims a counter with a CAS on %enqueue_pos (%dequeue_pos),
+	 * 	then publishes the slot by storing its next sequence number. Producers and
+	 * 	consumers only meet on the slot they use, there is no global lock.
+	 *
+	 * 	try_push/try_pop fail at once when the queue is full/empty. The blocking
+	 * 	push/pop spin FT_QUEUE_SPIN_COUNT times, then sleep on a futex until the
+	 * 	other side makes progress. A push/pop only pays a futex syscall when a
+	 * 	thread sleeps on the other side, and never a fence.
+	 *
+	 * 	Same interface as %queue: push, pop, front, size, empty.
+	*/
+	template <class T, class Allocator = allocator<T> >
+	class mpmc_queue
+	{
+		/* Member types */
+
+		public:
+
+		typedef T					value_type;
+		typedef Allocator			allocator_type;
+		typedef std::size_t			size_type;
+		typedef value_type&			reference;
+		typedef const value_type&	const_reference;
+
+		private:
+
+		/* A slot of the ring */
+		struct Slot
+		{
+			std::atomic<size_type>						sequence;
+			alignas(T) unsigned char					storage[sizeof(T)];
+
+			T*	get() { return (reinterpret_cast<T*>(storage)); }
+		};
+
+		typedef typename Allocator::template rebind<Slot>::other	Slot_allocator;
+
+		/* Core:
+		 *
+		 * enqueue_pos -> The counter of the next push.
+		 * dequeue_pos -> The counter of the next pop.
+		 * buff, mask -> The ring of @c mask + 1 slots, read only.
+		 * items, slots -> Futex words, changed when an element (a slot) is
+		 * released while threads sleep.
+		 * waiting_consumers, waiting_producers -> The amount of sleeping threads.
+		*/
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<size_type>	enqueue_pos;
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<size_type>	dequeue_pos;
+		alignas(FT_CACHE_LINE_SIZE) Slot*					buff;
+		size_type											mask;
+		allocator_type										memory;
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<int>		items;
+		std::atomic<int>									waiting_consumers;
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<int>		slots;
+		std::atomic<int>									waiting_producers;
+
+		/* Not copyable: all the threads use the object */
+		mpmc_queue(const mpmc_queue&);
+		mpmc_queue&		operator=(const mpmc_queue&);
+
+		/* Auxiliar functions */
+
+		void			mq_notify(std::atomic<int>& word, std::atomic<int>& waiting) throw();
+		bool			mq_claimed_empty() const throw();
+		bool			mq_claimed_full() const throw();
+
+		/* Member functions */
+
+		public:
+
+		explicit mpmc_queue(size_type capacity, const allocator_type& alloc = allocator_type());
+		~mpmc_queue();
+
+		/* Capacity */
+		size_type		capacity() const;
+		size_type		size() const;
+		bool			empty() const;
+
+		/* Element access */
+		reference		front();
+
+		/* Modifiers */
+		bool			try_push(const_reference value);
+		bool			try_push(value_type&& value);
+		template <typename... Args>
+		bool			try_emplace(Args&&... args);
+		bool			try_pop(reference value);
+		void			push(const_reference value);
+		void			push(value_type&& value);
+		void			pop(reference value);
+		void			pop();
+	};
+
+	////////////////////////
+	// Auxiliar functions //
+	////////////////////////
+
+	/**
+	 * 	@brief Notify
+	 *
+	 * 	@param word The futex word of the sleeping side.
+	 * 	@param waiting The amount of threads sleeping on @p word.
+	 *
+	 * 	Wakes up a sleeping thread, does nothing (no syscall) if there's none.
+	 *
+	 * 	There's no fence: the claim CAS of the caller and the registration of
+	 * 	a sleeper are both seq_cst. Either this load sees the sleeper, or the
+	 * 	sleeper sees the claimed counter and retries instead of sleeping (see:
+	 * 	mq_claimed_empty, mq_claimed_full).
+	*/
+	template <class T, class Allocator>
+	inline void
+	mpmc_queue<T, Allocator>::mq_notify(std::atomic<int>& word, std::atomic<int>& waiting)
+	throw()
+	{
+		if (waiting.load(std::memory_order_seq_cst))
+		{
+			word.fetch_add(1, std::memory_order_seq_cst);
+			aux_futex_wake(&word, INT_MAX);
+		}
+	}
+
+	/**
+	 * 	@brief Claimed empty
+	 *
+	 * 	@return True if every claimed push has been claimed by a pop too.
+	 *
+	 * 	Checked by a registered consumer before it sleeps: a push claimed but
+	 * 	not published yet makes it retry, the producer may have missed it.
+	*/
+	template <class T, class Allocator>
+	inline bool
+	mpmc_queue<T, Allocator>::mq_claimed_empty() const
+	throw()
+	{
+		const size_type first = dequeue_pos.load(std::memory_order_seq_cst);
+
+		return (enqueue_pos.load(std::memory_order_seq_cst) == first);
+	}
+
+	/**
+	 * 	@brief Claimed full
+	 *
+	 * 	@return True if the claimed pushes fill the ring, counting the pops
+	 * 	claimed but not released yet as done.
+	 *
+	 * 	Checked by a registered producer before it sleeps, as mq_claimed_empty.
+	*/
+	template <class T, class Allocator>
+	inline bool
+	mpmc_queue<T, Allocator>::mq_claimed_full() const
+	throw()
+	{
+		const size_type first = dequeue_pos.load(std::memory_order_seq_cst);
+
+		return (enqueue_pos.load(std::memory_order_seq_cst) - first > mask);
+	}
+
+	//////////////////////
+	// Member functions //
+	//////////////////////
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param capacity The capacity, rounded up to a power of two (at least 2).
+	 * 	@param alloc An allocator type.
+	*/
+	template <class T, class Allocator>
+	mpmc_queue<T, Allocator>::mpmc_queue(size_type capacity, const allocator_type& alloc)
+	: enqueue_pos(0), dequeue_pos(0), buff(), mask(2), memory(alloc),
+	items(0), waiting_consumers(0), slots(0), waiting_producers(0)
+	{
+		while (mask < capacity)
+			mask <<= 1;
+		buff = Slot_allocator(memory).allocate(mask);
+		for (size_type i = 0 ; i < mask ; i++)
+			::new(static_cast<void*>(&buff[i].sequence)) std::atomic<size_type>(i);
+		mask--;
+	}
+
+	/**
+	 * 	@brief Destructor
+	 *
+	 * 	Destroys the elements not popped. No thread may use the queue.
+	*/
+	template <class T, class Allocator>
+	mpmc_queue<T, Allocator>::~mpmc_queue()
+	{
+		const size_type last = enqueue_pos.load(std::memory_order_acquire);
+
+		for (size_type pos = dequeue_pos.load(std::memory_order_acquire) ; pos != last ; pos++)
+			memory.destroy(buff[pos & mask].get());
+		for (size_type i = 0 ; i <= mask ; i++)
+			buff[i].sequence.~atomic();
+		Slot_allocator(memory).deallocate(buff, mask + 1);
+	}
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	template <class T, class Allocator>
+	inline typename mpmc_queue<T, Allocator>::size_type
+	mpmc_queue<T, Allocator>::capacity() const
+	{ return (mask + 1); }
+
+	/**
+	 * 	@brief size
+	 *
+	 * 	@return The amount of elements, only a snapshot while other threads work.
+	*/
+	template <class T, class Allocator>
+	inline typename mpmc_queue<T, Allocator>::size_type
+	mpmc_queue<T, Allocator>::size() const
+	{
+		const size_type first = dequeue_pos.load(std::memory_order_acquire);
+		const size_type last = enqueue_pos.load(std::memory_order_acquire);
+
+		/* A pop can be seen before the push it took */
+		return (last > first ? last - first : 0);
+	}
+
+	template <class T, class Allocator>
+	inline bool
+	mpmc_queue<T, Allocator>::empty() const
+	{ return (size() == 0); }
+
+	////////////////////
+	// Element access //
+	////////////////////
+
+	/**
+	 * 	@brief front
+	 *
+	 * 	@return The oldest element, the queue must not be empty.
+	 *
+	 * 	NOTE: Only meaningful when no other thread pops (single consumer).
+	*/
+	template <class T, class Allocator>
+	inline typename mpmc_queue<T, Allocator>::reference
+	mpmc_queue<T, Allocator>::front()
+	{ return (*buff[dequeue_pos.load(std::memory_order_acquire) & mask].get()); }
+
+	///////////////
+	// Modifiers //
+	///////////////
+
+	template <class T, class Allocator>
+	inline bool
+	mpmc_queue<T, Allocator>::try_push(const_reference value)
+	{ return (try_emplace(value)); }
+
+	template <class T, class Allocator>
+	inline bool
+	mpmc_queue<T, Allocator>::try_push(value_type&& value)
+	{ return (try_emplace(std::move(value))); }
+
+	/**
+	 * 	@brief try emplace
+	 *
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return False if the queue is full (@p args are then untouched).
+	*/
+	template <class T, class Allocator>
+	template <typename... Args>
+	bool
+	mpmc_queue<T, Allocator>::try_emplace(Args&&... args)
+	{
+		size_type	pos = enqueue_pos.load(std::memory_order_relaxed);
+		Slot*		slot;
+
+		for (;;)
+		{
+			slot = buff + (pos & mask);
+
+			const std::intptr_t diff = std::intptr_t(slot->sequence.load(std::memory_order_acquire))
+			- std::intptr_t(pos);
+
+			/* The slot is free: claim it */
+			if (diff == 0)
+			{
+				if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed))
+					break ;
+			}
+			/* The slot still holds the element of the previous lap: full */
+			else if (diff < 0)
+				return (false);
+			/* Another producer claimed it */
+			else
+				pos = enqueue_pos.load(std::memory_order_relaxed);
+		}
+		memory.construct(slot->get(), std::forward<Args>(args)...);
+		slot->sequence.store(pos + 1, std::memory_order_release);
+		mq_notify(items, waiting_consumers);
+		return (true);
+	}
+
+	/**
+	 * 	@brief try pop
+	 *
+	 * 	@param value Receives the oldest element.
+	 * 	@return False if the queue is empty.
+	*/
+	template <class T, class Allocator>
+	bool
+	mpmc_queue<T, Allocator>::try_pop(reference value)
+	{
+		size_type	pos = dequeue_pos.load(std::memory_order_relaxed);
+		Slot*		slot;
+
+		for (;;)
+		{
+			slot = buff + (pos & mask);
+
+			const std::intptr_t diff = std::intptr_t(slot->sequence.load(std::memory_order_acquire))
+			- std::intptr_t(pos + 1);
+
+			/* The slot holds the element: claim it */
+			if (diff == 0)
+			{
+				if (dequeue_pos.compare_exchange_weak(pos, pos + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed))
+					break ;
+			}
+			/* The slot is not published yet: empty */
+			else if (diff < 0)
+				return (false);
+			/* Another consumer claimed it */
+			else
+				pos = dequeue_pos.load(std::memory_order_relaxed);
+		}
+		value = std::move(*slot->get());
+		memory.destroy(slot->get());
+		/* Free for the push of the next lap */
+		slot->sequence.store(pos + mask + 1, std::memory_order_release);
+		mq_notify(slots, waiting_producers);
+		return (true);
+	}
+
+	/**
+	 * 	@brief push
+	 *
+	 * 	@param value The pushed value.
+	 *
+	 * 	Spins, then sleeps while the queue is full.
+	*/
+	template <class T, class Allocator>
+	void
+	mpmc_queue<T, Allocator>::push(const_reference value)
+	{
+		for (int i = 0 ; i < FT_QUEUE_SPIN_COUNT ; i++)
+		{
+			if (try_push(value))
+				return ;
+			std::this_thread::yield();
+		}
+		for (;;)
+		{
+			const int epoch = slots.load(std::memory_order_seq_cst);
+
+			/* Registered before the last try: a pop after it will wake us up */
+			waiting_producers.fetch_add(1, std::memory_order_seq_cst);
+			if (try_push(value))
+			{
+				waiting_producers.fetch_sub(1, std::memory_order_relaxed);
+				return ;
+			}
+			if (mq_claimed_full())
+				aux_futex_wait(&slots, epoch);
+			else
+				std::this_thread::yield();
+			waiting_producers.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	template <class T, class Allocator>
+	void
+	mpmc_queue<T, Allocator>::push(value_type&& value)
+	{
+		for (int i = 0 ; i < FT_QUEUE_SPIN_COUNT ; i++)
+		{
+			if (try_push(std::move(value)))
+				return ;
+			std::this_thread::yield();
+		}
+		for (;;)
+		{
+			const int epoch = slots.load(std::memory_order_seq_cst);
+
+			waiting_producers.fetch_add(1, std::memory_order_seq_cst);
+			if (try_push(std::move(value)))
+			{
+				waiting_producers.fetch_sub(1, std::memory_order_relaxed);
+				return ;
+			}
+			if (mq_claimed_full())
+				aux_futex_wait(&slots, epoch);
+			else
+				std::this_thread::yield();
+			waiting_producers.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * 	@brief pop
+	 *
+	 * 	@param value Receives the oldest element.
+	 *
+	 * 	Spins, then sleeps while the queue is empty.
+	*/
+	template <class T, class Allocator>
+	void
+	mpmc_queue<T, Allocator>::pop(reference value)
+	{
+		for (int i = 0 ; i < FT_QUEUE_SPIN_COUNT ; i++)
+		{
+			if (try_pop(value))
+				return ;
+			std::this_thread::yield();
+		}
+		for (;;)
+		{
+			const int epoch = items.load(std::memory_order_seq_cst);
+
+			/* Registered before the last try: a push after it will wake us up */
+			waiting_consumers.fetch_add(1, std::memory_order_seq_cst);
+			if (try_pop(value))
+			{
+				waiting_consumers.fetch_sub(1, std::memory_order_relaxed);
+				return ;
+			}
+			if (mq_claimed_empty())
+				aux_futex_wait(&items, epoch);
+			else
+				std::this_thread::yield();
+			waiting_consumers.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * 	@brief pop
+	 *
+	 * 	Removes the oldest element, waits while the queue is empty.
+	*/
+	template <class T, class Allocator>
+	inline void
+	mpmc_queue<T, Allocator>::pop()
+	{
+		value_type tmp;
+
+		pop(tmp);
+	}
+};
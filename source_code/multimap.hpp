@@ -6,6 +6,7 @@
 # pragma once
 
 # include "ft_rbtree.hpp"
+# include "algorithm.hpp"
 # include <functional>
 
 namespace FT_NAMESPACE
@@ -16,7 +17,7 @@ namespace FT_NAMESPACE
 	 * 	TO DO
 	*/
 	template <typename Key, typename T, typename Compare = ::std::less<Key>,
-	typename Alloc = allocator<::std::pair<const Key, Key>>>
+	typename Alloc = allocator<::std::pair<const Key, T>>>
 	class multimap
 	{
 		/* Member types */
@@ -55,7 +56,7 @@ namespace FT_NAMESPACE
 		/* value compare class, used for comparison */
 		struct value_compare : public std::binary_function<value_type, value_type, bool>
 		{
-			friend class map<key_type, value_type, key_compare, allocator_type>;
+			friend class multimap<key_type, mapped_type, key_compare, allocator_type>;
 
 			protected:
 
@@ -78,19 +79,25 @@ namespace FT_NAMESPACE
 		multimap(InputIt first, InputIt last);
 		template <typename InputIt>
 		multimap(InputIt first, InputIt last, const key_compare& comp, const allocator_type& alloc = allocator_type());
+		template <typename InputIt>
+		multimap(sorted_equivalent_t, InputIt first, InputIt last, const key_compare& comp = key_compare(),
+			const allocator_type& alloc = allocator_type());
 		multimap(const multimap& other);
+		multimap(multimap&& other);
 
 		multimap&		operator=(const multimap& other);
+		multimap&		operator=(multimap&& other);
+		allocator_type	get_allocator() const;
 
 		/* Iterators */
-		iterator		begin();
-		const_iterator	begin() const;
-		iterator		end();
-		const_iterator	end() const;
-		iterator		rbegin();
-		const_iterator	rbegin() const;
-		iterator		rend();
-		const_iterator	rend() const;
+		iterator				begin();
+		const_iterator			begin() const;
+		iterator				end();
+		const_iterator			end() const;
+		reverse_iterator		rbegin();
+		const_reverse_iterator	rbegin() const;
+		reverse_iterator		rend();
+		const_reverse_iterator	rend() const;
 
 		/* Capacity */
 		bool			empty() const;
@@ -100,9 +107,17 @@ namespace FT_NAMESPACE
 		/* Modifiers */
 		void			clear();
 		iterator		insert(const_reference pair);
-		iterator		insert(iterator pos, const_reference pair);
+		iterator		insert(value_type&& pair);
+		iterator		insert(const_iterator pos, const_reference pair);
+		iterator		insert(const_iterator pos, value_type&& pair);
+		template <typename... Args>
+		iterator		emplace(Args&&... args);
+		template <typename... Args>
+		iterator		emplace_hint(const_iterator pos, Args&&... args);
 				template <typename InputIt>
 		void			insert(InputIt first, InputIt last);
+		template <typename InputIt>
+		void			insert(sorted_equivalent_t, InputIt first, InputIt last);
 
 		void 			erase(iterator pos);
 		size_type		erase(const key_type& k);
@@ -111,13 +126,20 @@ namespace FT_NAMESPACE
 
 		/* Lookup */
 		iterator		find(const key_type& k);
+		const_iterator	find(const key_type& k) const;
 		size_type		count(const key_type& k) const;
 		::std::pair<iterator, iterator>	equal_range(const key_type& k);
+		::std::pair<const_iterator, const_iterator>	equal_range(const key_type& k) const;
 		iterator		lower_bound(const key_type& k);
 		const_iterator	lower_bound(const key_type& k) const;
 		iterator		upper_bound(const key_type& k);
 		const_iterator	upper_bound(const key_type& k) const;
 		
+		/* Order statistics */
+		iterator		nth(size_type k);
+		const_iterator	nth(size_type k) const;
+		size_type		rank(const key_type& k) const;
+
 		/* Observers */
 		key_compare		key_comp() const;
 		value_compare	value_comp() const;
@@ -181,6 +203,24 @@ namespace FT_NAMESPACE
 	: tree(comp, alloc)
 	{ tree.aux_insert_range_equal(first, last); }
 
+	/**
+	 * 	@brief Sorted Range Constructor
+	 * 
+	 * 	@tparam InputIt An input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 	@param comp A comparison object.
+	 * 	@param alloc An allocator.
+	 *
+	 * 	Create a multimap filled with copies of @p first - @p last range, in linear time.
+	 * 	NOTE: The range must be sorted with @p comp.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename InputIt>
+	multimap<Key, T, Compare, Alloc>::multimap(sorted_equivalent_t, InputIt first, InputIt last, const key_compare& comp, const allocator_type& alloc)
+	: tree(comp, alloc)
+	{ tree.aux_insert_range_equal(sorted_equivalent_t(), first, last); }
+
 	/**
 	 * 	@brief Copy Constructor
 	 * 
@@ -191,6 +231,16 @@ namespace FT_NAMESPACE
 	: tree(other.tree)
 	{ }
 
+	/**
+	 * 	@brief Move Constructor
+	 * 
+	 * 	@param other A %multimap of the same type of @c *this, left empty.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	multimap<Key, T, Compare, Alloc>::multimap(multimap&& other)
+	: tree(std::move(other.tree))
+	{ }
+
 	/**
 	 * 	@brief operator=
 	 * 
@@ -204,6 +254,29 @@ namespace FT_NAMESPACE
 		return (*this);
 	}
 
+	/**
+	 * 	@brief operator=
+	 * 
+	 * 	@param other A %multimap with the same type of @c *this, left empty.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	multimap<Key, T, Compare, Alloc>&
+	multimap<Key, T, Compare, Alloc>::operator=(multimap&& other)
+	{
+		tree = std::move(other.tree);
+		return (*this);
+	}
+
+	/**
+	 * 	@brief get allocator
+	 * 
+	 * 	@return A copy of the allocator used by the %multimap.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename multimap<Key, T, Compare, Alloc>::allocator_type
+	multimap<Key, T, Compare, Alloc>::get_allocator() const
+	{ return (tree.get_allocator()); }
+
 	///////////////
 	// Iterators //
 	///////////////
@@ -254,9 +327,9 @@ namespace FT_NAMESPACE
 	 * 	@return A reverse iterator to the first element holded by %multimap.
 	*/
 	template <class Key, class T, class Compare, class Alloc>
-	inline typename multimap<Key, T, Compare, Alloc>::iterator
+	inline typename multimap<Key, T, Compare, Alloc>::reverse_iterator
 	multimap<Key, T, Compare, Alloc>::rbegin()
-	{ return (tree.begin()); }
+	{ return (tree.rbegin()); }
 
 	/**
 	 * 	@brief bregin
@@ -264,7 +337,7 @@ namespace FT_NAMESPACE
 	 * 	@return A const reverse iterator to the first element holded by %multimap.
 	*/
 	template <class Key, class T, class Compare, class Alloc>
-	inline typename multimap<Key, T, Compare, Alloc>::const_iterator
+	inline typename multimap<Key, T, Compare, Alloc>::const_reverse_iterator
 	multimap<Key, T, Compare, Alloc>::rbegin() const
 	{ return (tree.rbegin()); }
 
@@ -274,7 +347,7 @@ namespace FT_NAMESPACE
 	 * 	@return A reverse iterator to the last element holded by %multimap.
 	*/
 	template <class Key, class T, class Compare, class Alloc>
-	inline typename multimap<Key, T, Compare, Alloc>::iterator
+	inline typename multimap<Key, T, Compare, Alloc>::reverse_iterator
 	multimap<Key, T, Compare, Alloc>::rend()
 	{ return (tree.rend()); }
 
@@ -284,7 +357,7 @@ namespace FT_NAMESPACE
 	 * 	@return A const reverse iterator to the last element holded by %multimap.
 	*/
 	template <class Key, class T, class Compare, class Alloc>
-	inline typename multimap<Key, T, Compare, Alloc>::const_iterator
+	inline typename multimap<Key, T, Compare, Alloc>::const_reverse_iterator
 	multimap<Key, T, Compare, Alloc>::rend() const
 	{ return (tree.rend()); }
 
@@ -356,12 +429,62 @@ namespace FT_NAMESPACE
 	 * 	@return An iterator to the inserted value.
 	 * 
 	 * 	Attemps to insert @p pair into %mmultiap at @p pos index.
+	 * 	If @p pair goes just before @p pos (or just after it) the position is
+	 * 	found in amortized constant time, logarithmic otherwise.
 	*/
 	template <class Key, class T, class Compare, class Alloc>
 	inline typename multimap<Key, T, Compare, Alloc>::iterator
-	multimap<Key, T, Compare, Alloc>::insert(iterator pos, const_reference pair)
+	multimap<Key, T, Compare, Alloc>::insert(const_iterator pos, const_reference pair)
 	{ return (tree.aux_insert_equal(pos, pair)); }
 
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param pair The value to be inserted, it is moved.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename multimap<Key, T, Compare, Alloc>::iterator
+	multimap<Key, T, Compare, Alloc>::insert(value_type&& pair)
+	{ return (tree.aux_insert_equal(std::move(pair))); }
+
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param pos A hint of the insertion position.
+	 * 	@param pair The value to be inserted, it is moved.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename multimap<Key, T, Compare, Alloc>::iterator
+	multimap<Key, T, Compare, Alloc>::insert(const_iterator pos, value_type&& pair)
+	{ return (tree.aux_insert_equal(pos, std::move(pair))); }
+
+	/**
+	 * 	@brief emplace
+	 * 
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the emplaced value.
+	 * 
+	 * 	The value is constructed in place in a new node.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename... Args>
+	inline typename multimap<Key, T, Compare, Alloc>::iterator
+	multimap<Key, T, Compare, Alloc>::emplace(Args&&... args)
+	{ return (tree.aux_emplace_equal(std::forward<Args>(args)...)); }
+
+	/**
+	 * 	@brief emplace hint
+	 * 
+	 * 	@param pos A hint of the insertion position.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the emplaced value.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename... Args>
+	inline typename multimap<Key, T, Compare, Alloc>::iterator
+	multimap<Key, T, Compare, Alloc>::emplace_hint(const_iterator pos, Args&&... args)
+	{ return (tree.aux_emplace_hint_equal(pos, std::forward<Args>(args)...)); }
+
 	/**
 	 * 	@brief insert
 	 * 
@@ -377,6 +500,22 @@ namespace FT_NAMESPACE
 	multimap<Key, T, Compare, Alloc>::insert(InputIt first, InputIt last)
 	{ tree.aux_insert_range_equal(first, last); }
 
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@tparam InputIt an input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 
+	 * 	Inserts the sorted range @p first - @p last, if @c *this is empty
+	 * 	it is built in linear time.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	template <typename InputIt>
+	inline void
+	multimap<Key, T, Compare, Alloc>::insert(sorted_equivalent_t, InputIt first, InputIt last)
+	{ tree.aux_insert_range_equal(sorted_equivalent_t(), first, last); }
+
 	/**
 	 * 	@brief erase
 	 * 
@@ -442,6 +581,30 @@ namespace FT_NAMESPACE
 	multimap<Key, T, Compare, Alloc>::find(const key_type& k)
 	{ return (tree.find(k)); }
 
+	/**
+	 * 	@brief find
+	 * 
+	 * 	@param k The key of the pair to find.
+	 * 
+	 * 	@return A const iterator pointing to the pair maching with @p k key.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename multimap<Key, T, Compare, Alloc>::const_iterator
+	multimap<Key, T, Compare, Alloc>::find(const key_type& k) const
+	{ return (tree.find(k)); }
+
+	/**
+	 * 	@brief count
+	 * 
+	 * 	@param k A key.
+	 * 
+	 * 	@return The the amount of elements maching with the given key @p k.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename multimap<Key, T, Compare, Alloc>::size_type
+	multimap<Key, T, Compare, Alloc>::count(const key_type& k) const
+	{ return (tree.count(k)); }
+
 	/**
 	 * 	@brief equal_range
 	 * 
@@ -454,6 +617,18 @@ namespace FT_NAMESPACE
 	multimap<Key, T, Compare, Alloc>::equal_range(const key_type& k)
 	{ return (tree.equal_range(k)); }
 
+	/**
+	 * 	@brief equal_range
+	 * 
+	 * 	@param k A key.
+	 * 
+	 * 	@return A pair of const iterators pointing to the maching @p k value.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline ::std::pair<typename multimap<Key, T, Compare, Alloc>::const_iterator, typename multimap<Key, T, Compare, Alloc>::const_iterator>
+	multimap<Key, T, Compare, Alloc>::equal_range(const key_type& k) const
+	{ return (tree.equal_range(k)); }
+
 	/**
 	 * 	@brief lower_bound
 	 * 
@@ -506,6 +681,50 @@ namespace FT_NAMESPACE
 	multimap<Key, T, Compare, Alloc>::upper_bound(const key_type& k) const
 	{ return (tree.upper_bound(k)); }
 
+	//////////////////////
+	// Order statistics //
+	//////////////////////
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return An iterator to the @p k th element in key order (from 0),
+	 * 	end() if @p k isn't less than size().
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename multimap<Key, T, Compare, Alloc>::iterator
+	multimap<Key, T, Compare, Alloc>::nth(size_type k)
+	{ return (tree.nth(k)); }
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return A const iterator to the @p k th element in key order.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename multimap<Key, T, Compare, Alloc>::const_iterator
+	multimap<Key, T, Compare, Alloc>::nth(size_type k) const
+	{ return (tree.nth(k)); }
+
+	/**
+	 * 	@brief rank
+	 * 
+	 * 	@param k A key.
+	 * 
+	 * 	@return The amount of elements with a key less than @p k.
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	 * 	ft::distance() between two iterators is logarithmic too.
+	*/
+	template <class Key, class T, class Compare, class Alloc>
+	inline typename multimap<Key, T, Compare, Alloc>::size_type
+	multimap<Key, T, Compare, Alloc>::rank(const key_type& k) const
+	{ return (tree.rank(k)); }
+
 	///////////////
 	// Observers //
 	///////////////
@@ -6,6 +6,7 @@
 # pragma once
 
 # include <ft_rbtree.hpp>
+# include <algorithm.hpp>
 # include <ft_allocator.hpp>
 
 namespace FT_NAMESPACE
@@ -18,8 +19,7 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Supports bidirectional iterators.
 	*/
-	template <typename Key, typename Compare, typename Alloc = allocator<Key>>
-	// TO DO Compare is init by default
+	template <typename Key, typename Compare = ::std::less<Key>, typename Alloc = allocator<Key>>
 	class multiset
 	{
 		/* Member types */
@@ -49,12 +49,13 @@ namespace FT_NAMESPACE
 		typedef typename Tree::pointer			pointer;
 		typedef typename Tree::const_pointer	const_pointer;
 		typedef typename Tree::size_type		size_type;
-		typedef typename Tree::difference_type	difference_type;
+		typedef typename Tree::difference_size	difference_type;
 
-		typedef typename Tree::iterator			iterator;
+		/* The keys are read only: iterator is a const iterator */
+		typedef typename Tree::const_iterator	iterator;
 		typedef typename Tree::const_iterator	const_iterator;
 
-		typedef typename Tree::reverse_iterator			reverse_iterator;
+		typedef typename Tree::const_reverse_iterator	reverse_iterator;
 		typedef typename Tree::const_reverse_iterator	const_reverse_iterator;
 
 		/* Member functions */
@@ -65,15 +66,21 @@ namespace FT_NAMESPACE
 		multiset(InputIt first, InputIt last);
 		template <typename InputIt>
 		multiset(InputIt first, InputIt last, const value_compare& cmp, const allocator_type& alloc = allocator_type());
+		template <typename InputIt>
+		multiset(sorted_equivalent_t, InputIt first, InputIt last, const value_compare& cmp = value_compare(),
+			const allocator_type& alloc = allocator_type());
 		multiset(const multiset& other);
+		multiset(multiset&& other);
 
 		multiset&		operator=(const multiset& other);
+		multiset&		operator=(multiset&& other);
+		allocator_type	get_allocator() const;
 
 		/* Iterators */
 		iterator		begin() const;
 		iterator 		end() const;
-		iterator		rbegin() const;
-		iterator 		rend() const;
+		reverse_iterator	rbegin() const;
+		reverse_iterator	rend() const;
 
 		/* Capacity */
 		bool			empty() const;
@@ -81,15 +88,23 @@ namespace FT_NAMESPACE
 		size_type		max_size() const;
 
 		/* Modifiers */
-		void			clear() const;
-		::std::pair<iterator, bool>	insert(const_reference& value);
+		void			clear();
+		iterator		insert(const_reference value);
 		iterator		insert(const_iterator position, const_reference value);
+		iterator		insert(value_type&& value);
+		iterator		insert(const_iterator position, value_type&& value);
+		template <typename... Args>
+		iterator		emplace(Args&&... args);
+		template <typename... Args>
+		iterator		emplace_hint(const_iterator position, Args&&... args);
+		template <typename InputIt>
+		void			insert(InputIt first, InputIt last);
 		template <typename InputIt>
-		iterator		insert(InputIt first, InputIt last);
-		iterator		erase(iterator position);
+		void			insert(sorted_equivalent_t, InputIt first, InputIt last);
+		void			erase(iterator position);
 		size_type		erase(const key_type& k);
 		void			erase(iterator first, iterator last);
-		void			swap(const multiset& other);
+		void			swap(multiset& other);
 
 		/* Lookup */
 		size_type		count(const key_type& k) const;
@@ -102,14 +117,19 @@ namespace FT_NAMESPACE
 		iterator		upper_bound(const key_type& k);
 		const_iterator	upper_bound(const key_type& k) const;
 
+		/* Order statistics */
+		iterator		nth(size_type k);
+		const_iterator	nth(size_type k) const;
+		size_type		rank(const key_type& k) const;
+
 		/* Observers */
 		key_compare		key_comp() const;
 		key_compare		value_comp() const;
 
 		/* Non members */
-		template <typename <K1, typename C1, typename A1>
+		template <typename K1, typename C1, typename A1>
 		friend bool operator==(const multiset<K1, C1, A1>& lhs, const multiset<K1, C1, A1>& rhs);
-		template <typename <K1, typename C1, typename A1>
+		template <typename K1, typename C1, typename A1>
 		friend bool operator<(const multiset<K1, C1, A1>& lhs, const multiset<K1, C1, A1>& rhs);
 	};
 
@@ -148,7 +168,7 @@ namespace FT_NAMESPACE
 	template <typename InputIt>
 	multiset<Key, Compare, Alloc>::multiset(InputIt first, InputIt last)
 	: tree()
-	{ tree.aux_insert_range_unique(first, last); }
+	{ tree.aux_insert_range_equal(first, last); }
 
 	/**
 	 * 	@brief Range Comparison Constructor
@@ -166,7 +186,25 @@ namespace FT_NAMESPACE
 	template <typename InputIt>
 	multiset<Key, Compare, Alloc>::multiset(InputIt first, InputIt last, const value_compare& cmp, const allocator_type& alloc)
 	: tree(cmp, alloc)
-	{ tree.aux_insert_range_unique(first, last); }
+	{ tree.aux_insert_range_equal(first, last); }
+
+	/**
+	 * 	@brief Sorted Range Constructor
+	 * 
+	 * 	@tparam InputIt An input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 	@param cmp A comparison object.
+	 * 	@param alloc An allocator.
+	 *
+	 * 	Create a multiset filled with copies of @p first - @p last range, in linear time.
+	 * 	NOTE: The range must be sorted with @p cmp.
+	*/
+	template <class Key, class Compare, class Alloc>
+	template <typename InputIt>
+	multiset<Key, Compare, Alloc>::multiset(sorted_equivalent_t, InputIt first, InputIt last, const value_compare& cmp, const allocator_type& alloc)
+	: tree(cmp, alloc)
+	{ tree.aux_insert_range_equal(sorted_equivalent_t(), first, last); }
 
 	/**
 	 * 	@brief Copy Constructor
@@ -178,6 +216,16 @@ namespace FT_NAMESPACE
 	: tree(other.tree)
 	{ }
 
+	/**
+	 * 	@brief Move Constructor
+	 * 
+	 * 	@param other A %multiset of the same type of @c *this, left empty.
+	*/
+	template <class Key, class Compare, class Alloc>
+	multiset<Key, Compare, Alloc>::multiset(multiset&& other)
+	: tree(std::move(other.tree))
+	{ }
+
 	/**
 	 * 	@brief operator=
 	 * 
@@ -194,6 +242,29 @@ namespace FT_NAMESPACE
 		return (*this);
 	}
 
+	/**
+	 * 	@brief operator=
+	 * 
+	 * 	@param other A %multiset with the same type of @c *this, left empty.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline multiset<Key, Compare, Alloc>&
+	multiset<Key, Compare, Alloc>::operator=(multiset&& other)
+	{
+		tree = std::move(other.tree);
+		return (*this);
+	}
+
+	/**
+	 * 	@brief get allocator
+	 * 
+	 * 	@return A copy of the allocator used by the %multiset.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename multiset<Key, Compare, Alloc>::allocator_type
+	multiset<Key, Compare, Alloc>::get_allocator() const
+	{ return (tree.get_allocator()); }
+
 	///////////////
 	// Iterators //
 	///////////////
@@ -224,7 +295,7 @@ namespace FT_NAMESPACE
 	 * 	@return A revese iterator pointing to the first element of @c *this.
 	*/
 	template <class Key, class Compare, class Alloc>
-	inline typename multiset<Key, Compare, Alloc>::iterator
+	inline typename multiset<Key, Compare, Alloc>::reverse_iterator
 	multiset<Key, Compare, Alloc>::rbegin() const 
 	{ return (tree.rbegin()); }
 
@@ -234,7 +305,7 @@ namespace FT_NAMESPACE
 	 * 	@return An iterator pointing to the last element of @c *this.
 	*/
 	template <class Key, class Compare, class Alloc>
-	inline typename multiset<Key, Compare, Alloc>::iterator
+	inline typename multiset<Key, Compare, Alloc>::reverse_iterator
 	multiset<Key, Compare, Alloc>::rend() const
 	{ return (tree.rend()); }
 
@@ -283,7 +354,7 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline void
-	multiset<Key, Compare, Alloc>::clear() const
+	multiset<Key, Compare, Alloc>::clear()
 	{ tree.clear(); }
 
 	/**
@@ -291,13 +362,12 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@param value The key to be inserted.
 	 * 
-	 * 	Attemps to insert @p value into the %multiset.
-	 * 	If the insertion is not possible the bool in the returned pair is false.
+	 * 	Inserts @p value into the %multiset, after the equal keys.
 	*/
 	template <class Key, class Compare, class Alloc>
-	inline ::std::pair<typename multiset<Key, Compare, Alloc>::iterator, bool>
-	multiset<Key, Compare, Alloc>::insert(const_reference& value)
-	{ return (tree.aux_insert_unique(value)); }
+	inline typename multiset<Key, Compare, Alloc>::iterator
+	multiset<Key, Compare, Alloc>::insert(const_reference value)
+	{ return (tree.aux_insert_equal(value)); }
 
 	/**
 	 * 	@brief insert
@@ -308,11 +378,61 @@ namespace FT_NAMESPACE
 	 * 	Attemps to insert @p value ussing position as hint.
 	 * 	NOTE: position (if is set correctly) is just to increase the speed execution.
 	 * 		This function perform the same operation as insert(const_reference) signature.
+	 * 	If @p value goes just before position (or just after it) the position
+	 * 	is found in amortized constant time, logarithmic otherwise.
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline typename multiset<Key, Compare, Alloc>::iterator
 	multiset<Key, Compare, Alloc>::insert(const_iterator position, const_reference value)
-	{ return (tree.aux_insert_unique(position, value)); }
+	{ return (tree.aux_insert_equal(position, value)); }
+
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param value The value to be inserted, it is moved.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename multiset<Key, Compare, Alloc>::iterator
+	multiset<Key, Compare, Alloc>::insert(value_type&& value)
+	{ return (tree.aux_insert_equal(std::move(value))); }
+
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param pos A hint of the insertion position.
+	 * 	@param value The value to be inserted, it is moved.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename multiset<Key, Compare, Alloc>::iterator
+	multiset<Key, Compare, Alloc>::insert(const_iterator pos, value_type&& value)
+	{ return (tree.aux_insert_equal(pos, std::move(value))); }
+
+	/**
+	 * 	@brief emplace
+	 * 
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the emplaced value.
+	 * 
+	 * 	The value is constructed in place in a new node.
+	*/
+	template <class Key, class Compare, class Alloc>
+	template <typename... Args>
+	inline typename multiset<Key, Compare, Alloc>::iterator
+	multiset<Key, Compare, Alloc>::emplace(Args&&... args)
+	{ return (tree.aux_emplace_equal(std::forward<Args>(args)...)); }
+
+	/**
+	 * 	@brief emplace hint
+	 * 
+	 * 	@param pos A hint of the insertion position.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the emplaced value.
+	*/
+	template <class Key, class Compare, class Alloc>
+	template <typename... Args>
+	inline typename multiset<Key, Compare, Alloc>::iterator
+	multiset<Key, Compare, Alloc>::emplace_hint(const_iterator pos, Args&&... args)
+	{ return (tree.aux_emplace_hint_equal(pos, std::forward<Args>(args)...)); }
 
 	/**
 	 * 	@brief insert
@@ -325,9 +445,25 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	template <typename InputIt>
-	inline typename multiset<Key, Compare, Alloc>::iterator
+	inline void
 	multiset<Key, Compare, Alloc>::insert(InputIt first, InputIt last)
-	{ return (tree.aux_insert_range_unique(first, last)); }
+	{ tree.aux_insert_range_equal(first, last); }
+
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@tparam InputIt an input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 
+	 * 	Inserts the sorted range @p first - @p last, if @c *this is empty
+	 * 	it is built in linear time.
+	*/
+	template <class Key, class Compare, class Alloc>
+	template <typename InputIt>
+	inline void
+	multiset<Key, Compare, Alloc>::insert(sorted_equivalent_t, InputIt first, InputIt last)
+	{ tree.aux_insert_range_equal(sorted_equivalent_t(), first, last); }
 
 	/**
 	 * 	@brief erase
@@ -340,9 +476,9 @@ namespace FT_NAMESPACE
 	 * 	Erase the element holded at @p position.
 	*/
 	template <class Key, class Compare, class Alloc>
-	inline typename multiset<Key, Compare, Alloc>::iterator
+	inline void
 	multiset<Key, Compare, Alloc>::erase(iterator position)
-	{ return (tree.erase(position)); }
+	{ tree.erase(position); }
 
 	/**
 	 * 	@brief erase
@@ -380,7 +516,7 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline void
-	multiset<Key, Compare, Alloc>::swap(const multiset& other)
+	multiset<Key, Compare, Alloc>::swap(multiset& other)
 	{ tree.swap(other.tree); }
 
 	////////////
@@ -489,6 +625,50 @@ namespace FT_NAMESPACE
 	multiset<Key, Compare, Alloc>::upper_bound(const key_type& k) const
 	{ return (tree.upper_bound(k)); }
 
+	//////////////////////
+	// Order statistics //
+	//////////////////////
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return An iterator to the @p k th element in key order (from 0),
+	 * 	end() if @p k isn't less than size().
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename multiset<Key, Compare, Alloc>::iterator
+	multiset<Key, Compare, Alloc>::nth(size_type k)
+	{ return (tree.nth(k)); }
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return A const iterator to the @p k th element in key order.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename multiset<Key, Compare, Alloc>::const_iterator
+	multiset<Key, Compare, Alloc>::nth(size_type k) const
+	{ return (tree.nth(k)); }
+
+	/**
+	 * 	@brief rank
+	 * 
+	 * 	@param k A key.
+	 * 
+	 * 	@return The amount of elements with a key less than @p k.
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	 * 	ft::distance() between two iterators is logarithmic too.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename multiset<Key, Compare, Alloc>::size_type
+	multiset<Key, Compare, Alloc>::rank(const key_type& k) const
+	{ return (tree.rank(k)); }
+
 	///////////////
 	// Observers //
 	///////////////
@@ -563,7 +743,7 @@ namespace FT_NAMESPACE
 	*/
 	template <typename Key, typename Compare, typename Alloc>
 	inline void
-	swap(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs)
+	swap(multiset<Key, Compare, Alloc>& lhs, multiset<Key, Compare, Alloc>& rhs)
 	{ lhs.swap(rhs); }
 	//@}
 };
@@ -0,0 +1,678 @@
+/** @file priority_queue.hpp
+ *
+ * 	Contains the implementation of the priority queue adapters: the d-ary
+ * 	heap %priority_queue and the %indexed_priority_queue (decrease_key).
+*/
+
+# pragma once
+
+# include <ft_containers.hpp>
+# include <vector.hpp>
+
+# include <functional>
+
+/**
+ * 	@brief Priority queue MACROS
+ *
+ * 	- FT_PRIORITY_QUEUE_ARITY: The default amount of children of a heap node.
+ * 	A wider heap is shallower: less levels for a push, and the children
+ * 	compared by a pop are adjacent (4 * 8 bytes, 8 * 8 bytes is one cache line).
+ *
+ * 	It is overwritable if needed.
+*/
+#ifndef FT_PRIORITY_QUEUE_ARITY
+# define FT_PRIORITY_QUEUE_ARITY 4
+#endif
+
+namespace FT_NAMESPACE
+{
+	/**
+	 * 	@brief Priority queue
+	 *
+	 * 	@tparam T the type of value holded by the container.
+	 * 	@tparam Container a random access container: %vector (default) or %deque.
+	 * 	@tparam Compare The order, top() is the greatest element (as std).
+	 * 	@tparam Arity The amount of children of a heap node (2, 4 or 8).
+	 *
+	 * 	A d-ary max heap stored in @a Container. The children of the element
+	 * 	at i are at [Arity * i + 1, Arity * i + Arity].
+	*/
+	template <class T, class Container = vector<T>,
+	class Compare = std::less<typename Container::value_type>,
+	std::size_t Arity = FT_PRIORITY_QUEUE_ARITY>
+	class priority_queue
+	{
+		static_assert(Arity >= 2, "priority_queue: Arity must be at least 2");
+
+		/* Member types */
+
+		public:
+
+		typedef Container									container_type;
+		typedef Compare										value_compare;
+		typedef typename container_type::value_type			value_type;
+		typedef typename container_type::reference			reference;
+		typedef typename container_type::const_reference	const_reference;
+		typedef typename container_type::size_type			size_type;
+
+		/* Core */
+
+		protected:
+
+		container_type	c;
+		value_compare	comp;
+
+		/* Auxiliar functions */
+
+		private:
+
+		void			pq_sift_up(size_type index);
+		void			pq_sift_down(size_type index);
+		void			pq_heapify();
+
+		/* Member functions */
+
+		public:
+
+		explicit priority_queue(const value_compare& compare = value_compare(),
+			const container_type& cont = container_type());
+		template <class InputIt>
+		priority_queue(InputIt first, InputIt last, const value_compare& compare = value_compare(),
+			const container_type& cont = container_type());
+
+		/* Element access */
+		const_reference	top() const;
+
+		/* Capacity */
+		bool			empty() const;
+		size_type		size() const;
+
+		/* Modifiers */
+		void			push(const_reference value);
+		void			push(value_type&& value);
+		template <typename... Args>
+		void			emplace(Args&&... args);
+		template <class InputIt>
+		void			push_range(InputIt first, InputIt last);
+		void			pop();
+		void			swap(priority_queue& other);
+	};
+
+	////////////////////////
+	// Auxiliar functions //
+	////////////////////////
+
+	/**
+	 * 	@brief Sift up
+	 *
+	 * 	@param index The index of an element that can be greater than its parent.
+	 *
+	 * 	Moves the parents down (one move per level) and the element once.
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	void
+	priority_queue<T, Container, Compare, Arity>::pq_sift_up(size_type index)
+	{
+		value_type value = std::move(c[index]);
+
+		while (index)
+		{
+			const size_type parent = (index - 1) / Arity;
+
+			if (!comp(c[parent], value))
+				break ;
+			c[index] = std::move(c[parent]);
+			index = parent;
+		}
+		c[index] = std::move(value);
+	}
+
+	/**
+	 * 	@brief Sift down
+	 *
+	 * 	@param index The index of an element that can be less than its children.
+	 *
+	 * 	Moves the greatest child up until the element is placed.
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	void
+	priority_queue<T, Container, Compare, Arity>::pq_sift_down(size_type index)
+	{
+		const size_type	n = c.size();
+		value_type		value = std::move(c[index]);
+
+		for (size_type first = index * Arity + 1 ; first < n ; first = index * Arity + 1)
+		{
+			const size_type	last = n - first < Arity ? n : first + Arity;
+			size_type		greatest = first;
+
+			for (size_type child = first + 1 ; child < last ; child++)
+				if (comp(c[greatest], c[child]))
+					greatest = child;
+			if (!comp(value, c[greatest]))
+				break ;
+			c[index] = std::move(c[greatest]);
+			index = greatest;
+		}
+		c[index] = std::move(value);
+	}
+
+	/**
+	 * 	@brief Heapify
+	 *
+	 * 	Builds the heap in O(n): sifts down every parent, the last first.
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	void
+	priority_queue<T, Container, Compare, Arity>::pq_heapify()
+	{
+		if (c.size() < 2)
+			return ;
+		for (size_type parent = (c.size() - 2) / Arity + 1 ; parent-- ; )
+			pq_sift_down(parent);
+	}
+
+	//////////////////////
+	// Member functions //
+	//////////////////////
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param compare The compare object.
+	 * 	@param cont The initial elements (heapified).
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	priority_queue<T, Container, Compare, Arity>::priority_queue(const value_compare& compare,
+		const container_type& cont)
+	: c(cont), comp(compare)
+	{ pq_heapify(); }
+
+	/**
+	 * 	@brief Range constructor
+	 *
+	 * 	@param first, last The range of the initial elements (heapified).
+	 * 	@param compare The compare object.
+	 * 	@param cont Other initial elements.
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	template <class InputIt>
+	priority_queue<T, Container, Compare, Arity>::priority_queue(InputIt first, InputIt last,
+		const value_compare& compare, const container_type& cont)
+	: c(cont), comp(compare)
+	{
+		for ( ; first != last ; first++)
+			c.push_back(*first);
+		pq_heapify();
+	}
+
+	////////////////////
+	// Element access //
+	////////////////////
+
+	/**
+	 * 	@brief top
+	 *
+	 * 	@return A const reference to the greatest element.
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	inline typename priority_queue<T, Container, Compare, Arity>::const_reference
+	priority_queue<T, Container, Compare, Arity>::top() const
+	{ return (c[0]); }
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	template <class T, class Container, class Compare, std::size_t Arity>
+	inline bool
+	priority_queue<T, Container, Compare, Arity>::empty() const
+	{ return (c.empty()); }
+
+	template <class T, class Container, class Compare, std::size_t Arity>
+	inline typename priority_queue<T, Container, Compare, Arity>::size_type
+	priority_queue<T, Container, Compare, Arity>::size() const
+	{ return (c.size()); }
+
+	///////////////
+	// Modifiers //
+	///////////////
+
+	/**
+	 * 	@brief push
+	 *
+	 * 	Inserts an element in O(log(n) / log(Arity)).
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	void
+	priority_queue<T, Container, Compare, Arity>::push(const_reference value)
+	{
+		c.push_back(value);
+		pq_sift_up(c.size() - 1);
+	}
+
+	template <class T, class Container, class Compare, std::size_t Arity>
+	void
+	priority_queue<T, Container, Compare, Arity>::push(value_type&& value)
+	{
+		c.push_back(std::move(value));
+		pq_sift_up(c.size() - 1);
+	}
+
+	template <class T, class Container, class Compare, std::size_t Arity>
+	template <typename... Args>
+	void
+	priority_queue<T, Container, Compare, Arity>::emplace(Args&&... args)
+	{
+		c.emplace_back(std::forward<Args>(args)...);
+		pq_sift_up(c.size() - 1);
+	}
+
+	/**
+	 * 	@brief push range
+	 *
+	 * 	@param first, last The range of the inserted elements.
+	 *
+	 * 	Appends the range, then sifts up each new element or heapifies all
+	 * 	(O(n)), the cheaper: k pushes cost about k * depth moves.
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	template <class InputIt>
+	void
+	priority_queue<T, Container, Compare, Arity>::push_range(InputIt first, InputIt last)
+	{
+		const size_type old_size = c.size();
+		size_type		depth = 0;
+
+		for ( ; first != last ; first++)
+			c.push_back(*first);
+		for (size_type n = c.size() ; n ; n /= Arity)
+			depth++;
+		if ((c.size() - old_size) * depth > c.size())
+			pq_heapify();
+		else
+			for (size_type index = old_size ; index < c.size() ; index++)
+				pq_sift_up(index);
+	}
+
+	/**
+	 * 	@brief pop
+	 *
+	 * 	Removes the greatest element: the last element takes its place and
+	 * 	is sifted down.
+	*/
+	template <class T, class Container, class Compare, std::size_t Arity>
+	void
+	priority_queue<T, Container, Compare, Arity>::pop()
+	{
+		if (c.size() > 1)
+		{
+			c[0] = std::move(c.back());
+			c.pop_back();
+			pq_sift_down(0);
+		}
+		else
+			c.pop_back();
+	}
+
+	template <class T, class Container, class Compare, std::size_t Arity>
+	void
+	priority_queue<T, Container, Compare, Arity>::swap(priority_queue& other)
+	{
+		c.swap(other.c);
+		std::swap(comp, other.comp);
+	}
+
+	/**
+	 * 	@brief Indexed priority queue
+	 *
+	 * 	@tparam T the type of value holded by the queue.
+	 * 	@tparam Compare The order, top() is the greatest element.
+	 * 	@tparam Arity The amount of children of a heap node (2, 4 or 8).
+	 * 	@tparam Allocator An allocator type.
+	 *
+	 * 	A d-ary heap where push returns a handle, the handle gives the
+	 * 	element back until it's popped or erased. Each handle knows the
+	 * 	position of its element: decrease_key, update and erase are
+	 * 	O(log(n) / log(Arity)) (timers, Dijkstra, schedulers).
+	 *
+	 * 	The handles of popped elements are reused by the next pushes.
+	*/
+	template <class T, class Compare = std::less<T>,
+	std::size_t Arity = FT_PRIORITY_QUEUE_ARITY, class Allocator = allocator<T> >
+	class indexed_priority_queue
+	{
+		static_assert(Arity >= 2, "indexed_priority_queue: Arity must be at least 2");
+
+		/* Member types */
+
+		public:
+
+		typedef T					value_type;
+		typedef Compare				value_compare;
+		typedef Allocator			allocator_type;
+		typedef std::size_t			size_type;
+		typedef std::size_t			handle_type;
+		typedef const value_type&	const_reference;
+
+		private:
+
+		/* A heap element, the value and its handle kept together */
+		struct Node
+		{
+			value_type		value;
+			handle_type		handle;
+
+			Node(const value_type& value, handle_type handle) : value(value), handle(handle) { }
+		};
+
+		typedef typename Allocator::template rebind<Node>::other			Node_allocator;
+		typedef typename Allocator::template rebind<size_type>::other		Size_allocator;
+
+		/* Core:
+		 *
+		 * heap -> The d-ary heap.
+		 * position -> The index in %heap of the element of each handle (npos if free).
+		 * free_handles -> The handles given back by pop/erase.
+		*/
+		vector<Node, Node_allocator>			heap;
+		vector<size_type, Size_allocator>		position;
+		vector<handle_type, Size_allocator>		free_handles;
+		value_compare							comp;
+
+		/* Auxiliar functions */
+
+		void			ipq_place(size_type index, Node& node);
+		void			ipq_sift_up(size_type index);
+		void			ipq_sift_down(size_type index);
+		void			ipq_remove(size_type index);
+
+		/* Member functions */
+
+		public:
+
+		static const size_type	npos = static_cast<size_type>(-1);
+
+		explicit indexed_priority_queue(const value_compare& compare = value_compare());
+
+		/* Element access */
+		const_reference	top() const;
+		handle_type		top_handle() const;
+		const_reference	get(handle_type handle) const;
+		bool			contains(handle_type handle) const;
+
+		/* Capacity */
+		bool			empty() const;
+		size_type		size() const;
+
+		/* Modifiers */
+		handle_type		push(const_reference value);
+		void			pop();
+		void			decrease_key(handle_type handle, const_reference value);
+		void			update(handle_type handle, const_reference value);
+		void			erase(handle_type handle);
+	};
+
+	////////////////////////
+	// Auxiliar functions //
+	////////////////////////
+
+	/**
+	 * 	@brief Place
+	 *
+	 * 	Moves @p node at @p index and updates the position of its handle.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline void
+	indexed_priority_queue<T, Compare, Arity, Allocator>::ipq_place(size_type index, Node& node)
+	{
+		position[node.handle] = index;
+		heap[index] = std::move(node);
+	}
+
+	/**
+	 * 	@brief Sift up
+	 *
+	 * 	@param index The index of an element that can be greater than its parent.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	void
+	indexed_priority_queue<T, Compare, Arity, Allocator>::ipq_sift_up(size_type index)
+	{
+		Node node = std::move(heap[index]);
+
+		while (index)
+		{
+			const size_type parent = (index - 1) / Arity;
+
+			if (!comp(heap[parent].value, node.value))
+				break ;
+			ipq_place(index, heap[parent]);
+			index = parent;
+		}
+		ipq_place(index, node);
+	}
+
+	/**
+	 * 	@brief Sift down
+	 *
+	 * 	@param index The index of an element that can be less than its children.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	void
+	indexed_priority_queue<T, Compare, Arity, Allocator>::ipq_sift_down(size_type index)
+	{
+		const size_type	n = heap.size();
+		Node			node = std::move(heap[index]);
+
+		for (size_type first = index * Arity + 1 ; first < n ; first = index * Arity + 1)
+		{
+			const size_type	last = n - first < Arity ? n : first + Arity;
+			size_type		greatest = first;
+
+			for (size_type child = first + 1 ; child < last ; child++)
+				if (comp(heap[greatest].value, heap[child].value))
+					greatest = child;
+			if (!comp(node.value, heap[greatest].value))
+				break ;
+			ipq_place(index, heap[greatest]);
+			index = greatest;
+		}
+		ipq_place(index, node);
+	}
+
+	/**
+	 * 	@brief Remove
+	 *
+	 * 	@param index The index of the removed element.
+	 *
+	 * 	The last element takes its place and is sifted up or down,
+	 * 	the handle is freed.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	void
+	indexed_priority_queue<T, Compare, Arity, Allocator>::ipq_remove(size_type index)
+	{
+		const handle_type handle = heap[index].handle;
+
+		free_handles.push_back(handle);
+		position[handle] = npos;
+		if (index + 1 != heap.size())
+		{
+			ipq_place(index, heap.back());
+			heap.pop_back();
+			if (index && comp(heap[(index - 1) / Arity].value, heap[index].value))
+				ipq_sift_up(index);
+			else
+				ipq_sift_down(index);
+		}
+		else
+			heap.pop_back();
+	}
+
+	//////////////////////
+	// Member functions //
+	//////////////////////
+
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	indexed_priority_queue<T, Compare, Arity, Allocator>::indexed_priority_queue(const value_compare& compare)
+	: heap(), position(), free_handles(), comp(compare)
+	{ }
+
+	////////////////////
+	// Element access //
+	////////////////////
+
+	/**
+	 * 	@brief top
+	 *
+	 * 	@return A const reference to the greatest element.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline typename indexed_priority_queue<T, Compare, Arity, Allocator>::const_reference
+	indexed_priority_queue<T, Compare, Arity, Allocator>::top() const
+	{ return (heap[0].value); }
+
+	/**
+	 * 	@brief top handle
+	 *
+	 * 	@return The handle of the greatest element.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline typename indexed_priority_queue<T, Compare, Arity, Allocator>::handle_type
+	indexed_priority_queue<T, Compare, Arity, Allocator>::top_handle() const
+	{ return (heap[0].handle); }
+
+	/**
+	 * 	@brief get
+	 *
+	 * 	@param handle A handle given by push, still in the queue.
+	 * 	@return A const reference to its element.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline typename indexed_priority_queue<T, Compare, Arity, Allocator>::const_reference
+	indexed_priority_queue<T, Compare, Arity, Allocator>::get(handle_type handle) const
+	{ return (heap[position[handle]].value); }
+
+	/**
+	 * 	@brief contains
+	 *
+	 * 	@return True if the element of @p handle wasn't popped or erased.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline bool
+	indexed_priority_queue<T, Compare, Arity, Allocator>::contains(handle_type handle) const
+	{ return (handle < position.size() && position[handle] != npos); }
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline bool
+	indexed_priority_queue<T, Compare, Arity, Allocator>::empty() const
+	{ return (heap.empty()); }
+
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline typename indexed_priority_queue<T, Compare, Arity, Allocator>::size_type
+	indexed_priority_queue<T, Compare, Arity, Allocator>::size() const
+	{ return (heap.size()); }
+
+	///////////////
+	// Modifiers //
+	///////////////
+
+	/**
+	 * 	@brief push
+	 *
+	 * 	@param value The inserted value.
+	 * 	@return The handle of the element.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	typename indexed_priority_queue<T, Compare, Arity, Allocator>::handle_type
+	indexed_priority_queue<T, Compare, Arity, Allocator>::push(const_reference value)
+	{
+		handle_type handle;
+
+		if (free_handles.empty())
+		{
+			handle = position.size();
+			position.push_back(heap.size());
+		}
+		else
+		{
+			handle = free_handles.back();
+			free_handles.pop_back();
+			position[handle] = heap.size();
+		}
+		try
+		{ heap.push_back(Node(value, handle)); }
+		catch (const std::bad_alloc&)
+		{
+			position[handle] = npos;
+			free_handles.push_back(handle);
+			throw ;
+		}
+		ipq_sift_up(heap.size() - 1);
+		return (handle);
+	}
+
+	/**
+	 * 	@brief pop
+	 *
+	 * 	Removes the greatest element, its handle is freed.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline void
+	indexed_priority_queue<T, Compare, Arity, Allocator>::pop()
+	{ ipq_remove(0); }
+
+	/**
+	 * 	@brief decrease key
+	 *
+	 * 	@param handle A handle in the queue.
+	 * 	@param value The new value, not less than the old one (with
+	 * 	std::greater, the min heap of Dijkstra: a smaller key).
+	 *
+	 * 	The element can only move toward the top: a single sift up.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	void
+	indexed_priority_queue<T, Compare, Arity, Allocator>::decrease_key(handle_type handle, const_reference value)
+	{
+		const size_type index = position[handle];
+
+		heap[index].value = value;
+		ipq_sift_up(index);
+	}
+
+	/**
+	 * 	@brief update
+	 *
+	 * 	@param handle A handle in the queue.
+	 * 	@param value The new value, any order.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	void
+	indexed_priority_queue<T, Compare, Arity, Allocator>::update(handle_type handle, const_reference value)
+	{
+		const size_type	index = position[handle];
+		const bool		up = comp(heap[index].value, value);
+
+		heap[index].value = value;
+		if (up)
+			ipq_sift_up(index);
+		else
+			ipq_sift_down(index);
+	}
+
+	/**
+	 * 	@brief erase
+	 *
+	 * 	@param handle A handle in the queue, freed.
+	*/
+	template <class T, class Compare, std::size_t Arity, class Allocator>
+	inline void
+	indexed_priority_queue<T, Compare, Arity, Allocator>::erase(handle_type handle)
+	{ ipq_remove(position[handle]); }
+};
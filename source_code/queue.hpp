@@ -7,6 +7,7 @@
 # pragma once
 
 # include <ft_containers.hpp>
+# include <deque.hpp>
 
 namespace FT_NAMESPACE
 {
@@ -15,11 +16,17 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@tparam T the type of value holded by the conatiner.
 	 * 	@tparam Container the type of value holded by the queue.
+	 *
+	 * 	@a Container needs front, back, push_back and pop_front: %deque
+	 * 	(default) or %ring_buffer (see: ring_buffer.hpp).
 	*/
-	template <class T, class Container> // TO DO: put deque as dtf
+	template <class T, class Container = deque<T> >
 	struct queue
 	{
-		// TO DO: possible implementation here of operator== and operator<
+		template <class T1, class C1>
+		friend bool		operator==(const queue<T1, C1>& lhs, const queue<T1, C1>& rhs);
+		template <class T1, class C1>
+		friend bool		operator<(const queue<T1, C1>& lhs, const queue<T1, C1>& rhs);
 
 		/* Member types */
 
@@ -31,7 +38,7 @@ namespace FT_NAMESPACE
 
 		/* Member fucntions */
 
-		explicit queue(const_reference other = container_type());
+		explicit queue(const container_type& other = container_type());
 
 		// TO DO: operator= & swap
 
@@ -47,6 +54,7 @@ namespace FT_NAMESPACE
 
 		/* Modifiers */
 		void			push(const_reference value);
+		void			push(value_type&& value);
 		void			pop();
 
 		/* Core */
@@ -60,7 +68,7 @@ namespace FT_NAMESPACE
 	 * 	@brief Default Constructor
 	*/
 	template <class T, class Container>
-	queue<T, Container>::queue(const_reference other = container_type())
+	queue<T, Container>::queue(const container_type& other)
 	: c(other)
 	{ }
 
@@ -139,17 +147,22 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief push
 	 * 
-	 * 	Prappend one element in the top of %stack.
+	 * 	Append one element at the back of %queue.
 	*/
 	template <class T, class Container>
 	inline void
 	queue<T, Container>::push(const_reference value)
-	{ c.push_back(); }
+	{ c.push_back(value); }
+
+	template <class T, class Container>
+	inline void
+	queue<T, Container>::push(value_type&& value)
+	{ c.push_back(std::move(value)); }
 
 	/**
 	 * 	@brief pop
 	 * 
-	 * 	Removes the element located at the top of %stack.
+	 * 	Removes the element located at the front of %queue.
 	*/
 	template <class T, class Container>
 	inline void
@@ -170,30 +183,30 @@ namespace FT_NAMESPACE
 	template <class T, class Container>
 	inline bool
 	operator==(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
-	{ return (lsh.c == rhs.c); }
+	{ return (lhs.c == rhs.c); }
 
 	template <class T, class Container>
 	inline bool
 	operator!=(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
-	{ return (lsh.c != rhs.c); }
+	{ return (!(lhs == rhs)); }
 
 	template <class T, class Container>
 	inline bool
 	operator<(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
-	{ return (lsh.c < rhs.c); }
+	{ return (lhs.c < rhs.c); }
 
 	template <class T, class Container>
 	inline bool
 	operator<=(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
-	{ return (lsh.c <= rhs.c); }
+	{ return (!(rhs < lhs)); }
 
 	template <class T, class Container>
 	inline bool
 	operator>(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
-	{ return (lsh.c > rhs.c); }
+	{ return (rhs < lhs); }
 
 	template <class T, class Container>
 	inline bool
 	operator>=(const queue<T, Container>& lhs, const queue<T, Container>& rhs)
-	{ return (lsh.c >= rhs.c); }
+	{ return (!(lhs < rhs)); }
 };
@@ -0,0 +1,816 @@
+/** @file ring_buffer.hpp
+ *
+ * 	This file contains the ring buffer (circular buffer) container implementation.
+*/
+
+# pragma once
+
+# include <ft_iterator.hpp>
+# include <ft_allocator.hpp>
+# include <algorithm.hpp>
+
+# include <limits>
+# include <string>
+# include <stdexcept>
+
+/**
+ * 	@brief Ring buffer MACROS
+ *
+ * 	- FT_RING_BUFFER_MIN_CAPACITY: The capacity of a growing %ring_buffer
+ * 	at its first push, must be a power of two.
+ *
+ * 	It is overwritable if needed.
+*/
+#ifndef FT_RING_BUFFER_MIN_CAPACITY
+# define FT_RING_BUFFER_MIN_CAPACITY 0x8
+#endif
+
+namespace FT_NAMESPACE
+{
+	/**
+	 * 	@brief Ring buffer iterator
+	 *
+	 * 	@tparam T The type holded by the ring buffer.
+	 * 	@tparam Ref_T A mutable or const reference to T
+	 * 	@tparam Ptr_T A mutable or const pointer to T
+	 *
+	 * 	Holds a counter, the slot is the counter masked by the capacity:
+	 * 	wrapping around the end of the buffer costs nothing.
+	*/
+	template <class T, typename Ref_T, typename Ptr_T>
+	struct ring_buffer_iterator
+	{
+		/* Member types */
+
+		typedef random_access_iterator_tag	iterator_category;
+		typedef T							value_type;
+		typedef Ptr_T						pointer;
+		typedef Ref_T						reference;
+		typedef std::size_t					size_type;
+		typedef std::ptrdiff_t				difference_type;
+		typedef ring_buffer_iterator		Self;
+
+		typedef ring_buffer_iterator<T, T&, T*>				iterator;
+		typedef ring_buffer_iterator<T, const T&, const T*>	const_iterator;
+
+		/* Core:
+		 * - buff -> The buffer.
+		 * - mask -> The capacity - 1.
+		 * - index -> The counter of the element.
+		*/
+		T*			buff;
+		size_type	mask;
+		size_type	index;
+
+		/* Member functions */
+
+		ring_buffer_iterator() : buff(), mask(), index() { }
+		ring_buffer_iterator(T* b, size_type m, size_type i) : buff(b), mask(m), index(i) { }
+		ring_buffer_iterator(const iterator& other) : buff(other.buff), mask(other.mask), index(other.index) { }
+
+		reference	operator*() const { return (buff[index & mask]); }
+		pointer		operator->() const { return (buff + (index & mask)); }
+		reference	operator[](difference_type n) const { return (buff[(index + n) & mask]); }
+
+		Self&		operator++() { ++index; return (*this); }
+		Self		operator++(int) { Self tmp = *this; ++index; return (tmp); }
+		Self&		operator--() { --index; return (*this); }
+		Self		operator--(int) { Self tmp = *this; --index; return (tmp); }
+		Self&		operator+=(difference_type n) { index += n; return (*this); }
+		Self&		operator-=(difference_type n) { index -= n; return (*this); }
+
+		/* Non members */
+
+		friend bool				operator==(const Self& lhs, const Self& rhs) { return (lhs.index == rhs.index); }
+		friend bool				operator!=(const Self& lhs, const Self& rhs) { return (lhs.index != rhs.index); }
+		friend bool				operator<(const Self& lhs, const Self& rhs) { return (lhs - rhs < 0); }
+		friend bool				operator>(const Self& lhs, const Self& rhs) { return (rhs < lhs); }
+		friend bool				operator<=(const Self& lhs, const Self& rhs) { return (!(rhs < lhs)); }
+		friend bool				operator>=(const Self& lhs, const Self& rhs) { return (!(lhs < rhs)); }
+		friend difference_type	operator-(const Self& lhs, const Self& rhs) { return (difference_type(lhs.index - rhs.index)); }
+		friend Self				operator+(const Self& x, difference_type n) { Self tmp = x; return (tmp += n); }
+		friend Self				operator+(difference_type n, const Self& x) { return (x + n); }
+		friend Self				operator-(const Self& x, difference_type n) { Self tmp = x; return (tmp -= n); }
+	};
+
+	/**
+	 * 	@brief Ring buffer
+	 *
+	 * 	@tparam T The type holded by the ring buffer.
+	 * 	@tparam Allocator An allocator type.
+	 *
+	 * 	A FIFO in one contiguous block. The capacity is a power of two, %head and
+	 * 	%tail are counters that only grow, an element slot is its counter masked by
+	 * 	the capacity - 1: no node hopping and no modulo.
+	 *
+	 * 	- Growing mode (default): A full %ring_buffer doubles its capacity.
+	 * 	- Overwrite mode: The capacity is fixed, a push in a full %ring_buffer
+	 * 	replaces the oldest element.
+	 *
+	 * 	It can be used as the container of %queue:
+	 *
+	 * 	ft::queue<int, ft::ring_buffer<int> > q;
+	*/
+	template <class T, class Allocator = allocator<T> >
+	class ring_buffer
+	{
+		/* Member types */
+
+		public:
+
+		typedef T									value_type;
+		typedef Allocator							allocator_type;
+		typedef std::size_t							size_type;
+		typedef std::ptrdiff_t						difference_type;
+		typedef value_type&							reference;
+		typedef const value_type&					const_reference;
+		typedef value_type*							pointer;
+		typedef const value_type*					const_pointer;
+
+		typedef ring_buffer_iterator<T, T&, T*>				iterator;
+		typedef ring_buffer_iterator<T, const T&, const T*>	const_iterator;
+		typedef FT_NAMESPACE::reverse_iterator<const_iterator>	const_reverse_iterator;
+		typedef FT_NAMESPACE::reverse_iterator<iterator>		reverse_iterator;
+
+		/* Core:
+		 *
+		 * buff -> The buffer of @c cap elements.
+		 * cap -> The capacity, a power of two (or 0).
+		 * head -> The counter of the first element.
+		 * tail -> The counter past the last element.
+		 * overwrite -> True in overwrite mode.
+		*/
+
+		private:
+
+		pointer			buff;
+		size_type		cap;
+		size_type		head;
+		size_type		tail;
+		bool			overwrite;
+		allocator_type	memory;
+
+		/* Auxiliar functions */
+
+		pointer				rb_at(size_type counter) const throw();
+		void				rb_reallocate(size_type new_cap) throw(std::bad_alloc);
+		void				rb_release() throw();
+		void				rb_make_room(size_type n) throw(std::bad_alloc);
+		static size_type	rb_round_capacity(size_type n) throw();
+
+		/* Member functions */
+
+		public:
+
+		ring_buffer();
+		explicit ring_buffer(const allocator_type& alloc);
+		explicit ring_buffer(size_type capacity, bool overwrite_mode = false, const allocator_type& alloc = allocator_type());
+		ring_buffer(const ring_buffer& other);
+		ring_buffer(ring_buffer&& other);
+		~ring_buffer();
+		ring_buffer&			operator=(const ring_buffer& other);
+		ring_buffer&			operator=(ring_buffer&& other);
+		allocator_type			get_allocator() const;
+
+		/* Element access */
+		reference				operator[](size_type n);
+		const_reference			operator[](size_type n) const;
+		reference				at(size_type n);
+		const_reference			at(size_type n) const;
+		reference				front();
+		const_reference			front() const;
+		reference				back();
+		const_reference			back() const;
+
+		/* Iterators */
+		iterator				begin();
+		const_iterator			begin() const;
+		iterator				end();
+		const_iterator			end() const;
+		reverse_iterator		rbegin();
+		const_reverse_iterator	rbegin() const;
+		reverse_iterator		rend();
+		const_reverse_iterator	rend() const;
+
+		/* Capacity */
+		size_type				size() const;
+		size_type				max_size() const;
+		size_type				capacity() const;
+		bool					empty() const;
+		bool					full() const;
+		bool					overwrites() const;
+		void					reserve(size_type n);
+
+		/* Modifiers */
+		void					clear();
+		void					push_back(const_reference x);
+		void					push_back(value_type&& x);
+		template <typename... Args>
+		reference				emplace_back(Args&&... args);
+		void					pop_front();
+		void					push_back_n(const_pointer src, size_type n);
+		size_type				pop_front_n(pointer dst, size_type n);
+		void					swap(ring_buffer& other);
+	};
+
+	////////////////////////
+	// Auxiliar functions //
+	////////////////////////
+
+	/**
+	 * 	@brief At
+	 *
+	 * 	@param counter A counter.
+	 * 	@return The slot of @p counter.
+	*/
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::pointer
+	ring_buffer<T, Allocator>::rb_at(size_type counter) const
+	throw()
+	{ return (buff + (counter & (cap - 1))); }
+
+	/**
+	 * 	@brief Reallocate
+	 *
+	 * 	@param new_cap The new capacity, a power of two >= @c size().
+	 *
+	 * 	Moves the elements to the begining of a new buffer.
+	 *
+	 * 	@throw std::bad_alloc, @c *this is then untouched.
+	*/
+	template <class T, class Allocator>
+	void
+	ring_buffer<T, Allocator>::rb_reallocate(size_type new_cap)
+	throw(::std::bad_alloc)
+	{
+		const size_type	s = size();
+		pointer			tmp = memory.allocate(new_cap);
+		size_type		i = 0;
+
+		try {
+			for ( ; i < s ; i++)
+				memory.construct(tmp + i, std::move(*rb_at(head + i)));
+		} catch (...) {
+			while (i)
+				memory.destroy(tmp + --i);
+			memory.deallocate(tmp, new_cap);
+			throw;
+		}
+		rb_release();
+		buff = tmp;
+		cap = new_cap;
+		head = 0;
+		tail = s;
+	}
+
+	/**
+	 * 	@brief Release
+	 *
+	 * 	Destroys the elements and deallocates the buffer, the counters
+	 * 	are not reset.
+	*/
+	template <class T, class Allocator>
+	void
+	ring_buffer<T, Allocator>::rb_release()
+	throw()
+	{
+		for (size_type i = head ; i != tail ; i++)
+			memory.destroy(rb_at(i));
+		if (buff)
+			memory.deallocate(buff, cap);
+	}
+
+	/**
+	 * 	@brief Make room
+	 *
+	 * 	@param n The amount of elements that will be appended.
+	 *
+	 * 	Grows the buffer, or in overwrite mode pops the oldest elements.
+	*/
+	template <class T, class Allocator>
+	void
+	ring_buffer<T, Allocator>::rb_make_room(size_type n)
+	throw(::std::bad_alloc)
+	{
+		if (!overwrite)
+			reserve(size() + n);
+		else
+			while (size() + n > cap && !empty())
+				pop_front();
+	}
+
+	/**
+	 * 	@brief Round capacity
+	 *
+	 * 	@param n A capacity.
+	 * 	@return The smallest power of two >= @p n.
+	*/
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::size_type
+	ring_buffer<T, Allocator>::rb_round_capacity(size_type n)
+	throw()
+	{
+		size_type	res = 1;
+
+		while (res < n)
+			res <<= 1;
+		return (res);
+	}
+
+	//////////////////////
+	// Member functions //
+	//////////////////////
+
+	/**
+	 * 	@brief Default Constructor
+	 *
+	 * 	Growing mode, no allocation until the first push.
+	*/
+	template <class T, class Allocator>
+	ring_buffer<T, Allocator>::ring_buffer()
+	: buff(), cap(), head(), tail(), overwrite(false), memory()
+	{ }
+
+	template <class T, class Allocator>
+	ring_buffer<T, Allocator>::ring_buffer(const allocator_type& alloc)
+	: buff(), cap(), head(), tail(), overwrite(false), memory(alloc)
+	{ }
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param capacity The capacity, rounded up to a power of two.
+	 * 	@param overwrite_mode True to fix the capacity and overwrite the oldest elements.
+	 * 	@param alloc An allocator type.
+	*/
+	template <class T, class Allocator>
+	ring_buffer<T, Allocator>::ring_buffer(size_type capacity, bool overwrite_mode, const allocator_type& alloc)
+	: buff(), cap(), head(), tail(), overwrite(overwrite_mode), memory(alloc)
+	{
+		cap = rb_round_capacity(capacity);
+		buff = memory.allocate(cap);
+	}
+
+	/**
+	 * 	@brief Copy Constructor
+	 *
+	 * 	@param other A %ring_buffer, its mode and capacity are copied.
+	*/
+	template <class T, class Allocator>
+	ring_buffer<T, Allocator>::ring_buffer(const ring_buffer& other)
+	: buff(), cap(), head(), tail(), overwrite(other.overwrite), memory(other.memory)
+	{
+		if (other.cap)
+		{
+			buff = memory.allocate(other.cap);
+			cap = other.cap;
+		}
+		try {
+			for (size_type i = other.head ; i != other.tail ; i++, tail++)
+				memory.construct(buff + tail, *other.rb_at(i));
+		} catch (...) {
+			rb_release();
+			throw;
+		}
+	}
+
+	/**
+	 * 	@brief Move Constructor
+	 *
+	 * 	@param other A %ring_buffer, left empty without buffer.
+	*/
+	template <class T, class Allocator>
+	ring_buffer<T, Allocator>::ring_buffer(ring_buffer&& other)
+	: buff(other.buff), cap(other.cap), head(other.head), tail(other.tail),
+	overwrite(other.overwrite), memory(other.memory)
+	{
+		other.buff = pointer();
+		other.cap = 0;
+		other.head = 0;
+		other.tail = 0;
+	}
+
+	/**
+	 * 	@brief Destructor
+	*/
+	template <class T, class Allocator>
+	ring_buffer<T, Allocator>::~ring_buffer()
+	{ rb_release(); }
+
+	/**
+	 * 	@brief operator=
+	 *
+	 * 	@param other A %ring_buffer.
+	 * 	@return @c *this.
+	*/
+	template <class T, class Allocator>
+	ring_buffer<T, Allocator>&
+	ring_buffer<T, Allocator>::operator=(const ring_buffer& other)
+	{
+		if (this != &other)
+		{
+			ring_buffer tmp(other);
+
+			swap(tmp);
+		}
+		return (*this);
+	}
+
+	template <class T, class Allocator>
+	ring_buffer<T, Allocator>&
+	ring_buffer<T, Allocator>::operator=(ring_buffer&& other)
+	{
+		if (this != &other)
+		{
+			ring_buffer tmp(std::move(other));
+
+			swap(tmp);
+		}
+		return (*this);
+	}
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::allocator_type
+	ring_buffer<T, Allocator>::get_allocator() const
+	{ return (memory); }
+
+	////////////////////
+	// Element access //
+	////////////////////
+
+	//@{
+	/**
+	 * 	@brief Element access
+	 *
+	 * 	The index 0 is the oldest element.
+	*/
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::reference
+	ring_buffer<T, Allocator>::operator[](size_type n)
+	{ return (*rb_at(head + n)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::const_reference
+	ring_buffer<T, Allocator>::operator[](size_type n) const
+	{ return (*rb_at(head + n)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::reference
+	ring_buffer<T, Allocator>::at(size_type n)
+	{
+		if (n >= size())
+			throw std::out_of_range(std::string("ring_buffer::at() out of range"));
+		return (*rb_at(head + n));
+	}
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::const_reference
+	ring_buffer<T, Allocator>::at(size_type n) const
+	{
+		if (n >= size())
+			throw std::out_of_range(std::string("ring_buffer::at() out of range"));
+		return (*rb_at(head + n));
+	}
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::reference
+	ring_buffer<T, Allocator>::front()
+	{ return (*rb_at(head)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::const_reference
+	ring_buffer<T, Allocator>::front() const
+	{ return (*rb_at(head)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::reference
+	ring_buffer<T, Allocator>::back()
+	{ return (*rb_at(tail - 1)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::const_reference
+	ring_buffer<T, Allocator>::back() const
+	{ return (*rb_at(tail - 1)); }
+	//@}
+
+	///////////////
+	// Iterators //
+	///////////////
+
+	//@{
+	/**
+	 * 	@brief Iterators
+	 *
+	 * 	From the oldest to the newest element.
+	*/
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::iterator
+	ring_buffer<T, Allocator>::begin()
+	{ return (iterator(buff, cap - 1, head)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::const_iterator
+	ring_buffer<T, Allocator>::begin() const
+	{ return (const_iterator(buff, cap - 1, head)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::iterator
+	ring_buffer<T, Allocator>::end()
+	{ return (iterator(buff, cap - 1, tail)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::const_iterator
+	ring_buffer<T, Allocator>::end() const
+	{ return (const_iterator(buff, cap - 1, tail)); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::reverse_iterator
+	ring_buffer<T, Allocator>::rbegin()
+	{ return (reverse_iterator(end())); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::const_reverse_iterator
+	ring_buffer<T, Allocator>::rbegin() const
+	{ return (const_reverse_iterator(end())); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::reverse_iterator
+	ring_buffer<T, Allocator>::rend()
+	{ return (reverse_iterator(begin())); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::const_reverse_iterator
+	ring_buffer<T, Allocator>::rend() const
+	{ return (const_reverse_iterator(begin())); }
+	//@}
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::size_type
+	ring_buffer<T, Allocator>::size() const
+	{ return (tail - head); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::size_type
+	ring_buffer<T, Allocator>::max_size() const
+	{ return (size_type(std::numeric_limits<size_type>::max() / sizeof(value_type))); }
+
+	template <class T, class Allocator>
+	inline typename ring_buffer<T, Allocator>::size_type
+	ring_buffer<T, Allocator>::capacity() const
+	{ return (cap); }
+
+	template <class T, class Allocator>
+	inline bool
+	ring_buffer<T, Allocator>::empty() const
+	{ return (head == tail); }
+
+	template <class T, class Allocator>
+	inline bool
+	ring_buffer<T, Allocator>::full() const
+	{ return (size() == cap); }
+
+	/**
+	 * 	@brief overwrites
+	 *
+	 * 	@return True in overwrite mode.
+	*/
+	template <class T, class Allocator>
+	inline bool
+	ring_buffer<T, Allocator>::overwrites() const
+	{ return (overwrite); }
+
+	/**
+	 * 	@brief reserve
+	 *
+	 * 	@param n The minimum capacity.
+	 *
+	 * 	The capacity becomes the smallest power of two >= @p n (at least
+	 * 	FT_RING_BUFFER_MIN_CAPACITY), even in overwrite mode.
+	*/
+	template <class T, class Allocator>
+	void
+	ring_buffer<T, Allocator>::reserve(size_type n)
+	{
+		if (n > cap)
+			rb_reallocate(rb_round_capacity(n < size_type(FT_RING_BUFFER_MIN_CAPACITY)
+			? size_type(FT_RING_BUFFER_MIN_CAPACITY) : n));
+	}
+
+	///////////////
+	// Modifiers //
+	///////////////
+
+	/**
+	 * 	@brief clear
+	 *
+	 * 	Destroys all the elements, the buffer is kept.
+	*/
+	template <class T, class Allocator>
+	void
+	ring_buffer<T, Allocator>::clear()
+	{
+		for ( ; head != tail ; head++)
+			memory.destroy(rb_at(head));
+		head = 0;
+		tail = 0;
+	}
+
+	template <class T, class Allocator>
+	inline void
+	ring_buffer<T, Allocator>::push_back(const_reference x)
+	{ emplace_back(x); }
+
+	template <class T, class Allocator>
+	inline void
+	ring_buffer<T, Allocator>::push_back(value_type&& x)
+	{ emplace_back(std::move(x)); }
+
+	/**
+	 * 	@brief emplace back
+	 *
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return A reference to the appended element.
+	 *
+	 * 	When @c *this is full it grows, or in overwrite mode the oldest
+	 * 	element is replaced.
+	*/
+	template <class T, class Allocator>
+	template <typename... Args>
+	typename ring_buffer<T, Allocator>::reference
+	ring_buffer<T, Allocator>::emplace_back(Args&&... args)
+	{
+		if (size() < cap)
+			memory.construct(rb_at(tail), std::forward<Args>(args)...);
+		else
+		{
+			/* @p args may be an element of *this */
+			value_type tmp(std::forward<Args>(args)...);
+
+			if (overwrite)
+				pop_front();
+			else
+				rb_reallocate(cap ? cap * 2 : size_type(FT_RING_BUFFER_MIN_CAPACITY));
+			memory.construct(rb_at(tail), std::move(tmp));
+		}
+		return (*rb_at(tail++));
+	}
+
+	/**
+	 * 	@brief pop front
+	 *
+	 * 	Removes the oldest element.
+	*/
+	template <class T, class Allocator>
+	inline void
+	ring_buffer<T, Allocator>::pop_front()
+	{
+		if (!empty())
+			memory.destroy(rb_at(head++));
+	}
+
+	/**
+	 * 	@brief push back n
+	 *
+	 * 	@param src An array of @p n elements (not in @c *this).
+	 * 	@param n The amount of elements.
+	 *
+	 * 	Appends the elements of @p src in at most two contiguous copies.
+	 * 	In overwrite mode only the last @c capacity() ones are kept.
+	*/
+	template <class T, class Allocator>
+	void
+	ring_buffer<T, Allocator>::push_back_n(const_pointer src, size_type n)
+	{
+		if (overwrite && n > cap)
+		{
+			src += n - cap;
+			n = cap;
+		}
+		rb_make_room(n);
+
+		const size_type	first = tail & (cap - 1);
+		const size_type	run = n < cap - first ? n : cap - first;
+
+		for (size_type i = 0 ; i < run ; i++, tail++)
+			memory.construct(buff + first + i, src[i]);
+		for (size_type i = run ; i < n ; i++, tail++)
+			memory.construct(buff + (i - run), src[i]);
+	}
+
+	/**
+	 * 	@brief pop front n
+	 *
+	 * 	@param dst An array of at least @p n constructed elements.
+	 * 	@param n The maximum amount of elements.
+	 * 	@return The amount of elements moved to @p dst.
+	 *
+	 * 	Moves the oldest elements to @p dst in at most two contiguous runs,
+	 * 	then removes them.
+	*/
+	template <class T, class Allocator>
+	typename ring_buffer<T, Allocator>::size_type
+	ring_buffer<T, Allocator>::pop_front_n(pointer dst, size_type n)
+	{
+		if (n > size())
+			n = size();
+
+		const size_type	first = head & (cap - 1);
+		const size_type	run = n < cap - first ? n : cap - first;
+
+		for (size_type i = 0 ; i < run ; i++, head++)
+		{
+			dst[i] = std::move(buff[first + i]);
+			memory.destroy(buff + first + i);
+		}
+		for (size_type i = run ; i < n ; i++, head++)
+		{
+			dst[i] = std::move(buff[i - run]);
+			memory.destroy(buff + (i - run));
+		}
+		return (n);
+	}
+
+	/**
+	 * 	@brief swap
+	 *
+	 * 	@param other A %ring_buffer.
+	 *
+	 * 	Swaps the buffers, the modes and the allocators.
+	*/
+	template <class T, class Allocator>
+	void
+	ring_buffer<T, Allocator>::swap(ring_buffer& other)
+	{
+		const pointer			tmp_buff = buff;
+		const size_type			tmp_cap = cap;
+		const size_type			tmp_head = head;
+		const size_type			tmp_tail = tail;
+		const bool				tmp_overwrite = overwrite;
+		const allocator_type	tmp_memory = memory;
+
+		buff = other.buff;
+		cap = other.cap;
+		head = other.head;
+		tail = other.tail;
+		overwrite = other.overwrite;
+		memory = other.memory;
+		other.buff = tmp_buff;
+		other.cap = tmp_cap;
+		other.head = tmp_head;
+		other.tail = tmp_tail;
+		other.overwrite = tmp_overwrite;
+		other.memory = tmp_memory;
+	}
+
+	/////////////////
+	// Non members //
+	/////////////////
+
+	//@{
+	/** @brief Boolean operators
+	 *
+	 * 	@param lhs A %ring_buffer.
+	 * 	@param rhs A %ring_buffer of the same type of @a lhs.
+	 *
+	 * 	@return A boolean that is the result of the requested boolean operation.
+	*/
+	template <class T, class Allocator>
+	inline bool
+	operator==(const ring_buffer<T, Allocator>& lhs, const ring_buffer<T, Allocator>& rhs)
+	{ return (lhs.size() == rhs.size() && FT_NAMESPACE::equal(lhs.begin(), lhs.end(), rhs.begin())); }
+
+	template <class T, class Allocator>
+	inline bool
+	operator<(const ring_buffer<T, Allocator>& lhs, const ring_buffer<T, Allocator>& rhs)
+	{ return (FT_NAMESPACE::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
+
+	template <class T, class Allocator>
+	inline bool
+	operator!=(const ring_buffer<T, Allocator>& lhs, const ring_buffer<T, Allocator>& rhs)
+	{ return (!(lhs == rhs)); }
+
+	template <class T, class Allocator>
+	inline bool
+	operator>(const ring_buffer<T, Allocator>& lhs, const ring_buffer<T, Allocator>& rhs)
+	{ return (rhs < lhs); }
+
+	template <class T, class Allocator>
+	inline bool
+	operator>=(const ring_buffer<T, Allocator>& lhs, const ring_buffer<T, Allocator>& rhs)
+	{ return (!(lhs < rhs)); }
+
+	template <class T, class Allocator>
+	inline bool
+	operator<=(const ring_buffer<T, Allocator>& lhs, const ring_buffer<T, Allocator>& rhs)
+	{ return (!(rhs < lhs)); }
+	//@}
+
+	template <class T, class Allocator>
+	inline void
+	swap(ring_buffer<T, Allocator>& lhs, ring_buffer<T, Allocator>& rhs)
+	{ lhs.swap(rhs); }
+};
@@ -7,6 +7,7 @@
 # pragma once
 
 # include <ft_rbtree.hpp>
+# include <algorithm.hpp>
 # include <ft_allocator.hpp>
 
 namespace FT_NAMESPACE
@@ -49,12 +50,13 @@ namespace FT_NAMESPACE
 		typedef typename Tree::pointer			pointer;
 		typedef typename Tree::const_pointer	const_pointer;
 		typedef typename Tree::size_type		size_type;
-		typedef typename Tree::difference_type	difference_type;
+		typedef typename Tree::difference_size	difference_type;
 
-		typedef typename Tree::iterator			iterator;
+		/* The keys are read only: iterator is a const iterator */
+		typedef typename Tree::const_iterator	iterator;
 		typedef typename Tree::const_iterator	const_iterator;
 
-		typedef typename Tree::reverse_iterator			reverse_iterator;
+		typedef typename Tree::const_reverse_iterator	reverse_iterator;
 		typedef typename Tree::const_reverse_iterator	const_reverse_iterator;
 
 		/* Member functions */
@@ -65,16 +67,21 @@ namespace FT_NAMESPACE
 		set(InputIt first, InputIt last);
 		template <typename InputIt>
 		set(InputIt first, InputIt last, const value_compare& cmp, const allocator_type& alloc = allocator_type());
+		template <typename InputIt>
+		set(sorted_unique_t, InputIt first, InputIt last, const value_compare& cmp = value_compare(),
+			const allocator_type& alloc = allocator_type());
 		set(const set& other);
+		set(set&& other);
 
 		set&			operator=(const set& other);
+		set&			operator=(set&& other);
+		allocator_type	get_allocator() const;
 
 		/* Iterators */
-		// TO DO: Check those signatures
 		iterator		begin() const;
 		iterator 		end() const;
-		iterator		rbegin() const;
-		iterator 		rend() const;
+		reverse_iterator	rbegin() const;
+		reverse_iterator	rend() const;
 
 		/* Capacity */
 		bool			empty() const;
@@ -82,20 +89,28 @@ namespace FT_NAMESPACE
 		size_type		max_size() const;
 
 		/* Modifiers */
-		void			clear() const;
-		std::pair<iterator, bool>	insert(const_reference& value);
+		void			clear();
+		std::pair<iterator, bool>	insert(const_reference value);
 		iterator		insert(const_iterator position, const_reference value);
+		std::pair<iterator, bool>	insert(value_type&& value);
+		iterator		insert(const_iterator position, value_type&& value);
+		template <typename... Args>
+		std::pair<iterator, bool>	emplace(Args&&... args);
+		template <typename... Args>
+		iterator		emplace_hint(const_iterator position, Args&&... args);
+		template <typename InputIt>
+		void			insert(InputIt first, InputIt last);
 		template <typename InputIt>
-		iterator		insert(InputIt first, InputIt last);
-		iterator		erase(iterator position);
+		void			insert(sorted_unique_t, InputIt first, InputIt last);
+		void			erase(iterator position);
 		size_type		erase(const key_type& k);
 		void			erase(iterator first, iterator last);
-		void			swap(const set& other);
+		void			swap(set& other);
 		
 		/* Lookup */
 		size_type		count(const key_type& k) const;
-		iterator		find(cost key_type& k);
-		const_iterator	find(cost key_type& k) const;
+		iterator		find(const key_type& k);
+		const_iterator	find(const key_type& k) const;
 		std::pair<iterator, iterator>	equal_range(const key_type& k);
 		std::pair<const_iterator, const_iterator>	equal_range(const key_type& k) const;
 		iterator		lower_bound(const key_type& k);
@@ -103,14 +118,19 @@ namespace FT_NAMESPACE
 		iterator		upper_bound(const key_type& k);
 		const_iterator	upper_bound(const key_type& k) const;
 
+		/* Order statistics */
+		iterator		nth(size_type k);
+		const_iterator	nth(size_type k) const;
+		size_type		rank(const key_type& k) const;
+
 		/* Observers */
 		key_compare		key_comp() const;
 		key_compare		value_comp() const;
 		
 		/* Non-members */
-		template <typename <K1, typename C1, typename A1>
+		template <typename K1, typename C1, typename A1>
 		friend bool operator==(const set<K1, C1, A1>& lhs, const set<K1, C1, A1>& rhs);
-		template <typename <K1, typename C1, typename A1>
+		template <typename K1, typename C1, typename A1>
 		friend bool operator<(const set<K1, C1, A1>& lhs, const set<K1, C1, A1>& rhs);
 	};
 
@@ -169,6 +189,24 @@ namespace FT_NAMESPACE
 	: tree(cmp, alloc)
 	{ tree.aux_insert_range_unique(first, last); }
 
+	/**
+	 * 	@brief Sorted Range Constructor
+	 * 
+	 * 	@tparam InputIt An input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 	@param cmp A comparison object.
+	 * 	@param alloc An allocator.
+	 *
+	 * 	Create a set filled with copies of @p first - @p last range, in linear time.
+	 * 	NOTE: The range must be sorted with @p cmp without equal keys.
+	*/
+	template <class Key, class Compare, class Alloc>
+	template <typename InputIt>
+	set<Key, Compare, Alloc>::set(sorted_unique_t, InputIt first, InputIt last, const value_compare& cmp, const allocator_type& alloc)
+	: tree(cmp, alloc)
+	{ tree.aux_insert_range_unique(sorted_unique_t(), first, last); }
+
 	/**
 	 * 	@brief Copy Constructor
 	 * 
@@ -179,6 +217,16 @@ namespace FT_NAMESPACE
 	: tree(other.tree)
 	{ }
 
+	/**
+	 * 	@brief Move Constructor
+	 * 
+	 * 	@param other A %set of the same type of @c *this, left empty.
+	*/
+	template <class Key, class Compare, class Alloc>
+	set<Key, Compare, Alloc>::set(set&& other)
+	: tree(std::move(other.tree))
+	{ }
+
 	/**
 	 * 	@brief operator=
 	 * 
@@ -195,6 +243,29 @@ namespace FT_NAMESPACE
 		return (*this);
 	}
 
+	/**
+	 * 	@brief operator=
+	 * 
+	 * 	@param other A %set with the same type of @c *this, left empty.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline set<Key, Compare, Alloc>&
+	set<Key, Compare, Alloc>::operator=(set&& other)
+	{
+		tree = std::move(other.tree);
+		return (*this);
+	}
+
+	/**
+	 * 	@brief get allocator
+	 * 
+	 * 	@return A copy of the allocator used by the %set.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename set<Key, Compare, Alloc>::allocator_type
+	set<Key, Compare, Alloc>::get_allocator() const
+	{ return (tree.get_allocator()); }
+
 	///////////////
 	// Iterators //
 	///////////////
@@ -225,7 +296,7 @@ namespace FT_NAMESPACE
 	 * 	@return A revese iterator pointing to the first element of @c *this.
 	*/
 	template <class Key, class Compare, class Alloc>
-	inline typename set<Key, Compare, Alloc>::iterator
+	inline typename set<Key, Compare, Alloc>::reverse_iterator
 	set<Key, Compare, Alloc>::rbegin() const 
 	{ return (tree.rbegin()); }
 
@@ -235,7 +306,7 @@ namespace FT_NAMESPACE
 	 * 	@return An iterator pointing to the last element of @c *this.
 	*/
 	template <class Key, class Compare, class Alloc>
-	inline typename set<Key, Compare, Alloc>::iterator
+	inline typename set<Key, Compare, Alloc>::reverse_iterator
 	set<Key, Compare, Alloc>::rend() const
 	{ return (tree.rend()); }
 
@@ -284,7 +355,7 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline void
-	set<Key, Compare, Alloc>::clear() const
+	set<Key, Compare, Alloc>::clear()
 	{ tree.clear(); }
 
 	/**
@@ -297,7 +368,7 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline ::std::pair<typename set<Key, Compare, Alloc>::iterator, bool>
-	insert(const_reference& value)
+	set<Key, Compare, Alloc>::insert(const_reference value)
 	{ return (tree.aux_insert_unique(value)); }
 
 	/**
@@ -309,12 +380,63 @@ namespace FT_NAMESPACE
 	 * 	Attemps to insert @p value ussing position as hint.
 	 * 	NOTE: position (if is set correctly) is just to increase the speed execution.
 	 * 		This function perform the same operation as insert(const_reference) signature.
+	 * 	If @p value goes just before position (or just after it) the position
+	 * 	is found in amortized constant time, logarithmic otherwise.
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline typename set<Key, Compare, Alloc>::iterator
 	set<Key, Compare, Alloc>::insert(const_iterator position, const_reference value)
 	{ return (tree.aux_insert_unique(position, value)); }
 
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param value The value to be inserted, it is moved.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline ::std::pair<typename set<Key, Compare, Alloc>::iterator, bool>
+	set<Key, Compare, Alloc>::insert(value_type&& value)
+	{ return (tree.aux_insert_unique(std::move(value))); }
+
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param pos A hint of the insertion position.
+	 * 	@param value The value to be inserted, it is moved.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename set<Key, Compare, Alloc>::iterator
+	set<Key, Compare, Alloc>::insert(const_iterator pos, value_type&& value)
+	{ return (tree.aux_insert_unique(pos, std::move(value))); }
+
+	/**
+	 * 	@brief emplace
+	 * 
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return A pair of an iterator to the element with the same key
+	 * 	and true if the insertion was performed.
+	 * 
+	 * 	The value is constructed in place in a new node.
+	*/
+	template <class Key, class Compare, class Alloc>
+	template <typename... Args>
+	inline ::std::pair<typename set<Key, Compare, Alloc>::iterator, bool>
+	set<Key, Compare, Alloc>::emplace(Args&&... args)
+	{ return (tree.aux_emplace_unique(std::forward<Args>(args)...)); }
+
+	/**
+	 * 	@brief emplace hint
+	 * 
+	 * 	@param pos A hint of the insertion position.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the element with the same key.
+	*/
+	template <class Key, class Compare, class Alloc>
+	template <typename... Args>
+	inline typename set<Key, Compare, Alloc>::iterator
+	set<Key, Compare, Alloc>::emplace_hint(const_iterator pos, Args&&... args)
+	{ return (tree.aux_emplace_hint_unique(pos, std::forward<Args>(args)...)); }
+
 	/**
 	 * 	@brief insert
 	 * 
@@ -326,9 +448,25 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	template <typename InputIt>
-	inline typename set<Key, Compare, Alloc>::iterator
+	inline void
 	set<Key, Compare, Alloc>::insert(InputIt first, InputIt last)
-	{ return (tree.aux_insert_range_unique(first, last)); }
+	{ tree.aux_insert_range_unique(first, last); }
+
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@tparam InputIt an input iterator.
+	 * 	@param first An InputIt.
+	 * 	@param last An InputIt.
+	 * 
+	 * 	Inserts the sorted range @p first - @p last (without equal keys),
+	 * 	if @c *this is empty it is built in linear time.
+	*/
+	template <class Key, class Compare, class Alloc>
+	template <typename InputIt>
+	inline void
+	set<Key, Compare, Alloc>::insert(sorted_unique_t, InputIt first, InputIt last)
+	{ tree.aux_insert_range_unique(sorted_unique_t(), first, last); }
 
 	/**
 	 * 	@brief erase
@@ -340,9 +478,9 @@ namespace FT_NAMESPACE
 	 * 		 * 	Erase the element holded at @p position.
 	*/
 	template <class Key, class Compare, class Alloc>
-	inline typename set<Key, Compare, Alloc>::iterator
+	inline void
 	set<Key, Compare, Alloc>::erase(iterator position)
-	{ return (tree.erase(position)); }
+	{ tree.erase(position); }
 
 		/**
 	 * 	@brief erase
@@ -380,7 +518,7 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline void
-	set<Key, Compare, Alloc>::swap(const set& other)
+	set<Key, Compare, Alloc>::swap(set& other)
 	{ tree.swap(other.tree); }
 
 	////////////
@@ -409,7 +547,7 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline typename set<Key, Compare, Alloc>::iterator
-	find(cost key_type& k)
+	set<Key, Compare, Alloc>::find(const key_type& k)
 	{ return (tree.find(k)); }
 
 	/**
@@ -420,7 +558,7 @@ namespace FT_NAMESPACE
 	*/
 	template <class Key, class Compare, class Alloc>
 	inline typename set<Key, Compare, Alloc>::const_iterator
-	set<Key, Compare, Alloc>::find(cost key_type& k) const
+	set<Key, Compare, Alloc>::find(const key_type& k) const
 	{ return (tree.find(k)); }
 
 	/**
@@ -489,6 +627,50 @@ namespace FT_NAMESPACE
 	set<Key, Compare, Alloc>::upper_bound(const key_type& k) const
 	{ return (tree.upper_bound(k)); }
 
+	//////////////////////
+	// Order statistics //
+	//////////////////////
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return An iterator to the @p k th element in key order (from 0),
+	 * 	end() if @p k isn't less than size().
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename set<Key, Compare, Alloc>::iterator
+	set<Key, Compare, Alloc>::nth(size_type k)
+	{ return (tree.nth(k)); }
+
+	/**
+	 * 	@brief nth
+	 * 
+	 * 	@param k An index.
+	 * 
+	 * 	@return A const iterator to the @p k th element in key order.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename set<Key, Compare, Alloc>::const_iterator
+	set<Key, Compare, Alloc>::nth(size_type k) const
+	{ return (tree.nth(k)); }
+
+	/**
+	 * 	@brief rank
+	 * 
+	 * 	@param k A key.
+	 * 
+	 * 	@return The amount of elements with a key less than @p k.
+	 * 	NOTE: Logarithmic if FT_RBTREE_ORDER_STATISTICS, else linear.
+	 * 	ft::distance() between two iterators is logarithmic too.
+	*/
+	template <class Key, class Compare, class Alloc>
+	inline typename set<Key, Compare, Alloc>::size_type
+	set<Key, Compare, Alloc>::rank(const key_type& k) const
+	{ return (tree.rank(k)); }
+
 	///////////////
 	// Observers //
 	///////////////
@@ -564,6 +746,6 @@ namespace FT_NAMESPACE
 	*/
 	template <typename Key, typename Compare, typename Alloc>
 	inline void
-	swap(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
+	swap(set<Key, Compare, Alloc>& lhs, set<Key, Compare, Alloc>& rhs)
 	{ lhs.swap(rhs); }
 };
@@ -0,0 +1,318 @@
+/** @file small_vector.hpp
+ *
+ * 	This file contains the small buffer optimised vector implementation.
+*/
+
+# pragma once
+
+# include "vector.hpp"
+
+# include <cstring>
+
+namespace FT_NAMESPACE
+{
+	/**
+	 * 	@brief Small buffer
+	 *
+	 * 	@tparam N The amount of elements stored inline.
+	 * 	@tparam Alloc The allocator used once the inline storage is full.
+	 *
+	 * 	Tag given as Allocator to %vector, it selects the %vector_algorithm
+	 * 	holding an inline storage (see: small_vector).
+	*/
+	template <std::size_t N, class Alloc>
+	struct small_buffer { };
+
+	//////////////////////////
+	// Small buffer storage //
+	//////////////////////////
+
+	/**
+	 * 	@brief Vector Algorithm with a small buffer
+	 *
+	 * 	Same interface than the %vector_algorithm it specialises. The block
+	 * 	starts in the inline storage @c buff, the heap is only used when more
+	 * 	than N elements are reserved. The inline storage is never deallocated
+	 * 	and its elements can't be stolen: they are moved one by one.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	struct vector_algorithm<T, small_buffer<N, Alloc> >
+	{
+		/* Member types */
+
+		typedef Alloc		allocator_type;
+		typedef T*			pointer;
+		typedef std::size_t	size_type;
+
+		/* Core */
+
+		pointer				head;
+		pointer				tail;
+		pointer				storage;
+		allocator_type		memory;
+		alignas(T) unsigned char	buff[N ? N * sizeof(T) : 1];
+
+		/* Member functions */
+
+		/* Constructors */
+		vector_algorithm();
+		vector_algorithm(const vector_algorithm&);
+		vector_algorithm(const allocator_type& alloc);
+		vector_algorithm(size_type n);
+		vector_algorithm(size_type n, const allocator_type& alloc);
+
+		/* Destructor */
+		~vector_algorithm();
+
+		/* Fast type basic operations */
+		void		alg_swap_data(vector_algorithm& other) throw();
+		void		alg_move_data(vector_algorithm& other) throw();
+		pointer		alg_allocate(size_type n) throw(std::bad_alloc);
+		void		alg_deallocate(pointer p, size_type n) throw();
+		pointer		alg_reallocate(pointer p, size_type old_n, size_type new_n) throw(std::bad_alloc);
+		bool		alg_is_inline() const throw();
+
+		protected:
+
+		pointer		alg_inline() throw();
+		void		alg_reset() throw();
+		void		alg_reserve(size_type n) throw(std::bad_alloc);
+	};
+
+	/**
+	 * 	@brief Constructors
+	 *
+	 * 	The block starts in the inline storage, no heap memory is taken
+	 * 	if @p n is not greather than N. The size is @p n, the caller
+	 * 	constructs the elements (the capacity may be greather).
+	*/
+	//@{
+	template <class T, std::size_t N, class Alloc>
+	vector_algorithm<T, small_buffer<N, Alloc> >::vector_algorithm()
+	: memory()
+	{ alg_reset(); }
+
+	template <class T, std::size_t N, class Alloc>
+	vector_algorithm<T, small_buffer<N, Alloc> >::vector_algorithm(const vector_algorithm& other)
+	: memory(other.memory)
+	{ alg_reset(); }
+
+	template <class T, std::size_t N, class Alloc>
+	vector_algorithm<T, small_buffer<N, Alloc> >::vector_algorithm(const allocator_type& alloc)
+	: memory(alloc)
+	{ alg_reset(); }
+
+	template <class T, std::size_t N, class Alloc>
+	vector_algorithm<T, small_buffer<N, Alloc> >::vector_algorithm(size_type n)
+	: memory()
+	{
+		alg_reserve(n);
+		tail = head + n;
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	vector_algorithm<T, small_buffer<N, Alloc> >::vector_algorithm(size_type n, const allocator_type& alloc)
+	: memory(alloc)
+	{
+		alg_reserve(n);
+		tail = head + n;
+	}
+	//@}
+
+	/**
+	 * 	@brief Destructor
+	 *
+	 * 	Frees the heap block, if any.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	vector_algorithm<T, small_buffer<N, Alloc> >::~vector_algorithm()
+	{ alg_deallocate(head, size_type(storage - head)); }
+
+	/**
+	 * 	@brief alg_swap_data
+	 *
+	 * 	@param other A %vector_algorithm object
+	 *
+	 * 	Swaps the pointers if both blocks are on the heap, else the elements
+	 * 	are moved through a temporary storage.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	void
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_swap_data(vector_algorithm& other)
+	throw()
+	{
+		if (!alg_is_inline() && !other.alg_is_inline())
+		{
+			std::swap(head, other.head);
+			std::swap(tail, other.tail);
+			std::swap(storage, other.storage);
+			return ;
+		}
+
+		vector_algorithm tmp(memory);
+
+		tmp.alg_move_data(*this);
+		alg_move_data(other);
+		other.alg_move_data(tmp);
+	}
+
+	/**
+	 * 	@brief alg_move_data
+	 *
+	 * 	@param other A %vector_algorithm object.
+	 *
+	 * 	Steals the heap block of @p other, or moves its inline elements into
+	 * 	the inline storage of @c *this. @p other is left empty.
+	 * 	NOTE: The block of @c *this must have been deallocated.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	void
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_move_data(vector_algorithm& other)
+	throw()
+	{
+		if (!other.alg_is_inline())
+		{
+			head = other.head;
+			tail = other.tail;
+			storage = other.storage;
+		}
+		else
+		{
+			alg_reset();
+			for (pointer p = other.head ; p != other.tail ; p++)
+			{
+				memory.construct(tail++, std::move(*p));
+				memory.destroy(p);
+			}
+		}
+		other.alg_reset();
+	}
+
+	/**
+	 * 	@brief alg_allocate
+	 *
+	 * 	@param n The size required on the heap.
+	 *
+	 * 	@return A pointer to the allocated heap block.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	inline typename vector_algorithm<T, small_buffer<N, Alloc> >::pointer
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_allocate(size_type n)
+	throw(::std::bad_alloc)
+	{ return (long(n) >= 0 ? memory.allocate(n) : pointer()); }
+
+	/**
+	 * 	@brief alg_deallocate
+	 *
+	 * 	@param p A pointer to the target memory block.
+	 * 	@param n The size of the block.
+	 *
+	 * 	Does nothing if @p p is the inline storage.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	inline void
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_deallocate(pointer p, size_type n)
+	throw()
+	{
+		if (p != alg_inline())
+			memory.deallocate(p, n);
+	}
+
+	/**
+	 * 	@brief alg_reallocate
+	 *
+	 * 	@param p The current memory block.
+	 * 	@param old_n The size of @p p.
+	 * 	@param new_n The requested size.
+	 *
+	 * 	@return A heap block holding the bytes of @p p.
+	 *
+	 * 	The inline storage is copied to a new heap block.
+	 * 	NOTE: Only usable with trivially relocatable elements.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	typename vector_algorithm<T, small_buffer<N, Alloc> >::pointer
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_reallocate(pointer p, size_type old_n, size_type new_n)
+	throw(::std::bad_alloc)
+	{
+		if (p != alg_inline())
+			return (memory.reallocate(p, old_n, new_n));
+
+		pointer tmp = alg_allocate(new_n);
+
+		std::memcpy(static_cast<void*>(tmp), static_cast<const void*>(p), old_n * sizeof(T));
+		return (tmp);
+	}
+
+	/**
+	 * 	@brief alg_is_inline
+	 *
+	 * 	@return True if the elements are in the inline storage.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	inline bool
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_is_inline() const
+	throw()
+	{ return (static_cast<const void*>(head) == static_cast<const void*>(buff)); }
+
+	template <class T, std::size_t N, class Alloc>
+	inline typename vector_algorithm<T, small_buffer<N, Alloc> >::pointer
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_inline()
+	throw()
+	{ return (reinterpret_cast<pointer>(buff)); }
+
+	/**
+	 * 	@brief alg_reset
+	 *
+	 * 	Points the block to the (empty) inline storage.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	inline void
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_reset()
+	throw()
+	{
+		head = alg_inline();
+		tail = head;
+		storage = pointer(head + N);
+	}
+
+	/**
+	 * 	@brief alg_reserve
+	 *
+	 * 	@param n The new storage size.
+	 *
+	 * 	Uses the inline storage if @p n fits in it, else the heap.
+	*/
+	template <class T, std::size_t N, class Alloc>
+	inline void
+	vector_algorithm<T, small_buffer<N, Alloc> >::alg_reserve(size_type n)
+	throw(::std::bad_alloc)
+	{
+		if (n <= N)
+			return (alg_reset());
+		head = alg_allocate(n);
+		tail = head;
+		storage = head + n;
+	}
+
+	//////////////////
+	// Small vector //
+	//////////////////
+
+	/**
+	 * 	@brief Small vector
+	 *
+	 * 	@tparam T the type of stored values.
+	 * 	@tparam N the amount of elements stored inline.
+	 * 	@tparam Allocator the allocator used on overflow.
+	 * 	@tparam Growth a growth policy (see: ft_growth_policy.hpp)
+	 *
+	 * 	A %vector that holds its N first elements inside the object: no heap
+	 * 	allocation is done until it overflows, then it behaves as a %vector.
+	 * 	It is a %vector, the interface and the iterators are the same.
+	 *
+	 * 	NOTE: Moving or swapping an inline %small_vector moves its elements one by one.
+	*/
+	template <class T, std::size_t N, class Allocator = allocator<T>, class Growth = growth_double>
+	using small_vector = vector<T, small_buffer<N, Allocator>, Growth>;
+};
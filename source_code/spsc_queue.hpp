@@ -0,0 +1,370 @@
+/** @file spsc_queue.hpp
+ *
+ * 	This file contains the lock-free single producer single consumer queue.
+*/
+
+# pragma once
+
+# include <ft_allocator.hpp>
+
+# include <atomic>
+# include <thread>
+
+namespace FT_NAMESPACE
+{
+	/**
+	 * 	@brief Single producer single consumer queue
+	 *
+	 * 	@tparam T The type holded by the queue.
+	 * 	@tparam Allocator An allocator type.
+	 *
+	 * 	A fixed capacity ring (power of two) shared by exactly one producer thread
+	 * 	and one consumer thread, without lock:
+	 *
+	 * 	- %tail is only written by the producer, %head only by the consumer. The
+	 * 	slot is published with a release store and read after an acquire load.
+	 * 	- Each side keeps a cached copy of the other side counter on its own cache
+	 * 	line, the shared counter is only reloaded when the cache says full/empty.
+	 *
+	 * 	Producer: push, try_push, try_emplace, try_push_n.
+	 * 	Consumer: front, pop, try_pop, try_pop_n.
+	 *
+	 * 	NOTE: Calling a producer function from two threads at the same time
+	 * 	(or a consumer one) is a data race.
+	*/
+	template <class T, class Allocator = allocator<T> >
+	class spsc_queue
+	{
+		/* Member types */
+
+		public:
+
+		typedef T					value_type;
+		typedef Allocator			allocator_type;
+		typedef std::size_t			size_type;
+		typedef value_type&			reference;
+		typedef const value_type&	const_reference;
+		typedef value_type*			pointer;
+		typedef const value_type*	const_pointer;
+
+		/* Core:
+		 *
+		 * head -> The counter of the next popped element (consumer side).
+		 * cached_tail -> The last %tail seen by the consumer.
+		 * tail -> The counter of the next pushed element (producer side).
+		 * cached_head -> The last %head seen by the producer.
+		 * buff, mask -> The ring of @c mask + 1 elements, read only.
+		*/
+
+		private:
+
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<size_type>	head;
+		size_type											cached_tail;
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<size_type>	tail;
+		size_type											cached_head;
+		alignas(FT_CACHE_LINE_SIZE) pointer					buff;
+		size_type											mask;
+		allocator_type										memory;
+
+		/* Not copyable: both sides use the object */
+		spsc_queue(const spsc_queue&);
+		spsc_queue&		operator=(const spsc_queue&);
+
+		/* Auxiliar functions */
+
+		size_type		sq_free_slots(size_type t, size_type wanted) throw();
+		size_type		sq_ready_slots(size_type h, size_type wanted) throw();
+
+		/* Member functions */
+
+		public:
+
+		explicit spsc_queue(size_type capacity, const allocator_type& alloc = allocator_type());
+		~spsc_queue();
+
+		/* Capacity */
+		size_type		capacity() const;
+		size_type		size() const;
+		bool			empty() const;
+
+		/* Producer */
+		void			push(const_reference value);
+		void			push(value_type&& value);
+		bool			try_push(const_reference value);
+		bool			try_push(value_type&& value);
+		template <typename... Args>
+		bool			try_emplace(Args&&... args);
+		size_type		try_push_n(const_pointer src, size_type n);
+
+		/* Consumer */
+		reference		front();
+		void			pop();
+		bool			try_pop(reference value);
+		size_type		try_pop_n(pointer dst, size_type n);
+	};
+
+	////////////////////////
+	// Auxiliar functions //
+	////////////////////////
+
+	/**
+	 * 	@brief Free slots
+	 *
+	 * 	@param t The producer counter.
+	 * 	@param wanted The amount of slots the producer needs.
+	 * 	@return The amount of slots the producer can write (producer side).
+	 *
+	 * 	Reloads %head only if the cached copy says less than @p wanted slots
+	 * 	are free.
+	*/
+	template <class T, class Allocator>
+	inline typename spsc_queue<T, Allocator>::size_type
+	spsc_queue<T, Allocator>::sq_free_slots(size_type t, size_type wanted)
+	throw()
+	{
+		if (mask + 1 - (t - cached_head) < wanted)
+			cached_head = head.load(std::memory_order_acquire);
+		return (mask + 1 - (t - cached_head));
+	}
+
+	/**
+	 * 	@brief Ready slots
+	 *
+	 * 	@param h The consumer counter.
+	 * 	@param wanted The amount of elements the consumer needs.
+	 * 	@return The amount of elements the consumer can read (consumer side).
+	 *
+	 * 	Reloads %tail only if the cached copy says less than @p wanted elements
+	 * 	are ready (or is behind %head, after pop calls).
+	*/
+	template <class T, class Allocator>
+	inline typename spsc_queue<T, Allocator>::size_type
+	spsc_queue<T, Allocator>::sq_ready_slots(size_type h, size_type wanted)
+	throw()
+	{
+		const size_type ready = cached_tail - h;
+
+		if (ready > mask + 1 || ready < wanted)
+			cached_tail = tail.load(std::memory_order_acquire);
+		return (cached_tail - h);
+	}
+
+	//////////////////////
+	// Member functions //
+	//////////////////////
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param capacity The capacity, rounded up to a power of two.
+	 * 	@param alloc An allocator type.
+	*/
+	template <class T, class Allocator>
+	spsc_queue<T, Allocator>::spsc_queue(size_type capacity, const allocator_type& alloc)
+	: head(0), cached_tail(0), tail(0), cached_head(0), buff(), mask(1), memory(alloc)
+	{
+		while (mask < capacity)
+			mask <<= 1;
+		buff = memory.allocate(mask--);
+	}
+
+	/**
+	 * 	@brief Destructor
+	 *
+	 * 	Destroys the elements not popped. No thread may use the queue.
+	*/
+	template <class T, class Allocator>
+	spsc_queue<T, Allocator>::~spsc_queue()
+	{
+		const size_type t = tail.load(std::memory_order_acquire);
+
+		for (size_type h = head.load(std::memory_order_relaxed) ; h != t ; h++)
+			memory.destroy(buff + (h & mask));
+		memory.deallocate(buff, mask + 1);
+	}
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	template <class T, class Allocator>
+	inline typename spsc_queue<T, Allocator>::size_type
+	spsc_queue<T, Allocator>::capacity() const
+	{ return (mask + 1); }
+
+	/**
+	 * 	@brief size
+	 *
+	 * 	@return The amount of elements, only a snapshot while the other side works.
+	*/
+	template <class T, class Allocator>
+	inline typename spsc_queue<T, Allocator>::size_type
+	spsc_queue<T, Allocator>::size() const
+	{
+		const size_type h = head.load(std::memory_order_acquire);
+
+		return (tail.load(std::memory_order_acquire) - h);
+	}
+
+	template <class T, class Allocator>
+	inline bool
+	spsc_queue<T, Allocator>::empty() const
+	{ return (size() == 0); }
+
+	//////////////
+	// Producer //
+	//////////////
+
+	/**
+	 * 	@brief push
+	 *
+	 * 	@param value The pushed value.
+	 *
+	 * 	Waits (yielding) while the queue is full.
+	*/
+	template <class T, class Allocator>
+	void
+	spsc_queue<T, Allocator>::push(const_reference value)
+	{
+		while (!try_push(value))
+			std::this_thread::yield();
+	}
+
+	template <class T, class Allocator>
+	void
+	spsc_queue<T, Allocator>::push(value_type&& value)
+	{
+		while (!try_push(std::move(value)))
+			std::this_thread::yield();
+	}
+
+	template <class T, class Allocator>
+	inline bool
+	spsc_queue<T, Allocator>::try_push(const_reference value)
+	{ return (try_emplace(value)); }
+
+	template <class T, class Allocator>
+	inline bool
+	spsc_queue<T, Allocator>::try_push(value_type&& value)
+	{ return (try_emplace(std::move(value))); }
+
+	/**
+	 * 	@brief try emplace
+	 *
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return False if the queue is full (@p args are then untouched).
+	*/
+	template <class T, class Allocator>
+	template <typename... Args>
+	bool
+	spsc_queue<T, Allocator>::try_emplace(Args&&... args)
+	{
+		const size_type t = tail.load(std::memory_order_relaxed);
+
+		if (!sq_free_slots(t, 1))
+			return (false);
+		memory.construct(buff + (t & mask), std::forward<Args>(args)...);
+		tail.store(t + 1, std::memory_order_release);
+		return (true);
+	}
+
+	/**
+	 * 	@brief try push n
+	 *
+	 * 	@param src An array of @p n elements.
+	 * 	@param n The amount of elements.
+	 * 	@return The amount of elements pushed (the first ones of @p src).
+	 *
+	 * 	All the pushed elements are published with a single store.
+	*/
+	template <class T, class Allocator>
+	typename spsc_queue<T, Allocator>::size_type
+	spsc_queue<T, Allocator>::try_push_n(const_pointer src, size_type n)
+	{
+		const size_type t = tail.load(std::memory_order_relaxed);
+		const size_type free_slots = sq_free_slots(t, n);
+
+		if (n > free_slots)
+			n = free_slots;
+		for (size_type i = 0 ; i < n ; i++)
+			memory.construct(buff + ((t + i) & mask), src[i]);
+		tail.store(t + n, std::memory_order_release);
+		return (n);
+	}
+
+	//////////////
+	// Consumer //
+	//////////////
+
+	/**
+	 * 	@brief front
+	 *
+	 * 	@return The oldest element, the queue must not be empty.
+	*/
+	template <class T, class Allocator>
+	inline typename spsc_queue<T, Allocator>::reference
+	spsc_queue<T, Allocator>::front()
+	{ return (buff[head.load(std::memory_order_relaxed) & mask]); }
+
+	/**
+	 * 	@brief pop
+	 *
+	 * 	Removes the oldest element, the queue must not be empty.
+	*/
+	template <class T, class Allocator>
+	inline void
+	spsc_queue<T, Allocator>::pop()
+	{
+		const size_type h = head.load(std::memory_order_relaxed);
+
+		memory.destroy(buff + (h & mask));
+		head.store(h + 1, std::memory_order_release);
+	}
+
+	/**
+	 * 	@brief try pop
+	 *
+	 * 	@param value Receives the oldest element.
+	 * 	@return False if the queue is empty.
+	*/
+	template <class T, class Allocator>
+	bool
+	spsc_queue<T, Allocator>::try_pop(reference value)
+	{
+		const size_type h = head.load(std::memory_order_relaxed);
+
+		if (!sq_ready_slots(h, 1))
+			return (false);
+		value = std::move(buff[h & mask]);
+		memory.destroy(buff + (h & mask));
+		head.store(h + 1, std::memory_order_release);
+		return (true);
+	}
+
+	/**
+	 * 	@brief try pop n
+	 *
+	 * 	@param dst An array of at least @p n constructed elements.
+	 * 	@param n The maximum amount of elements.
+	 * 	@return The amount of elements moved to @p dst.
+	 *
+	 * 	All the slots are released with a single store.
+	*/
+	template <class T, class Allocator>
+	typename spsc_queue<T, Allocator>::size_type
+	spsc_queue<T, Allocator>::try_pop_n(pointer dst, size_type n)
+	{
+		const size_type h = head.load(std::memory_order_relaxed);
+		const size_type ready = sq_ready_slots(h, n);
+
+		if (n > ready)
+			n = ready;
+		for (size_type i = 0 ; i < n ; i++)
+		{
+			dst[i] = std::move(buff[(h + i) & mask]);
+			memory.destroy(buff + ((h + i) & mask));
+		}
+		head.store(h + n, std::memory_order_release);
+		return (n);
+	}
+};
@@ -24,12 +24,16 @@
 # include "ft_allocator.hpp"
 # include "algorithm.hpp"
 # include "ft_iterator.hpp"
+# include "ft_type_traits.hpp"
+# include "ft_growth_policy.hpp"
 
 # include <limits>
+# include <cstring>
+# include <string>
+# include <stdexcept>
 
 namespace FT_NAMESPACE
 {
-	# define NEW_CAP(x) x < std::size_t(8) ? std::size_t(8) : std::size_t(x * 2)
 	# define POSITIVE(x) x < std::ptrdiff_t(0) ? std::size_t(0) : std::size_t(x)
 
 	/////////////////////////////
@@ -69,7 +73,7 @@ namespace FT_NAMESPACE
 		normal_iterator();
 		explicit normal_iterator(const iterator_type& i);
 		template <typename Iter>
-		normal_iterator(const normal_iterator<Iter, typename enable_if<(are_same<Iter, typename container_type::pointer>::type), container_type>::type>& i);
+		normal_iterator(const normal_iterator<Iter, typename enable_if<(are_same<Iter, typename container_type::pointer>::value), container_type>::type>& i);
 
 		const iterator_type&		base() const;
 
@@ -113,7 +117,7 @@ namespace FT_NAMESPACE
 
 	template <typename Iterator, typename Container>
 	template <typename Iter>
-	normal_iterator<Iterator, Container>::normal_iterator(const normal_iterator<Iter, typename enable_if<(are_same<Iter, typename container_type::pointer>::type), container_type>::type>& i)
+	normal_iterator<Iterator, Container>::normal_iterator(const normal_iterator<Iter, typename enable_if<(are_same<Iter, typename container_type::pointer>::value), container_type>::type>& i)
 	: it(i.base())
 	{ }
 
@@ -436,8 +440,10 @@ namespace FT_NAMESPACE
 		/* Fast type basic operations */
 		void		alg_copy_data(const vector_algorithm& other) throw();
 		void		alg_swap_data(vector_algorithm& other) throw();
+		void		alg_move_data(vector_algorithm& other) throw();
 		pointer		alg_allocate(size_type n) throw(std::bad_alloc);
-		void		alg_deallocate(pointer p) throw();
+		void		alg_deallocate(pointer p, size_type n) throw();
+		pointer		alg_reallocate(pointer p, size_type old_n, size_type new_n) throw(std::bad_alloc);
 
 		protected:
 
@@ -458,8 +464,8 @@ namespace FT_NAMESPACE
 	{ }
 
 	template <class T, class Alloc>
-	vector_algorithm<T, Alloc>::vector_algorithm(const vector_algorithm&)
-	: head(), tail(), storage(), memory()
+	vector_algorithm<T, Alloc>::vector_algorithm(const vector_algorithm& other)
+	: head(), tail(), storage(), memory(other.memory)
 	{ }
 
 	template <class T, class Alloc>
@@ -498,7 +504,7 @@ namespace FT_NAMESPACE
 	*/
 	template <class T, class Alloc>
 	vector_algorithm<T, Alloc>::~vector_algorithm()
-	{ alg_deallocate(head); }
+	{ alg_deallocate(head, size_type(storage - head)); }
 
 	/**
 	 * 	@brief alg_copy_data
@@ -537,6 +543,25 @@ namespace FT_NAMESPACE
 		other.alg_copy_data(tmp);
 	}
 
+	/**
+	 * 	@brief alg_move_data
+	 * 
+	 * 	@param other A %vector_algorithm object.
+	 * 
+	 * 	Auxiliar function who steals @c head, @c tail and @c storage
+	 * 	from @p other, @p other is left empty.
+	*/
+	template <class T, class Alloc>
+	inline void
+	vector_algorithm<T, Alloc>::alg_move_data(vector_algorithm& other)
+	throw()
+	{
+		alg_copy_data(other);
+		other.head = pointer();
+		other.tail = pointer();
+		other.storage = pointer();
+	}
+
 	/**
 	 * 	@brief alg_allocate
 	 * 
@@ -564,9 +589,27 @@ namespace FT_NAMESPACE
 	*/
 	template <class T, class Alloc>
 	inline void
-	vector_algorithm<T, Alloc>::alg_deallocate(pointer p)
+	vector_algorithm<T, Alloc>::alg_deallocate(pointer p, size_type n)
 	throw()
-	{ memory.deallocate(p); }
+	{ memory.deallocate(p, n); }
+
+	/**
+	 * 	@brief alg_reallocate
+	 * 
+	 * 	@param p The current heap memory block.
+	 * 	@param old_n The size of @p p.
+	 * 	@param new_n The requested size.
+	 * 
+	 * 	@return A block holding the bytes of @p p.
+	 * 
+	 * 	A fast-use of the allocator reallocate extension.
+	 * 	NOTE: Only usable when allocator_can_reallocate<Alloc> is true.
+	*/
+	template <class T, class Alloc>
+	inline typename vector_algorithm<T, Alloc>::pointer
+	vector_algorithm<T, Alloc>::alg_reallocate(pointer p, size_type old_n, size_type new_n)
+	throw(::std::bad_alloc)
+	{ return (memory.reallocate(p, old_n, new_n)); }
 
 	/**
 	 * 	@brief alg_reserve
@@ -595,6 +638,7 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@tparam T the type of stored values.
 	 * 	@tparam Allocator an allocator class
+	 * 	@tparam Growth a growth policy (see: ft_growth_policy.hpp)
 	 * 
 	 * 	Classical array data-structure.
 	 * 	
@@ -602,7 +646,7 @@ namespace FT_NAMESPACE
 	 * 	inherits from its base class that hanldes the array.
 	 * 
 	*/
-	template <class T, class Allocator = allocator<T>>
+	template <class T, class Allocator = allocator<T>, class Growth = growth_double>
 	class vector : protected vector_algorithm<T, Allocator>
 	{
 		/* Member types */
@@ -620,8 +664,9 @@ namespace FT_NAMESPACE
 		typedef const value_type&						const_reference;
 		typedef normal_iterator<pointer, vector>		iterator;
 		typedef normal_iterator<const_pointer, vector>	const_iterator;
-		typedef reverse_iterator<const_iterator>		const_reverse_iterator;
-		typedef reverse_iterator<iterator>				reverse_iterator;
+		typedef FT_NAMESPACE::reverse_iterator<const_iterator>	const_reverse_iterator;
+		typedef FT_NAMESPACE::reverse_iterator<iterator>		reverse_iterator;
+		typedef Growth									growth_policy;
 		
 		/* Fast type base members */
 
@@ -631,19 +676,46 @@ namespace FT_NAMESPACE
 		using Base::tail;
 		using Base::storage;
 		using Base::memory;
-		using Base::alg_copy_data;
 		using Base::alg_swap_data;
+		using Base::alg_move_data;
 		using Base::alg_allocate;
 		using Base::alg_deallocate;
+		using Base::alg_reallocate;
+		using Base::alg_reserve;
+
+		/* Can grow with the allocator reallocate */
+		typedef typename conditional_type<allocator_can_reallocate<Allocator>::value
+		&& is_trivially_relocatable<T>::value, true_type, false_type>::type		Can_Reallocate;
 
 		/* Auxiliar functions */
 
 		private:
 
 		void		vec_cpy(const vector& other, size_type n) throw(std::bad_alloc);
-		void		vec_array_copy(pointer dest, const_pointer src, size_type n) throw();
-		void		vec_set(pointer dest, const_reference value, size_type n) throw(std::bad_alloc);
+		void		vec_array_copy(pointer dest, const_pointer src, size_type n) throw(std::bad_alloc);
+		void		vec_array_copy(pointer dest, const_pointer src, size_type n, true_type) throw();
+		void		vec_array_copy(pointer dest, const_pointer src, size_type n, false_type) throw(std::bad_alloc);
+		void		vec_array_move(pointer dest, pointer src, size_type n) throw(std::bad_alloc);
+		void		vec_array_move(pointer dest, pointer src, size_type n, true_type) throw();
+		void		vec_array_move(pointer dest, pointer src, size_type n, false_type) throw(std::bad_alloc);
+		void		vec_shift_right(size_type index, size_type amount) throw(std::bad_alloc);
+		void		vec_shift_right(size_type index, size_type amount, true_type) throw();
+		void		vec_shift_right(size_type index, size_type amount, false_type) throw(std::bad_alloc);
+		void		vec_shift_left(size_type index, size_type amount) throw();
+		void		vec_shift_left(size_type index, size_type amount, true_type) throw();
+		void		vec_shift_left(size_type index, size_type amount, false_type) throw();
+		size_type	vec_next_capacity(size_type n) const throw();
+		void		vec_relocate(size_type new_cap) throw(std::bad_alloc);
+		void		vec_relocate(size_type new_cap, true_type) throw(std::bad_alloc);
+		void		vec_relocate(size_type new_cap, false_type) throw(std::bad_alloc);
+		void		vec_grow(size_type n) throw(std::bad_alloc);
+		void		vec_append_amount(size_type amount, const_reference value) throw(std::bad_alloc);
+		void		vec_append_default(size_type amount) throw(std::bad_alloc);
+		void		vec_append_default(size_type amount, true_type) throw();
+		void		vec_append_default(size_type amount, false_type) throw(std::bad_alloc);
 		void		vec_clear() throw();
+		void		vec_clear(true_type) throw();
+		void		vec_clear(false_type) throw();
 		size_type	vec_get_iterator_index(iterator it) throw();
 		template <typename InputIt>
 		size_type	vec_get_size_range_constructor(InputIt& first, InputIt& last, void*) throw();
@@ -676,8 +748,11 @@ namespace FT_NAMESPACE
 		vector(InputIterator first, InputIterator last,
 		const allocator_type& alloc = allocator_type());
 		vector(const vector& other);
+		vector(vector&& other);
 		~vector();
 		vector&					operator=(const vector& other);
+		vector&					operator=(vector&& other);
+		allocator_type			get_allocator() const;
 		void					assign(size_type count, const_reference value);
 		template <typename InputIt>
 		void					assign(InputIt first, InputIt last);
@@ -715,13 +790,22 @@ namespace FT_NAMESPACE
 		void					clear();
 		void					insert(/*const_*/iterator pos, size_type amount, const_reference value);	
 		iterator				insert(const_iterator pos, const_reference value);
+		iterator				insert(const_iterator pos, value_type&& value);
+		template <typename... Args>
+		iterator				emplace(const_iterator pos, Args&&... args);
 		template <typename InputIt>
 		iterator				insert(/*const_*/iterator pos, InputIt first, InputIt last);
 		iterator				erase(iterator first, iterator last);
 		iterator				erase(iterator pos);
 		void					push_back(const_reference x);
+		void					push_back(value_type&& x);
+		template <typename... Args>
+		reference				emplace_back(Args&&... args);
 		void					pop_back();
 		void					resize(size_type new_cap, const_reference value = value_type());
+		void					resize_uninitialized(size_type n);
+		template <typename Generator>
+		void					append(size_type n, Generator gen);
 		void					swap(vector& other);
 	};
 
@@ -739,53 +823,365 @@ namespace FT_NAMESPACE
 	 * 	Copy @a n element from other to @c *this.
 	 * 	Note: @a n must be <= @c other.capacity() and @c this->capacity().
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::vec_cpy(const vector& other, size_type n)
+	vector<T, Allocator, Growth>::vec_cpy(const vector& other, size_type n)
 	throw(::std::bad_alloc)
-	{
-		for (size_type i = 0 ; i < n ; i++)
-			memory.construct(head + i, other.at(i));
-	}
+	{ vec_array_copy(head, other.head, n); }
 
 	/**
 	 * 	@brief Array copy
 	 * 
-	 * 	@param dest The destination array of elements of an arbitrary type.
+	 * 	@param dest The destination array, its storage is uninitialised.
 	 * 	@param src The source array.
 	 * 	@param n The amount of elements to be copied.
 	 * 
-	 * 	Copies @p n elements from @p src to @p dest.
+	 * 	Copy-constructs @p n elements from @p src to @p dest.
+	 * 	Note: @p dest and @p src must not overlap.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_array_copy(pointer dest, const_pointer src, size_type n)
+	throw(::std::bad_alloc)
+	{ vec_array_copy(dest, src, n, typename is_trivially_copyable<value_type>::type()); }
+
+	/**
+	 * 	@brief Array copy of trivially copyable elements, in one memcpy.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::vec_array_copy(pointer dest, const_pointer src, size_type n)
+	vector<T, Allocator, Growth>::vec_array_copy(pointer dest, const_pointer src, size_type n, true_type)
 	throw()
 	{
-		for (size_type i = 0 ; i < n ; i++)
-			dest[i] = src[i];
+		if (n)
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), n * sizeof(value_type));
+	}
+
+	/**
+	 * 	@brief Array copy of non trivially copyable elements, one by one.
+	 * 	NOTE: If a constructor throws, the elements already built are
+	 * 	destroyed before the exception is rethrown.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_array_copy(pointer dest, const_pointer src, size_type n, false_type)
+	throw(::std::bad_alloc)
+	{
+		size_type i = 0;
+
+		try
+		{
+			for ( ; i < n ; i++)
+				memory.construct(dest + i, src[i]);
+		}
+		catch (...)
+		{
+			while (i > 0)
+				memory.destroy(dest + --i);
+			throw ;
+		}
+	}
+
+	/**
+	 * 	@brief Array move
+	 * 
+	 * 	@param dest The destination array, its storage is uninitialised.
+	 * 	@param src The source array, its elements are left moved-from.
+	 * 	@param n The amount of elements to be moved.
+	 * 
+	 * 	Move-constructs @p n elements from @p src to @p dest.
+	 * 	Note: @p dest and @p src must not overlap.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_array_move(pointer dest, pointer src, size_type n)
+	throw(::std::bad_alloc)
+	{ vec_array_move(dest, src, n, typename is_trivially_copyable<value_type>::type()); }
+
+	/**
+	 * 	@brief Array move of trivially copyable elements, in one memcpy.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_array_move(pointer dest, pointer src, size_type n, true_type)
+	throw()
+	{ vec_array_copy(dest, src, n, true_type()); }
+
+	/**
+	 * 	@brief Array move of non trivially copyable elements, one by one.
+	 * 	NOTE: If a constructor throws, the elements already built are
+	 * 	destroyed before the exception is rethrown.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_array_move(pointer dest, pointer src, size_type n, false_type)
+	throw(::std::bad_alloc)
+	{
+		size_type i = 0;
+
+		try
+		{
+			for ( ; i < n ; i++)
+				memory.construct(dest + i, std::move(src[i]));
+		}
+		catch (...)
+		{
+			while (i > 0)
+				memory.destroy(dest + --i);
+			throw ;
+		}
+	}
+
+	/**
+	 * 	@brief Shift right
+	 * 
+	 * 	@param index The index of the first element to shift.
+	 * 	@param amount The shift distance.
+	 * 
+	 * 	Relocates the elements in range [@p index, size()) to
+	 * 	[@p index + @p amount, size() + @p amount). The range
+	 * 	[@p index, @p index + @p amount) is left uninitialised
+	 * 	and @c tail is unchanged.
+	 * 	Note: size() + @p amount must be <= capacity().
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_shift_right(size_type index, size_type amount)
+	throw(::std::bad_alloc)
+	{ vec_shift_right(index, amount, typename is_trivially_copyable<value_type>::type()); }
+
+	/**
+	 * 	@brief Shift right of trivially copyable elements, in one memmove.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_shift_right(size_type index, size_type amount, true_type)
+	throw()
+	{
+		if (index < size())
+			std::memmove(static_cast<void*>(head + index + amount), static_cast<const void*>(head + index),
+			(size() - index) * sizeof(value_type));
+	}
+
+	/**
+	 * 	@brief Shift right of non trivially copyable elements, starting
+	 * 	by the last one (move-construct then destroy).
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_shift_right(size_type index, size_type amount, false_type)
+	throw(::std::bad_alloc)
+	{
+		for (size_type i = size() ; i-- > index ; )
+		{
+			memory.construct(head + i + amount, std::move(head[i]));
+			memory.destroy(head + i);
+		}
+	}
+
+	/**
+	 * 	@brief Shift left
+	 * 
+	 * 	@param index The index of the first erased element.
+	 * 	@param amount The shift distance.
+	 * 
+	 * 	Moves the elements in range [@p index + @p amount, size()) to
+	 * 	[@p index, size() - @p amount), destroys the @p amount last
+	 * 	elements and updates @c tail.
+	 * 	Note: @p index + @p amount must be <= size().
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_shift_left(size_type index, size_type amount)
+	throw()
+	{ vec_shift_left(index, amount, typename is_trivially_copyable<value_type>::type()); }
+
+	/**
+	 * 	@brief Shift left of trivially copyable elements, in one memmove.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_shift_left(size_type index, size_type amount, true_type)
+	throw()
+	{
+		if (amount && index + amount < size())
+			std::memmove(static_cast<void*>(head + index), static_cast<const void*>(head + index + amount),
+			(size() - index - amount) * sizeof(value_type));
+		tail -= amount;
+	}
+
+	/**
+	 * 	@brief Shift left of non trivially copyable elements, by move assignation.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_shift_left(size_type index, size_type amount, false_type)
+	throw()
+	{
+		if (amount == 0)
+			return ;
+		for (size_type i = index + amount ; i < size() ; i++)
+			head[i - amount] = std::move(head[i]);
+		for (size_type i = 0 ; i < amount ; i++)
+			memory.destroy(--tail);
+	}
+
+	/**
+	 * 	@brief Next capacity
+	 * 
+	 * 	@param n The amount of elements that must fit.
+	 * 	@return The capacity chosen by the growth policy, clamped to
+	 * 	max_size() when @p n still fits.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::size_type
+	vector<T, Allocator, Growth>::vec_next_capacity(size_type n) const
+	throw()
+	{
+		const size_type next = size_type(Growth::next_capacity(n, sizeof(value_type)));
+
+		return (next > max_size() && n <= max_size() ? max_size() : next);
+	}
+
+	/**
+	 * 	@brief Relocate
+	 * 
+	 * 	@param new_cap The new capacity, must be >= size().
+	 * 
+	 * 	Moves the elements into a block of @p new_cap elements. The allocator
+	 * 	reallocate extension is used when the elements are trivially relocatable
+	 * 	(the block may then grow in place, nothing is copied by %vector).
+	 * 
+	 * 	@throw std::bad_alloc.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_relocate(size_type new_cap)
+	throw(::std::bad_alloc)
+	{ vec_relocate(new_cap, Can_Reallocate()); }
+
+	/**
+	 * 	@brief Relocate using the allocator reallocate.
+	 * 	NOTE: If it throws @c *this is untouched.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_relocate(size_type new_cap, true_type)
+	throw(::std::bad_alloc)
+	{
+		const size_type s = size();
+
+		head = alg_reallocate(head, capacity(), new_cap);
+		tail = pointer(head + s);
+		storage = pointer(head + new_cap);
+	}
+
+	/**
+	 * 	@brief Relocate by allocate, move then deallocate.
+	 * 	NOTE: If it throws @c *this keeps its block, the elements moved
+	 * 	into the new one are destroyed and it is deallocated.
+	*/
+	template <class T, class Allocator, class Growth>
+	void
+	vector<T, Allocator, Growth>::vec_relocate(size_type new_cap, false_type)
+	throw(::std::bad_alloc)
+	{
+		const pointer	tmp = alg_allocate(new_cap);
+		const size_type	s = size();
+
+		try
+		{ vec_array_move(tmp, head, s); }
+		catch (...)
+		{
+			alg_deallocate(tmp, new_cap);
+			throw ;
+		}
+		vec_clear();
+		alg_deallocate(head, capacity());
+		head = tmp;
+		tail = pointer(head + s);
+		storage = pointer(head + new_cap);
+	}
+
+	/**
+	 * 	@brief Grow
+	 * 
+	 * 	@param n The amount of elements that must fit.
+	 * 
+	 * 	Reserves at least @p n elements, following the growth policy
+	 * 	so a serie of small growths stays amortised.
+	 * 
+	 * 	@throw std::bad_alloc.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_grow(size_type n)
+	throw(::std::bad_alloc)
+	{
+		if (n > capacity())
+		{
+			const size_type next = vec_next_capacity(size_type(size() + 1));
+			reserve(n > next ? n : next);
+		}
 	}
 
 	/**
-	 * 	@brief Vector set
+	 * 	@brief Append amount
 	 * 
-	 * 	@param dest A pointer.
+	 * 	@param amount The amount of copies.
 	 * 	@param value A value_type.
-	 * 	@param n The amount of set steps.
 	 * 
-	 * 	Set @a n elements of @a value into @a dest.
-	 * 	Note: The elements in @a dest that will be overwriten are destroyed.
-	 * 	Note: @a dest + @a n must be <= @c this->capacity().
-	 */
-	template <class T, class Allocator>
+	 * 	Constructs @p amount copies of @p value at @c tail.
+	 * 	Note: size() + @p amount must be <= capacity().
+	*/
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::vec_set(pointer dest, const_reference value, size_type n)
+	vector<T, Allocator, Growth>::vec_append_amount(size_type amount, const_reference value)
 	throw(::std::bad_alloc)
 	{
-		for (size_type i = 0 ; i < n ; i++)
+		for (size_type i = 0 ; i < amount ; i++)
 		{
-			memory.destroy(dest + i);
-			memory.construct(dest + i, value);
+			memory.construct(tail, value);
+			tail++;
+		}
+	}
+
+	/**
+	 * 	@brief Append default
+	 * 
+	 * 	@param amount The amount of elements.
+	 * 
+	 * 	Default-initialises @p amount elements at @c tail.
+	 * 	Note: size() + @p amount must be <= capacity().
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_append_default(size_type amount)
+	throw(::std::bad_alloc)
+	{ vec_append_default(amount, typename is_trivially_default_constructible<value_type>::type()); }
+
+	/**
+	 * 	@brief Append default of trivially default constructible elements,
+	 * 	the storage is taken as it is, nothing is written.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_append_default(size_type amount, true_type)
+	throw()
+	{ tail = pointer(tail + amount); }
+
+	/**
+	 * 	@brief Append default of non trivially default constructible elements.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_append_default(size_type amount, false_type)
+	throw(::std::bad_alloc)
+	{
+		for (size_type i = 0 ; i < amount ; i++)
+		{
+			memory.construct(tail);
+			tail++;
 		}
 	}
 
@@ -794,35 +1190,54 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Destructs the elements of @c *this without deallocating @c head.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_clear()
+	throw()
+	{ vec_clear(typename is_trivially_destructible<value_type>::type()); }
+
+	/**
+	 * 	@brief Vector clear of trivially destructible elements,
+	 * 	there's nothing to destroy.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::vec_clear(true_type)
+	throw()
+	{ tail = head; }
+
+	/**
+	 * 	@brief Vector clear of non trivially destructible elements.
+	*/
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::vec_clear()
+	vector<T, Allocator, Growth>::vec_clear(false_type)
 	throw()
 	{
 		while (tail != head)
-			memory.destroy(tail--);
+			memory.destroy(--tail);
 	}
 
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::size_type
-	vector<T, Allocator>::vec_get_iterator_index(iterator it)
+	/**
+	 * 	@brief Get iterator index
+	 * 
+	 * 	@param it An iterator of @c *this.
+	 * 	@return The index of @p it, in O(1).
+	*/
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::size_type
+	vector<T, Allocator, Growth>::vec_get_iterator_index(iterator it)
 	throw()
-	{
-		size_type index = 0;
-
-		for (iterator i = begin() ; i != it ; i++)
-			index++;
-		return (index);
-	}
+	{ return (size_type(it.base() - head)); }
 
 	/**
 	 * 	@brief init the base size constructor when the range constructor
 	 * 	is called.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
-	inline typename vector<T, Allocator>::size_type
-	vector<T, Allocator>::vec_get_size_range_constructor(InputIt& first, InputIt& last, void*)
+	inline typename vector<T, Allocator, Growth>::size_type
+	vector<T, Allocator, Growth>::vec_get_size_range_constructor(InputIt& first, InputIt& last, void*)
 	throw()
 	{ return (size_type(last - first)); }
 
@@ -831,19 +1246,19 @@ namespace FT_NAMESPACE
 	 * 	is miss called. (The user attemps to call size constructor with a
 	 * 	integer type != std::site_t) 
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
-	inline typename vector<T, Allocator>::size_type
-	vector<T, Allocator>::vec_get_size_range_constructor(InputIt n, InputIt&, int)
+	inline typename vector<T, Allocator, Growth>::size_type
+	vector<T, Allocator, Growth>::vec_get_size_range_constructor(InputIt n, InputIt&, int)
 	throw()
 	{ return (size_type(n)); }
 
 	/**
 	 * 	@brief size constructor vector construction routine
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::vec_init_vector_size(size_type n, value_type value)
+	vector<T, Allocator, Growth>::vec_init_vector_size(size_type n, value_type value)
 	throw(::std::bad_alloc)
 	{
 		for (size_type i = 0 ; i < n ; i++)
@@ -853,10 +1268,10 @@ namespace FT_NAMESPACE
 	/**
 	 * 	@brief range constructor vector construction routine
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
 	inline void
-	vector<T, Allocator>::vec_init_vector_range(InputIt& first, InputIt& last, void*)
+	vector<T, Allocator, Growth>::vec_init_vector_range(InputIt& first, InputIt& last, void*)
 	throw(::std::bad_alloc)
 	{ assign(first, last); }
 
@@ -864,35 +1279,37 @@ namespace FT_NAMESPACE
 	 * 	@brief used when range constructor is misscalled by the templates,
 	 * 	call size construction routine.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
 	inline void
-	vector<T, Allocator>::vec_init_vector_range(InputIt n, InputIt& value, int)
+	vector<T, Allocator, Growth>::vec_init_vector_range(InputIt n, InputIt& value, int)
 	throw(::std::bad_alloc)
 	{ vec_init_vector_range(static_cast<size_type>(n), value); }
 
 	/**
 	 * 	@brief assign amount
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	void
-	vector<T, Allocator>::vec_assign_amount(size_type count, const_reference value)
+	vector<T, Allocator, Growth>::vec_assign_amount(size_type count, const_reference value)
 	throw(::std::bad_alloc)
 	{
+		/* @p value may be an element of *this */
+		const value_type tmp(value);
+
+		vec_clear();
 		if (count > capacity())
-			resize(count, value);
-		else
-			vec_set(head, value, count);
-		tail = pointer(head + count);
+			reserve(count);
+		vec_append_amount(count, tmp);
 	}
 
 	/**
 	 * 	@brief assign range
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
 	void
-	vector<T, Allocator>::vec_assign_range(InputIt& first, InputIt& last, void*)
+	vector<T, Allocator, Growth>::vec_assign_range(InputIt& first, InputIt& last, void*)
 	throw(::std::bad_alloc)
 	{
 		vec_clear();
@@ -908,42 +1325,47 @@ namespace FT_NAMESPACE
 	 * 	@brief used when templates misscall vec_assign_range willing to
 	 * 	call assign amount
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
 	inline void
-	vector<T, Allocator>::vec_assign_range(InputIt amount, InputIt& value, int)
+	vector<T, Allocator, Growth>::vec_assign_range(InputIt amount, InputIt& value, int)
 	throw(::std::bad_alloc)
 	{ vec_assign_amount(static_cast<size_type>(amount), static_cast<const_reference>(value)); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	void
-	vector<T, Allocator>::vec_insert_amount(/*const_*/iterator pos, size_type amount, const_reference value)
+	vector<T, Allocator, Growth>::vec_insert_amount(/*const_*/iterator pos, size_type amount, const_reference value)
 	throw(::std::bad_alloc)
 	{
+		if (amount == 0)
+			return ;
+
 		/* Find the iterator index (can't work dirrectly with iterators cause
 		realloc make lose iterators indexes). */
 		size_type index = vec_get_iterator_index(pos);
 
+		/* @p value may be an element of *this */
+		const value_type tmp(value);
+
 		/* Handle space (if realloc is needed, pos is lost) */
 		if (size_type(size() + amount) > capacity())
-			reserve(size_type(NEW_CAP(size() + amount)));
+			reserve(vec_next_capacity(size() + amount));
 
 		/* Use the index to shift all the elements by amount
 		in range (*this)[index] - (*this)[tail] (starting at tail) */
-		for (size_type i = POSITIVE(difference_type(size() - 1)) ; i > index ; i--)
-			(*this)[i + amount] = (*this)[i];
+		vec_shift_right(index, amount);
 
 		/* Insert amount copies of value */
-		while (index < amount)
-			memory.construct(&(*this)[index++], value);
+		for (size_type i = 0 ; i < amount ; i++)
+			memory.construct(head + index + i, tmp);
 
 		tail = pointer(tail + amount);
 	}
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
 	void
-	vector<T, Allocator>::vec_insert_range(/*const_*/iterator pos, InputIt& first, InputIt& last, void*)
+	vector<T, Allocator, Growth>::vec_insert_range(/*const_*/iterator pos, InputIt& first, InputIt& last, void*)
 	throw(::std::bad_alloc)
 	{
 		// TO DO: if first is a member of *this and reserve is called ... THIS WONT WORK !
@@ -955,24 +1377,23 @@ namespace FT_NAMESPACE
 		/* Handle space (if realloc is needed, pos is lost) */
 		const size_type amount = distance(first, last);
 		if (size_type(size() + amount) > capacity())
-			reserve(size_type(NEW_CAP(size() + amount)));
+			reserve(vec_next_capacity(size() + amount));
 
 		/* Use the index to shift all the elements by amount
 		in range (*this)[index] - (*this)[tail] (starting at tail) */
-		for (size_type i = POSITIVE(difference_type(size() - 1)) ; i > index ; i--)
-			(*this)[i + amount] = (*this)[i];
+		vec_shift_right(index, amount);
 
-		/* Insert amount copies of value */
-		while (index < amount)
-			memory.construct(&(*this)[index++], *(first++));
+		/* Insert the elements in range first - last */
+		for (size_type i = 0 ; i < amount ; i++)
+			memory.construct(head + index + i, *(first++));
 
 		tail = pointer(tail + amount);
 	}
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
 	inline void
-	vector<T, Allocator>::vec_insert_range(/*const_*/iterator pos, InputIt amount, InputIt& value, int)
+	vector<T, Allocator, Growth>::vec_insert_range(/*const_*/iterator pos, InputIt amount, InputIt& value, int)
 	throw(::std::bad_alloc)
 	{ vec_insert_amount(pos, static_cast<size_type>(amount), static_cast<const_reference>(value)); }
 
@@ -985,8 +1406,8 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@param alloc An allocator type;
 	*/ 
-	template <class T, class Allocator>
-	vector<T, Allocator>::vector(const allocator_type& alloc)
+	template <class T, class Allocator, class Growth>
+	vector<T, Allocator, Growth>::vector(const allocator_type& alloc)
 	: Base(alloc)
 	{ }
 
@@ -999,8 +1420,8 @@ namespace FT_NAMESPACE
 	 *
 	 * Creates a %vector with @p n copies of @p value.
 	*/
-	template <class T, class Allocator>
-	vector<T, Allocator>::vector(size_type n, const_reference value, const allocator_type& alloc)
+	template <class T, class Allocator, class Growth>
+	vector<T, Allocator, Growth>::vector(size_type n, const_reference value, const allocator_type& alloc)
 	: Base(n, alloc)
 	{ vec_init_vector_size(n, value); }
 
@@ -1008,12 +1429,27 @@ namespace FT_NAMESPACE
 	 * 	@brief Copy constructor
 	 * 
 	 * 	@param other A vector
+	 * 
+	 * 	The allocator of @p other is copied, so the new array comes from
+	 * 	the same resource (arena, stats ...).
 	*/
-	template <class T, class Allocator>
-	vector<T, Allocator>::vector(const vector& other)
-	: Base(other.size()) // Assuming that others allocators haven't to be handled
+	template <class T, class Allocator, class Growth>
+	vector<T, Allocator, Growth>::vector(const vector& other)
+	: Base(other.size(), other.memory)
 	{ vec_cpy(other, other.size()); }
 
+	/**
+	 * 	@brief Move constructor
+	 * 
+	 * 	@param other A vector, left empty.
+	 * 
+	 * 	Steals the array of @p other, no element is copied.
+	*/
+	template <class T, class Allocator, class Growth>
+	vector<T, Allocator, Growth>::vector(vector&& other)
+	: Base(other.memory)
+	{ alg_move_data(other); }
+
 	/**
 	 * 	@brief Range Iterator Constructor
 	 * 
@@ -1024,9 +1460,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Creates a vector consisting on copies of element in range first-last.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIterator>
-	vector<T, Allocator>::vector(InputIterator first, InputIterator last, const allocator_type& alloc)
+	vector<T, Allocator, Growth>::vector(InputIterator first, InputIterator last, const allocator_type& alloc)
 	: Base(vec_get_size_range_constructor(first, last, typename is_integral<InputIterator>::type()), alloc)
 	{ vec_init_vector_range(first, last, typename is_integral<InputIterator>::type()); }
 
@@ -1037,8 +1473,8 @@ namespace FT_NAMESPACE
 	 * 	function. The allocated array is handled by the base destructor.
 	 *
 	*/
-	template <class T, class Allocator>
-	vector<T, Allocator>::~vector()
+	template <class T, class Allocator, class Growth>
+	vector<T, Allocator, Growth>::~vector()
 	{ vec_clear(); }
 
 	/**
@@ -1046,20 +1482,58 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@param other a vector.
 	 * 
-	 * 	Copies all the elements in vector to @c *this. 
+	 * 	Copies all the elements in vector to @c *this. The array is
+	 * 	only reallocated if it can't hold the elements of @p other.
 	*/
-	template <class T, class Allocator>
-	vector<T, Allocator>&
-	vector<T, Allocator>::operator=(const vector& other)
+	template <class T, class Allocator, class Growth>
+	vector<T, Allocator, Growth>&
+	vector<T, Allocator, Growth>::operator=(const vector& other)
 	{
-		vec_clear();
-		// TO DO: What happends if head is not allocated ?
-		alg_deallocate(head, storage);
-		alg_reserve(other.capacity());
-		vec_copy(other, other.size());
-		alg_copy_data(other);
+		if (this != &other)
+		{
+			vec_clear();
+			if (other.size() > capacity())
+			{
+				alg_deallocate(head, capacity());
+				alg_reserve(other.size());
+			}
+			vec_cpy(other, other.size());
+			tail = head + other.size();
+		}
+		return (*this);
+	}
+
+	/**
+	 * 	@brief operator=
+	 * 
+	 * 	@param other a vector, left empty.
+	 * 
+	 * 	Destroys the elements of @c *this and steals the array of @p other.
+	*/
+	template <class T, class Allocator, class Growth>
+	vector<T, Allocator, Growth>&
+	vector<T, Allocator, Growth>::operator=(vector&& other)
+	{
+		if (this != &other)
+		{
+			vec_clear();
+			alg_deallocate(head, capacity());
+			memory = other.memory;
+			alg_move_data(other);
+		}
+		return (*this);
 	}
 
+	/**
+	 * 	@brief get allocator
+	 * 
+	 * 	@return A copy of the allocator used by the %vector.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::allocator_type
+	vector<T, Allocator, Growth>::get_allocator() const
+	{ return (memory); }
+
 	/**
 	 *	@brief assign
 	 *
@@ -1069,9 +1543,9 @@ namespace FT_NAMESPACE
 	 *
 	 * 	Set @a value to @c *this in a range of @c value.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::assign(size_type count, const_reference value)
+	vector<T, Allocator, Growth>::assign(size_type count, const_reference value)
 	{ vec_assign_amount(count, value); }
 
 	/**
@@ -1083,10 +1557,10 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Copies whatever is between @a first and @a last to @c *this.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
 	inline void
-	vector<T, Allocator>::assign(InputIt first, InputIt last)
+	vector<T, Allocator, Growth>::assign(InputIt first, InputIt last)
 	{ vec_assign_range(first, last, typename is_integral<InputIt>::type()); }
 
 	////////////////////
@@ -1099,9 +1573,9 @@ namespace FT_NAMESPACE
 	 * 	@param n The index of the element that will be returned.
 	 *	@return A reference to the data at @a n index.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::reference
-	vector<T, Allocator>::operator[](size_type n)
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::reference
+	vector<T, Allocator, Growth>::operator[](size_type n)
 	{ return (*(head + n)); }
 
 	/**
@@ -1110,9 +1584,9 @@ namespace FT_NAMESPACE
 	 * 	@param n The index of the element that will be returned.
 	 *	@return A const reference to the data at @a n index.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_reference
-	vector<T, Allocator>::operator[](size_type n) const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_reference
+	vector<T, Allocator, Growth>::operator[](size_type n) const
 	{ return (*(head + n)); }
 
 	/**
@@ -1123,9 +1597,9 @@ namespace FT_NAMESPACE
 	 *
 	 * 	@throw std::out_of_range if @c n > @c this->size().
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::reference
-	vector<T, Allocator>::at(size_type n)
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::reference
+	vector<T, Allocator, Growth>::at(size_type n)
 	{
 		// TO DO: out of range
 		if (n > size())
@@ -1141,9 +1615,9 @@ namespace FT_NAMESPACE
 	 *
 	 * 	@throw std::out_of_range if @c n > @c this->size().
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_reference
-	vector<T, Allocator>::at(size_type n) const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_reference
+	vector<T, Allocator, Growth>::at(size_type n) const
 	{
 		// TO DO: out of range
 		if (n > size())
@@ -1156,9 +1630,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A reference to the first element in %vector.
 	 */
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::reference
-	vector<T, Allocator>::front()
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::reference
+	vector<T, Allocator, Growth>::front()
 	{ return (*begin()); }
 
 	/**
@@ -1166,9 +1640,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A const reference to the first element in %vector.
 	 */
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_reference
-	vector<T, Allocator>::front() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_reference
+	vector<T, Allocator, Growth>::front() const
 	{ return (*begin()); }
 
 	/**
@@ -1176,9 +1650,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A reference to the first element in %vector.
 	 */
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::reference
-	vector<T, Allocator>::back()
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::reference
+	vector<T, Allocator, Growth>::back()
 	{ return (*--end()); }
 
 	/**
@@ -1186,9 +1660,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A const reference to the first element in %vector.
 	 */
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_reference
-	vector<T, Allocator>::back() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_reference
+	vector<T, Allocator, Growth>::back() const
 	{ return (*--end()); }
 
 	/**
@@ -1196,9 +1670,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return a pointer such @c this->data() + @c this->size() is a valid range.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::pointer
-	vector<T, Allocator>::data()
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::pointer
+	vector<T, Allocator, Growth>::data()
 	{
 		// TO DO: Check what happens if %vector is empty
 		return (&front());
@@ -1209,9 +1683,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return a const pointer such @c this->data() + @c this->size() is a valid range.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_pointer
-	vector<T, Allocator>::data() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_pointer
+	vector<T, Allocator, Growth>::data() const
 	{
 		// TO DO: Check what happens if %vector is empty
 		return (&front());
@@ -1226,9 +1700,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Return an iterator to the first element in %vector.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::iterator
-	vector<T, Allocator>::begin()
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::iterator
+	vector<T, Allocator, Growth>::begin()
 	{ return (iterator(head)); }
 
 	/**
@@ -1236,9 +1710,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Return a const iterator to the first element in %vector.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_iterator
-	vector<T, Allocator>::begin() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_iterator
+	vector<T, Allocator, Growth>::begin() const
 	{ return (const_iterator(head)); }
 
 	/**
@@ -1246,9 +1720,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Return an iterator to the last element in %vector.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::iterator
-	vector<T, Allocator>::end()
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::iterator
+	vector<T, Allocator, Growth>::end()
 	{ return (iterator(tail)); }
 
 	/**
@@ -1256,9 +1730,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Return a const iterator to the last element in %vector.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_iterator
-	vector<T, Allocator>::end() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_iterator
+	vector<T, Allocator, Growth>::end() const
 	{ return (const_iterator(tail)); }
 
 	/**
@@ -1266,9 +1740,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Return a reverse iterator to the first element in %vector.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::reverse_iterator
-	vector<T, Allocator>::rbegin()
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::reverse_iterator
+	vector<T, Allocator, Growth>::rbegin()
 	{ return (reverse_iterator(head)); }
 
 	/**
@@ -1276,9 +1750,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Return a const reverse iterator to the first element in %vector.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_reverse_iterator
-	vector<T, Allocator>::rbegin() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_reverse_iterator
+	vector<T, Allocator, Growth>::rbegin() const
 	{ return (const_reverse_iterator(head)); }
 
 	/**
@@ -1286,9 +1760,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Return a reverse iterator to the last element in %vector.
 	*/
-	template <class T, class Allocator>
-	typename vector<T, Allocator>::reverse_iterator
-	vector<T, Allocator>::rend()
+	template <class T, class Allocator, class Growth>
+	typename vector<T, Allocator, Growth>::reverse_iterator
+	vector<T, Allocator, Growth>::rend()
 	{ return (reverse_iterator(tail)); }
 
 	/**
@@ -1296,9 +1770,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Return a const reverse iterator to the last element into %vector.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::const_reverse_iterator
-	vector<T, Allocator>::rend() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::const_reverse_iterator
+	vector<T, Allocator, Growth>::rend() const
 	{ return (const_reverse_iterator(tail)); }
 
 	//////////////
@@ -1310,9 +1784,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return True if the vector is empty.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline bool
-	vector<T, Allocator>::empty() const
+	vector<T, Allocator, Growth>::empty() const
 	{ return (begin() == end()); }
 
 		/**
@@ -1320,9 +1794,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return The number of elements in %vector.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::size_type
-	vector<T, Allocator>::size() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::size_type
+	vector<T, Allocator, Growth>::size() const
 	{ return (size_type(tail - head)); }
 
 	/**
@@ -1330,38 +1804,24 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return The largest amount of T elements that %vector supports.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::size_type
-	vector<T, Allocator>::max_size() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::size_type
+	vector<T, Allocator, Growth>::max_size() const
 	{ return (min(size_type(std::numeric_limits<difference_type>::max() / sizeof(value_type)), memory.max_size())); }
 
 	/**
 	 * 	@brief reserve
+	 * 
+	 * 	@throw std::length_error if @p new_cap is greather than max_size().
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	void
-	vector<T, Allocator>::reserve(size_type new_cap)
+	vector<T, Allocator, Growth>::reserve(size_type new_cap)
 	{
+		if (new_cap > max_size())
+			throw std::length_error(std::string("vector::reserve"));
 		if (new_cap > capacity())
-		{
-			pointer tmp;
-			try {
-				tmp = alg_allocate(new_cap);
-			}
-			catch (std::bad_alloc& e) {
-				clear();
-				alg_deallocate(head);
-				std::cerr << e.what() << std::endl;
-				throw;
-			}
-			const size_type s = size();
-			vec_array_copy(tmp, head, s);
-			vec_clear();
-			alg_deallocate(head);
-			head = tmp;
-			tail = pointer(head + s);
-			storage = pointer(head + new_cap);
-		}
+			vec_relocate(new_cap);
 	}
 
 	/**
@@ -1369,9 +1829,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return The maximun number of element that %vector can hold.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::size_type
-	vector<T, Allocator>::capacity() const
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::size_type
+	vector<T, Allocator, Growth>::capacity() const
 	{ return (size_type(storage - head)); }
 
 	///////////////
@@ -1383,9 +1843,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Destroys all the elements that %vector hold.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::clear()
+	vector<T, Allocator, Growth>::clear()
 	{ vec_clear(); }
 
 	/**
@@ -1395,9 +1855,9 @@ namespace FT_NAMESPACE
 	 * 	@param amount The total copies of @a value that will be inserted at @a index.
 	 * 	@param value A copy of it will be inserted @a amount times.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::insert(/*const_*/iterator pos, size_type amount, const_reference value)
+	vector<T, Allocator, Growth>::insert(/*const_*/iterator pos, size_type amount, const_reference value)
 	{ vec_insert_amount(pos, amount, value); }
 
 	/**
@@ -1409,12 +1869,53 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Insert @c value at @c index (before the current element that is holds at @c index before the call)
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::iterator
-	vector<T, Allocator>::insert(const_iterator pos, const_reference value)
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::iterator
+	vector<T, Allocator, Growth>::insert(const_iterator pos, const_reference value)
+	{ return (emplace(pos, value)); }
+
+	/**
+	 * 	@brief insert
+	 * 
+	 * 	@param pos A const interator into %vector.
+	 * 	@param value The moved value.
+	 * 	@return An iterator to the inserted data.
+	*/
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::iterator
+	vector<T, Allocator, Growth>::insert(const_iterator pos, value_type&& value)
+	{ return (emplace(pos, std::move(value))); }
+
+	/**
+	 * 	@brief emplace
+	 * 
+	 * 	@param pos A const interator into %vector.
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return An iterator to the emplaced data.
+	 * 
+	 * 	Constructs an element in place before @p pos. When @p pos is not
+	 * 	the end, the element is built first (@p args may refer to an element
+	 * 	of @c *this) then moved into the hole.
+	*/
+	template <class T, class Allocator, class Growth>
+	template <typename... Args>
+	typename vector<T, Allocator, Growth>::iterator
+	vector<T, Allocator, Growth>::emplace(const_iterator pos, Args&&... args)
 	{
-		insert(pos, size_type(1), value);
-		return (iterator(pos));
+		const size_type index = size_type(pos.base() - head);
+
+		if (index == size())
+		{
+			emplace_back(std::forward<Args>(args)...);
+			return (iterator(head + index));
+		}
+		value_type tmp(std::forward<Args>(args)...);
+		if (tail == storage)
+			reserve(vec_next_capacity(size() + 1));
+		vec_shift_right(index, 1);
+		memory.construct(head + index, std::move(tmp));
+		tail++;
+		return (iterator(head + index));
 	}
 
 	/**
@@ -1428,10 +1929,10 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Insert the values in range @a first - @a last at the index @a pos.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	template <typename InputIt>
-	inline typename vector<T, Allocator>::iterator
-	vector<T, Allocator>::insert(/*const_*/iterator pos, InputIt first, InputIt last)
+	inline typename vector<T, Allocator, Growth>::iterator
+	vector<T, Allocator, Growth>::insert(/*const_*/iterator pos, InputIt first, InputIt last)
 	{
 		vec_insert_range(pos, first, last, typename is_integral<InputIt>::type());
 		return (iterator(pos));
@@ -1444,25 +1945,16 @@ namespace FT_NAMESPACE
 	 * 	@param last An iterator that is the last iterator in erase range.
 	 * 	@return An iterator pointing to the iserted data.
 	*/
-	template <class T, class Allocator>
-	typename vector<T, Allocator>::iterator
-	vector<T, Allocator>::erase(iterator first, iterator last)
+	template <class T, class Allocator, class Growth>
+	typename vector<T, Allocator, Growth>::iterator
+	vector<T, Allocator, Growth>::erase(iterator first, iterator last)
 	{
 		// Calc the indexes
-		const size_type amount = distance(first, last);
-		const size_type pos = distance(begin(), first);
-		iterator deletion_index = iterator(&(*this)[pos + amount]);
-		// Proceed to shift backwards by amount and destroy while overwriting the old element
-		for (size_type i = 0 ; i < amount ; i++)
-		{
-			memory.destroy(&(*this)[pos + i]);
-			(*this)[pos + i] = (*this)[pos + i + amount];
-		}
-		// Shift backwards without destroying the remaining elements
-		for (size_type i = pos + amount ; i < size() ; i++)
-			(*this)[i] = (*this)[i + amount];
-		tail -= amount;
-		return (first);
+		const size_type pos = vec_get_iterator_index(first);
+		const size_type amount = size_type(last.base() - first.base());
+		// Shift backwards by amount and destroy the remaining elements at the end
+		vec_shift_left(pos, amount);
+		return (iterator(head + pos));
 	}
 
 	/**
@@ -1473,9 +1965,9 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Remove an element at the index @a pos.
 	*/
-	template <class T, class Allocator>
-	inline typename vector<T, Allocator>::iterator
-	vector<T, Allocator>::erase(iterator pos)
+	template <class T, class Allocator, class Growth>
+	inline typename vector<T, Allocator, Growth>::iterator
+	vector<T, Allocator, Growth>::erase(iterator pos)
 	{ return (erase(pos, pos + 1)); }
 
 
@@ -1486,13 +1978,45 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Append @c x to underliying work array @c head at index @c tail + 1.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
+	inline void
+	vector<T, Allocator, Growth>::push_back(const_reference x)
+	{ emplace_back(x); }
+
+	/**
+	 * 	@brief push back
+	 * 
+	 * 	@param x The data to be appended, it is moved.
+	*/
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::push_back(const_reference x)
+	vector<T, Allocator, Growth>::push_back(value_type&& x)
+	{ emplace_back(std::move(x)); }
+
+	/**
+	 * 	@brief emplace back
+	 * 
+	 * 	@param args The arguments forwarded to the value_type constructor.
+	 * 	@return A reference to the appended element.
+	 * 
+	 * 	Constructs an element in place at @c tail, the array grows
+	 * 	when it is full.
+	*/
+	template <class T, class Allocator, class Growth>
+	template <typename... Args>
+	inline typename vector<T, Allocator, Growth>::reference
+	vector<T, Allocator, Growth>::emplace_back(Args&&... args)
 	{
-		if (size_type(++tail) > capacity())
-			resize(size_type(capacity() * 2));
-		memory.construct(tail, x);
+		if (tail == storage)
+		{
+			// @p args may refer to an element of @c *this, build it before the reallocation
+			value_type tmp(std::forward<Args>(args)...);
+			reserve(vec_next_capacity(size() + 1));
+			memory.construct(tail, std::move(tmp));
+		}
+		else
+			memory.construct(tail, std::forward<Args>(args)...);
+		return (*tail++);
 	}
 
 	/**
@@ -1500,42 +2024,84 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	Removes the last element of the underliying work array @c head at index @c tail.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::pop_back()
+	vector<T, Allocator, Growth>::pop_back()
 	{
 		if (!empty())
-			memory.destroy(tail--);
+			memory.destroy(--tail);
 	}
 
 	/**
 	 * 	@brief resize
 	 * 
-	 * 	Change the capacity of %vector.
-	 * 	Note: the elements between @c tail and @c storage are uninitialised.
+	 * 	@param new_cap The new size.
+	 * 	@param value The value of the appended elements.
+	 * 
+	 * 	Change the size of %vector, the elements beyond @p new_cap are destroyed
+	 * 	and the missing ones are copies of @p value.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	void
-	vector<T, Allocator>::resize(size_type new_cap, const_reference value)
+	vector<T, Allocator, Growth>::resize(size_type new_cap, const_reference value)
 	{
-		pointer tmp;
-		try {
-			tmp = alg_allocate(new_cap);
+		while (size() > new_cap)
+			memory.destroy(--tail);
+		if (new_cap > capacity())
+		{
+			/* @p value may be an element of *this */
+			const value_type tmp(value);
+			vec_grow(new_cap);
+			vec_append_amount(new_cap - size(), tmp);
 		}
-		catch (std::bad_alloc& e) {
-			vec_clear();
-			alg_deallocate(head);
-			std::cerr << e.what() << std::endl;
-			throw;
+		else
+			vec_append_amount(new_cap - size(), value);
+	}
+
+	/**
+	 * 	@brief resize uninitialized
+	 * 
+	 * 	@param n The new size.
+	 * 
+	 * 	Like resize but the appended elements are default-initialised: for
+	 * 	trivially default constructible types their bytes are left untouched,
+	 * 	there's no write pass before the caller fills them.
+	 * 
+	 * 	ft::vector<char> buff;
+	 * 	buff.resize_uninitialized(len);
+	 * 	read(fd, buff.data(), len);
+	*/
+	template <class T, class Allocator, class Growth>
+	void
+	vector<T, Allocator, Growth>::resize_uninitialized(size_type n)
+	{
+		while (size() > n)
+			memory.destroy(--tail);
+		vec_grow(n);
+		vec_append_default(n - size());
+	}
+
+	/**
+	 * 	@brief append
+	 * 
+	 * 	@param n The amount of appended elements.
+	 * 	@param gen A callable, each call gives the value of the next element.
+	 * 
+	 * 	Reserves once then constructs the @p n elements in place at the back,
+	 * 	from the results of @p gen.
+	 * 	If @p gen throws the elements already appended are kept.
+	*/
+	template <class T, class Allocator, class Growth>
+	template <typename Generator>
+	void
+	vector<T, Allocator, Growth>::append(size_type n, Generator gen)
+	{
+		vec_grow(size_type(size() + n));
+		for (size_type i = 0 ; i < n ; i++)
+		{
+			memory.construct(tail, gen());
+			tail++;
 		}
-		const size_type s = new_cap < size() ? new_cap : size();
-		vec_array_copy(tmp, head, s);
-		vec_clear();
-		alg_deallocate(head);
-		head = tmp;
-		tail = pointer(head + s);
-		storage = pointer(head + new_cap);
-		vec_set(tail, value, size_type(storage - tail));
 	}
 
 	/**
@@ -1545,9 +2111,9 @@ namespace FT_NAMESPACE
 	 *
 	 * 	Swap the underlying work data of @c *this and @a other.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	vector<T, Allocator>::swap(vector& other)
+	vector<T, Allocator, Growth>::swap(vector& other)
 	{ alg_swap_data(other); }
 
 	//@{
@@ -1558,34 +2124,34 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	@return A boolean that is the result of the requested boolean operation.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline bool
-	operator==(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+	operator==(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 	{ return (lhs.size() == rhs.size() /*&& equal(lhs.begin(), lhs.end(), rhs.begin())*/); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline bool
-	operator<(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+	operator<(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 	{ return (1/*lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())*/);}
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline bool
-	operator!=(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+	operator!=(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 	{ return (!(lhs == rhs)); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline bool
-	operator<=(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+	operator<=(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 	{ return (!(rhs < lhs)); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline bool
-	operator>(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+	operator>(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 	{ return (rhs < lhs); }
 
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline bool
-	operator>=(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+	operator>=(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 	{ return (!(lhs < rhs)); }
 	//@}
 
@@ -1594,8 +2160,8 @@ namespace FT_NAMESPACE
 	 * 
 	 * 	A non member swap spacialisation, built to swap %vectors.
 	*/
-	template <class T, class Allocator>
+	template <class T, class Allocator, class Growth>
 	inline void
-	swap(vector<T, Allocator>& lhs, vector<T, Allocator>& rhs)
+	swap(vector<T, Allocator, Growth>& lhs, vector<T, Allocator, Growth>& rhs)
 	{ lhs.swap(rhs); }
 };
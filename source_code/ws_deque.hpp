@@ -0,0 +1,355 @@
+/** @file ws_deque.hpp
+ *
+ * 	This file contains the work-stealing deque (Chase-Lev).
+*/
+
+# pragma once
+
+# include <ft_allocator.hpp>
+
+# include <atomic>
+# include <cstddef>
+# include <new>
+
+/**
+ * 	@brief Work-stealing deque MACROS
+ *
+ * 	- FT_WS_DEQUE_MIN_CAPACITY: The capacity of a default constructed
+ * 	ws_deque (must be a power of two).
+ *
+ * 	It is overwritable if needed.
+*/
+#ifndef FT_WS_DEQUE_MIN_CAPACITY
+# define FT_WS_DEQUE_MIN_CAPACITY 0x40
+#endif
+
+namespace FT_NAMESPACE
+{
+	/**
+	 * 	@brief Work-stealing deque
+	 *
+	 * 	@tparam T The type holded by the deque, trivially copyable and at most
+	 * 	word sized (a task pointer, an index, ...).
+	 * 	@tparam Allocator An allocator type.
+	 *
+	 * 	The per worker task deque of a work-stealing scheduler (Chase-Lev, with
+	 * 	the C11 orderings of Le, Pop, Cohen and Zappa Nardelli):
+	 *
+	 * 	- The owner thread pushes and pops at the bottom, without atomic
+	 * 	read-modify-write except when it takes the last element.
+	 * 	- Any other thread steals at the top with a CAS on %top, a thief that
+	 * 	loses the race (against the owner or another thief) fails.
+	 * 	- The ring grows on demand (owner side). The old rings are kept until
+	 * 	destruction, a thief can still be reading one of them.
+	 *
+	 * 	Owner: push, pop.
+	 * 	Thieves: steal.
+	 *
+	 * 	NOTE: The slots are std::atomic<T>, a thief reads a slot before knowing
+	 * 	if it won it, so T must be trivially copyable. A larger T is not lock-free
+	 * 	(and needs -latomic), push pointers instead.
+	*/
+	template <class T, class Allocator = allocator<T> >
+	class ws_deque
+	{
+		/* Member types */
+
+		public:
+
+		typedef T					value_type;
+		typedef Allocator			allocator_type;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+		typedef const value_type&	const_reference;
+
+		private:
+
+		typedef std::atomic<value_type>	Slot;
+
+		/* A ring of @c mask + 1 slots, the older one in @c prev */
+		struct Ring
+		{
+			Slot*						slots;
+			size_type					mask;
+			Ring*						prev;
+
+			value_type	get(difference_type i) const
+			{ return (slots[i & mask].load(std::memory_order_relaxed)); }
+
+			void		put(difference_type i, const_reference value)
+			{ slots[i & mask].store(value, std::memory_order_relaxed); }
+		};
+
+		typedef typename Allocator::template rebind<Slot>::other	Slot_allocator;
+		typedef typename Allocator::template rebind<Ring>::other	Ring_allocator;
+
+		/* Core:
+		 *
+		 * top -> The counter of the next stolen element (thieves side).
+		 * bottom -> The counter of the next pushed element (owner side).
+		 * ring -> The current ring, only replaced by the owner.
+		*/
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<difference_type>	top;
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<difference_type>	bottom;
+		alignas(FT_CACHE_LINE_SIZE) std::atomic<Ring*>				ring;
+		allocator_type												memory;
+
+		/* Not copyable: all the threads use the object */
+		ws_deque(const ws_deque&);
+		ws_deque&		operator=(const ws_deque&);
+
+		/* Auxiliar functions */
+
+		Ring*			ws_create_ring(size_type capacity, Ring* prev);
+		Ring*			ws_grow(Ring* old, difference_type t, difference_type b);
+
+		/* Member functions */
+
+		public:
+
+		explicit ws_deque(size_type capacity = FT_WS_DEQUE_MIN_CAPACITY,
+			const allocator_type& alloc = allocator_type());
+		~ws_deque();
+
+		/* Capacity */
+		size_type		capacity() const;
+		size_type		size() const;
+		bool			empty() const;
+
+		/* Owner */
+		void			push(const_reference value);
+		bool			pop(value_type& value);
+
+		/* Thieves */
+		bool			steal(value_type& value);
+	};
+
+	////////////////////////
+	// Auxiliar functions //
+	////////////////////////
+
+	/**
+	 * 	@brief Create ring
+	 *
+	 * 	@param capacity The amount of slots, a power of two.
+	 * 	@param prev The ring replaced by the new one (or NULL).
+	 * 	@return The new ring.
+	*/
+	template <class T, class Allocator>
+	typename ws_deque<T, Allocator>::Ring*
+	ws_deque<T, Allocator>::ws_create_ring(size_type capacity, Ring* prev)
+	{
+		Ring_allocator	ring_memory(memory);
+		Ring*			r = ring_memory.allocate(1);
+
+		try
+		{ r->slots = Slot_allocator(memory).allocate(capacity); }
+		catch (const std::bad_alloc&)
+		{
+			ring_memory.deallocate(r, 1);
+			throw ;
+		}
+		for (size_type i = 0 ; i < capacity ; i++)
+			::new(static_cast<void*>(r->slots + i)) Slot();
+		r->mask = capacity - 1;
+		r->prev = prev;
+		return (r);
+	}
+
+	/**
+	 * 	@brief Grow
+	 *
+	 * 	@param old The full ring.
+	 * 	@param t The top counter seen by the owner.
+	 * 	@param b The bottom counter.
+	 * 	@return A ring twice as large holding the elements [t, b).
+	 *
+	 * 	Counters are kept, only the slots move: a thief that read %top
+	 * 	before the swap reads the same element in the old ring.
+	*/
+	template <class T, class Allocator>
+	typename ws_deque<T, Allocator>::Ring*
+	ws_deque<T, Allocator>::ws_grow(Ring* old, difference_type t, difference_type b)
+	{
+		Ring* r = ws_create_ring((old->mask + 1) << 1, old);
+
+		for (difference_type i = t ; i < b ; i++)
+			r->put(i, old->get(i));
+		ring.store(r, std::memory_order_release);
+		return (r);
+	}
+
+	//////////////////////
+	// Member functions //
+	//////////////////////
+
+	/**
+	 * 	@brief Constructor
+	 *
+	 * 	@param capacity The initial capacity, rounded up to a power of two.
+	 * 	@param alloc An allocator type.
+	*/
+	template <class T, class Allocator>
+	ws_deque<T, Allocator>::ws_deque(size_type capacity, const allocator_type& alloc)
+	: top(0), bottom(0), ring(), memory(alloc)
+	{
+		size_type n = 1;
+
+		while (n < capacity)
+			n <<= 1;
+		ring.store(ws_create_ring(n, 0), std::memory_order_relaxed);
+	}
+
+	/**
+	 * 	@brief Destructor
+	 *
+	 * 	Frees the current and the old rings. No thread may use the deque.
+	*/
+	template <class T, class Allocator>
+	ws_deque<T, Allocator>::~ws_deque()
+	{
+		Ring_allocator	ring_memory(memory);
+		Slot_allocator	slot_memory(memory);
+
+		for (Ring* r = ring.load(std::memory_order_relaxed), *prev ; r ; r = prev)
+		{
+			prev = r->prev;
+			for (size_type i = 0 ; i <= r->mask ; i++)
+				r->slots[i].~Slot();
+			slot_memory.deallocate(r->slots, r->mask + 1);
+			ring_memory.deallocate(r, 1);
+		}
+	}
+
+	//////////////
+	// Capacity //
+	//////////////
+
+	template <class T, class Allocator>
+	inline typename ws_deque<T, Allocator>::size_type
+	ws_deque<T, Allocator>::capacity() const
+	{ return (ring.load(std::memory_order_relaxed)->mask + 1); }
+
+	/**
+	 * 	@brief size
+	 *
+	 * 	@return The amount of elements, only a snapshot while other threads work.
+	*/
+	template <class T, class Allocator>
+	inline typename ws_deque<T, Allocator>::size_type
+	ws_deque<T, Allocator>::size() const
+	{
+		const difference_type b = bottom.load(std::memory_order_relaxed);
+		const difference_type t = top.load(std::memory_order_relaxed);
+
+		return (b > t ? b - t : 0);
+	}
+
+	template <class T, class Allocator>
+	inline bool
+	ws_deque<T, Allocator>::empty() const
+	{ return (size() == 0); }
+
+	///////////
+	// Owner //
+	///////////
+
+	/**
+	 * 	@brief push
+	 *
+	 * 	@param value The pushed value.
+	 *
+	 * 	Grows the ring if it's full.
+	*/
+	template <class T, class Allocator>
+	void
+	ws_deque<T, Allocator>::push(const_reference value)
+	{
+		const difference_type	b = bottom.load(std::memory_order_relaxed);
+		const difference_type	t = top.load(std::memory_order_acquire);
+		Ring*					r = ring.load(std::memory_order_relaxed);
+
+		if (b - t > static_cast<difference_type>(r->mask))
+			r = ws_grow(r, t, b);
+		r->put(b, value);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * 	@brief pop
+	 *
+	 * 	@param value Receives the newest element.
+	 * 	@return False if the deque is empty (or a thief took the last one).
+	 *
+	 * 	The owner reserves the bottom element first, then the fence orders the
+	 * 	reservation before the load of %top: only the last element can be
+	 * 	wanted by a thief too, it's then given to the CAS winner.
+	*/
+	template <class T, class Allocator>
+	bool
+	ws_deque<T, Allocator>::pop(value_type& value)
+	{
+		const difference_type	b = bottom.load(std::memory_order_relaxed) - 1;
+		Ring*					r = ring.load(std::memory_order_relaxed);
+
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		difference_type			t = top.load(std::memory_order_relaxed);
+
+		if (t > b)
+		{
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return (false);
+		}
+
+		const value_type popped = r->get(b);
+
+		if (t == b)
+		{
+			const bool won = top.compare_exchange_strong(t, t + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed);
+
+			bottom.store(b + 1, std::memory_order_relaxed);
+			if (won)
+				value = popped;
+			return (won);
+		}
+		value = popped;
+		return (true);
+	}
+
+	/////////////
+	// Thieves //
+	/////////////
+
+	/**
+	 * 	@brief steal
+	 *
+	 * 	@param value Receives the oldest element.
+	 * 	@return False if the deque is empty or the CAS is lost (another thief
+	 * 	or the owner took the element), the caller may try another victim.
+	*/
+	template <class T, class Allocator>
+	bool
+	ws_deque<T, Allocator>::steal(value_type& value)
+	{
+		difference_type	t = top.load(std::memory_order_acquire);
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		const difference_type b = bottom.load(std::memory_order_acquire);
+
+		if (t >= b)
+			return (false);
+
+		const value_type stolen = ring.load(std::memory_order_acquire)->get(t);
+
+		if (!top.compare_exchange_strong(t, t + 1,
+		std::memory_order_seq_cst, std::memory_order_relaxed))
+			return (false);
+		value = stolen;
+		return (true);
+	}
+};
@@ -5,6 +5,9 @@
 # include "vector_tests.hpp"
 
 # include <deque>
+# include <string>
+
+# include "../source_code/deque.hpp"
 
 template <typename Container, typename T>
 inline static void test_deque_resize(std::ofstream& fd)
@@ -16,6 +19,136 @@ inline static void test_deque_resize(std::ofstream& fd)
 	fd << "TO DO" << std::endl;
 }
 
+template <typename Container, typename T>
+inline static void test_deque_erase_range(std::ofstream& fd, Container& c, size_t first, size_t last)
+{
+	const typename Container::iterator it = c.erase(c.begin() + first, c.begin() + last);
+
+	fd << size_t(it - c.begin()) << " " << c.size() << " { ";
+	for (size_t i = 0 ; i < c.size() ; i++)
+		fd << c[i] << " ";
+	fd << "}" << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void test_deque_erase(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- ERASE ----------------" << std::endl;
+
+	Container c;
+
+	for (size_t i = 0 ; i < 0x10 ; i++)
+		c.push_back(T(i + 1, char('a' + i)));
+
+	// empty range, near the front then near the back
+
+	fd << "\'Erase\' test 1: ";
+	test_deque_erase_range<Container, T>(fd, c, 2, 2);
+	fd << "\'Erase\' test 2: ";
+	test_deque_erase_range<Container, T>(fd, c, c.size() - 2, c.size() - 2);
+
+	// range near the front, then near the back
+
+	fd << "\'Erase\' test 3: ";
+	test_deque_erase_range<Container, T>(fd, c, 1, 4);
+	fd << "\'Erase\' test 4: ";
+	test_deque_erase_range<Container, T>(fd, c, c.size() - 5, c.size() - 1);
+
+	// single element, then everything
+
+	fd << "\'Erase\' test 5: ";
+	test_deque_erase_range<Container, T>(fd, c, 3, 4);
+	fd << "\'Erase\' test 6: ";
+	test_deque_erase_range<Container, T>(fd, c, 0, c.size());
+}
+
+template <typename Container>
+inline static void test_deque_growth_dump(std::ofstream& fd, const Container& c)
+{
+	long	sum = 0;
+	bool	ordered = true;
+
+	for (size_t i = 0 ; i < c.size() ; i++)
+	{
+		sum += c[i];
+		if (i && c[i - 1] + 1 != c[i])
+			ordered = false;
+	}
+	fd << c.size() << " " << c.front() << " " << c.back() << " " << sum << " " << ordered << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void test_deque_growth(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- GROWTH ----------------" << std::endl;
+
+	Container	c;
+
+	c.push_back(T(0));
+
+	// Elements must keep their address while nodes are added at either end
+
+	const T* const	first = &c.front();
+	bool			stable = true;
+
+	for (int i = 1 ; i < 0x1000 ; i++)
+	{
+		c.push_back(T(i));
+		c.push_front(T(-i));
+		stable = stable && first == &c[size_t(i)];
+	}
+	fd << "\'Growth\' test 1: " << stable << " ";
+	test_deque_growth_dump(fd, c);
+
+	// Drain the back then grow the front only, the map has to recentre
+
+	while (c.size() > 0x10)
+		c.pop_back();
+	for (int i = 0x1000 ; i < 0x3000 ; i++)
+		c.push_front(T(-i));
+	fd << "\'Growth\' test 2: ";
+	test_deque_growth_dump(fd, c);
+
+	// Same from the other side
+
+	while (c.size() > 0x10)
+		c.pop_front();
+	for (int i = 0 ; i < 0x2000 ; i++)
+		c.push_back(T(c.back() + 1));
+	fd << "\'Growth\' test 3: ";
+	test_deque_growth_dump(fd, c);
+
+	// Sliding window, the container never holds more than a few nodes
+
+	for (int i = 0 ; i < 0x4000 ; i++)
+	{
+		c.push_back(T(c.back() + 1));
+		c.pop_front();
+	}
+	fd << "\'Growth\' test 4: ";
+	test_deque_growth_dump(fd, c);
+}
+
+template <typename Container, typename T>
+inline static void start_deque_growth_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_deque_growth<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+template <typename Container, typename T>
+inline static void start_deque_erase_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_deque_erase<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
 template <typename Container, typename T>
 inline static void start_deque_tests(const std::string& filename)
 {
@@ -34,4 +167,8 @@ inline static void deque_tests()
 {
 	start_deque_tests<std::deque<int>, int>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_DEQUE_FILENAME))));
 	start_deque_tests<std::deque<int>, int>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_DEQUE_FILENAME))));
+	start_deque_erase_tests<std::deque<std::string>, std::string>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_DEQUE_ERASE_FILENAME))));
+	start_deque_erase_tests<ft::deque<std::string>, std::string>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_DEQUE_ERASE_FILENAME))));
+	start_deque_growth_tests<std::deque<int>, int>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_DEQUE_GROWTH_FILENAME))));
+	start_deque_growth_tests<ft::deque<int>, int>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_DEQUE_GROWTH_FILENAME))));
 }
\ No newline at end of file
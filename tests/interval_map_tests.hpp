@@ -0,0 +1,235 @@
+# pragma once
+
+# include "tester.hpp"
+
+# include <map>
+# include <string>
+
+# include "../source_code/interval_map.hpp"
+
+/// A stateful bound order: the reversed one only works if the tree and
+/// its augment share the instance given to the constructor.
+struct im_order
+{
+	bool	reversed;
+
+	im_order(bool r = false) : reversed(r) { }
+
+	bool operator()(int lhs, int rhs) const
+	{ return (reversed ? rhs < lhs : lhs < rhs); }
+};
+
+/// A std::multimap with the %interval_map interface, the overlap lookups
+/// scan every interval.
+template <typename Compare>
+struct im_model
+{
+	typedef ft::interval<int>							key_type;
+	typedef int											mapped_type;
+	typedef std::pair<const key_type, int>				value_type;
+	typedef Compare										bound_compare;
+
+	struct key_compare
+	{
+		bound_compare comp;
+
+		key_compare(const bound_compare& c) : comp(c) { }
+
+		bool operator()(const key_type& lhs, const key_type& rhs) const
+		{ return (comp(lhs.low, rhs.low) || (!comp(rhs.low, lhs.low) && comp(lhs.high, rhs.high))); }
+	};
+
+	typedef std::multimap<key_type, int, key_compare>	Map;
+	typedef typename Map::iterator						iterator;
+
+	Map				c;
+	bound_compare	comp;
+
+	explicit im_model(const bound_compare& cmp = bound_compare()) : c(key_compare(cmp)), comp(cmp) { }
+
+	bool		im_overlaps(const key_type& a, const key_type& b) const
+	{ return (!comp(a.high, b.low) && !comp(b.high, a.low)); }
+
+	size_t		size() const { return (c.size()); }
+	iterator	begin() { return (c.begin()); }
+	iterator	end() { return (c.end()); }
+	iterator	insert(const value_type& x) { return (c.insert(x)); }
+	void		erase(iterator it) { c.erase(it); }
+	size_t		erase(const key_type& k) { return (c.erase(k)); }
+
+	iterator	find_overlap(const key_type& k)
+	{
+		iterator it = c.begin();
+
+		while (it != c.end() && !im_overlaps(it->first, k))
+			++it;
+		return (it);
+	}
+
+	size_t		count_overlaps(const key_type& k) const
+	{
+		size_t n = 0;
+
+		for (typename Map::const_iterator it = c.begin() ; it != c.end() ; ++it)
+			n += im_overlaps(it->first, k);
+		return (n);
+	}
+
+	template <typename Function>
+	Function	for_each_overlap(const key_type& k, Function f)
+	{
+		for (iterator it = c.begin() ; it != c.end() ; ++it)
+			if (im_overlaps(it->first, k))
+				f(*it);
+		return (f);
+	}
+};
+
+/// Prints the overlapping values, and sums them.
+struct im_printer
+{
+	std::ofstream*	fd;
+	long			sum;
+
+	im_printer(std::ofstream& f) : fd(&f), sum() { }
+
+	void operator()(const std::pair<const ft::interval<int>, int>& value)
+	{
+		*fd << "[" << value.first.low << "," << value.first.high << "]:" << value.second << " ";
+		sum += value.second;
+	}
+};
+
+/// The interval [a, b] with a <= b, flipped for the reversed order.
+inline static ft::interval<int> im_interval(int a, int b, const im_order& order)
+{ return (order.reversed ? ft::interval<int>(b, a) : ft::interval<int>(a, b)); }
+
+template <typename Map>
+inline static void im_query(std::ofstream& fd, Map& m, const ft::interval<int>& k)
+{
+	const typename Map::iterator first = m.find_overlap(k);
+
+	fd << "[" << k.low << "," << k.high << "] " << m.count_overlaps(k) << " ";
+	if (first != m.end())
+		fd << "first [" << first->first.low << "," << first->first.high << "] { ";
+	else
+		fd << "none { ";
+	fd << m.for_each_overlap(k, im_printer(fd)).sum << " }" << std::endl;
+}
+
+/// Counts and checksums a sweep of queries, point and ranges.
+template <typename Map>
+inline static void im_sweep(std::ofstream& fd, Map& m, const im_order& order)
+{
+	size_t	count = 0;
+	long	sum = 0;
+
+	for (int p = -0x20 ; p < 0x420 ; p += 7)
+	{
+		count += m.count_overlaps(im_interval(p, p, order));
+		count += m.count_overlaps(im_interval(p, p + p % 0x30, order));
+	}
+
+	std::ofstream	null;
+
+	for (int p = -0x20 ; p < 0x420 ; p += 0x40)
+		sum += m.for_each_overlap(im_interval(p, p + 0x10, order), im_printer(null)).sum;
+	fd << m.size() << " " << count << " " << sum << std::endl;
+}
+
+template <typename Map>
+inline static void test_im_overlaps(std::ofstream& fd, const im_order& order)
+{
+	Map m(order);
+
+	// Empty map
+
+	fd << "\'Overlap\' test 1: ";
+	im_query(fd, m, im_interval(0, 100, order));
+
+	// Intervals of every length, equal keys and single points included
+
+	for (int i = 0 ; i < 0x200 ; i++)
+	{
+		const int low = int((unsigned(i) * 2654435761u) >> 22) % 0x400;
+		const int len = (i % 5 == 0) ? 0 : int((unsigned(i) * 40503u) >> 6) % (i % 7 == 0 ? 0x100 : 0x10);
+
+		m.insert(std::pair<const ft::interval<int>, int>(im_interval(low, low + len, order), i));
+		if (i % 0x40 == 0)
+			m.insert(std::pair<const ft::interval<int>, int>(im_interval(low, low + len, order), -i));
+	}
+
+	fd << "\'Overlap\' test 2: ";
+	im_query(fd, m, im_interval(0x100, 0x100, order));
+	fd << "\'Overlap\' test 3: ";
+	im_query(fd, m, im_interval(0x200, 0x210, order));
+	fd << "\'Overlap\' test 4: ";
+	im_query(fd, m, im_interval(-0x40, -1, order));
+	fd << "\'Overlap\' test 5: ";
+	im_query(fd, m, im_interval(0x500, 0x600, order));
+	fd << "\'Overlap\' test 6: ";
+	im_sweep(fd, m, order);
+
+	// The max high bounds follow the erase rebalances
+
+	size_t erased = 0;
+
+	for (typename Map::iterator it = m.begin() ; it != m.end() ; )
+	{
+		if (it->second % 3 == 0)
+		{
+			typename Map::iterator next = it;
+
+			++next;
+			m.erase(it);
+			it = next;
+			erased++;
+		}
+		else
+			++it;
+	}
+	erased += m.erase(im_interval(0x3ff, 0x3ff, order));
+	fd << "\'Overlap\' test 7: " << erased << " ";
+	im_sweep(fd, m, order);
+	fd << "\'Overlap\' test 8: ";
+	im_query(fd, m, im_interval(0x100, 0x140, order));
+
+	// A long interval added last has to reach every query
+
+	m.insert(std::pair<const ft::interval<int>, int>(im_interval(-0x100, 0x1000, order), 0x1000));
+	fd << "\'Overlap\' test 9: ";
+	im_sweep(fd, m, order);
+}
+
+template <typename Map>
+inline static void test_im_overlaps_less(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- OVERLAPS ----------------" << std::endl;
+
+	test_im_overlaps<Map>(fd, im_order(false));
+}
+
+template <typename Map>
+inline static void test_im_overlaps_reversed(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- OVERLAPS (REVERSED ORDER) ----------------" << std::endl;
+
+	test_im_overlaps<Map>(fd, im_order(true));
+}
+
+template <typename Map>
+inline static void start_interval_map_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_im_overlaps_less<Map>,
+		&test_im_overlaps_reversed<Map>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+inline static void interval_map_tests()
+{
+	start_interval_map_tests<im_model<im_order> >(std::string(std::string(std::string(TEST_DIR) + std::string(STD_INTERVAL_MAP_FILENAME))));
+	start_interval_map_tests<ft::interval_map<int, int, im_order> >(std::string(std::string(std::string(TEST_DIR) + std::string(FT_INTERVAL_MAP_FILENAME))));
+}
@@ -5,6 +5,8 @@
 # include "shared_test_tree.hpp"
 # include "tester.hpp"
 
+# include <sys/stat.h>
+
 # include "vector_tests.hpp"
 # include "list_tests.hpp"
 # include "map_tests.hpp"
@@ -14,6 +16,10 @@
 # include "multimap_tests.hpp"
 # include "set_tests.hpp"
 # include "multiset_tests.hpp"
+# include "ring_buffer_tests.hpp"
+# include "spsc_queue_tests.hpp"
+# include "priority_queue_tests.hpp"
+# include "interval_map_tests.hpp"
 
 /**
  * 	TO DO tests:
@@ -27,6 +33,8 @@ int main()
 {
 	bool status = 0;
 
+	mkdir(TEST_DIR, 0755);
+
 	static void (*const tests[])() = {
 		&execute_shared_tests_for_linear_containers<int>,
 		&execute_shared_tests_for_tree_containers<int, int>,
@@ -38,7 +46,11 @@ int main()
 		&deque_tests,
 		&multimap_tests,
 		&set_tests,
-		&multiset_tests
+		&multiset_tests,
+		&ring_buffer_tests,
+		&spsc_queue_tests,
+		&priority_queue_tests,
+		&interval_map_tests
 	};
 
 	for (size_t i = 0 ; i < ARRAY_SIZE(tests) ; i++)
@@ -72,11 +84,37 @@ int main()
 		FT_DEQUE_FILENAME,
 		STD_DEQUE_FILENAME,
 		FT_MULTIMAP_FILENAME,
-		STD_MULTISET_FILENAME,
+		STD_MULTIMAP_FILENAME,
 		FT_SET_FILENAME,
 		STD_SET_FILENAME,
 		FT_MULTISET_FILENAME,
-		STD_MULTISET_FILENAME
+		STD_MULTISET_FILENAME,
+		FT_SMALL_VECTOR_FILENAME,
+		STD_SMALL_VECTOR_FILENAME,
+		FT_DEQUE_ERASE_FILENAME,
+		STD_DEQUE_ERASE_FILENAME,
+		FT_VECTOR_COPY_FILENAME,
+		STD_VECTOR_COPY_FILENAME,
+		FT_VECTOR_ALLOCATOR_FILENAME,
+		STD_VECTOR_ALLOCATOR_FILENAME,
+		FT_VECTOR_ARENA_FILENAME,
+		STD_VECTOR_ARENA_FILENAME,
+		FT_SMALL_VECTOR_ALLOCATOR_FILENAME,
+		STD_SMALL_VECTOR_ALLOCATOR_FILENAME,
+		FT_VECTOR_INSERT_FILENAME,
+		STD_VECTOR_INSERT_FILENAME,
+		FT_VECTOR_EXCEPTION_FILENAME,
+		STD_VECTOR_EXCEPTION_FILENAME,
+		FT_DEQUE_GROWTH_FILENAME,
+		STD_DEQUE_GROWTH_FILENAME,
+		FT_RING_BUFFER_FILENAME,
+		STD_RING_BUFFER_FILENAME,
+		FT_SPSC_QUEUE_FILENAME,
+		STD_SPSC_QUEUE_FILENAME,
+		FT_PRIORITY_QUEUE_FILENAME,
+		STD_PRIORITY_QUEUE_FILENAME,
+		FT_INTERVAL_MAP_FILENAME,
+		STD_INTERVAL_MAP_FILENAME
 	};
 
 	for (size_t i = 0 ; i < ARRAY_SIZE(filenames) ; i++)
@@ -86,9 +124,8 @@ int main()
 			std::ifstream ifs_ft;
 			std::ifstream ifs_std;
 
-			// TO DO: This does not work ...
-			ifs_ft.open(std::string("../") + std::string(TEST_DIR) + filenames[i - 1]);
-			ifs_ft.open(std::string("../") + std::string(TEST_DIR) + filenames[i]);
+			ifs_ft.open(std::string(TEST_DIR) + filenames[i - 1]);
+			ifs_std.open(std::string(TEST_DIR) + filenames[i]);
 
 			if (ifs_ft.bad() || ifs_std.bad())
 			{
@@ -1,7 +1,14 @@
-
 # pragma once
 
+# include "tester.hpp"
+# include "tree_tests.hpp"
+
+# include <map>
+
+# include "../source_code/map.hpp"
+
 inline void map_tests()
 {
-
-}
\ No newline at end of file
+	start_tree_tests<std::map<int, int>, int>(std::string(std::string(TEST_DIR) + std::string(STD_MAP_FILENAME)));
+	start_tree_tests<ft::map<int, int>, int>(std::string(std::string(TEST_DIR) + std::string(FT_MAP_FILENAME)));
+}
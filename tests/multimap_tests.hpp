@@ -1,7 +1,14 @@
-
 # pragma once
 
+# include "tester.hpp"
+# include "tree_tests.hpp"
+
+# include <map>
+
+# include "../source_code/multimap.hpp"
+
 inline void multimap_tests()
 {
-
-}
\ No newline at end of file
+	start_tree_tests<std::multimap<int, int>, int>(std::string(std::string(TEST_DIR) + std::string(STD_MULTIMAP_FILENAME)));
+	start_tree_tests<ft::multimap<int, int>, int>(std::string(std::string(TEST_DIR) + std::string(FT_MULTIMAP_FILENAME)));
+}
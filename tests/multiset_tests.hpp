@@ -1,7 +1,14 @@
-
 # pragma once
 
+# include "tester.hpp"
+# include "tree_tests.hpp"
+
+# include <set>
+
+# include "../source_code/multiset.hpp"
+
 inline void multiset_tests()
 {
-
-}
\ No newline at end of file
+	start_tree_tests<std::multiset<int>, int>(std::string(std::string(TEST_DIR) + std::string(STD_MULTISET_FILENAME)));
+	start_tree_tests<ft::multiset<int>, int>(std::string(std::string(TEST_DIR) + std::string(FT_MULTISET_FILENAME)));
+}
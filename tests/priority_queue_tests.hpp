@@ -0,0 +1,209 @@
+# pragma once
+
+# include "tester.hpp"
+
+# include <queue>
+# include <vector>
+# include <functional>
+
+# include "../source_code/priority_queue.hpp"
+
+/// A deterministic pseudo random sequence, ties included.
+inline static int pq_value(int i)
+{ return (int((unsigned(i) * 2654435761u) >> 20) % 0x200); }
+
+template <typename Queue, typename InputIt>
+inline static void pq_push_range(Queue& q, InputIt first, InputIt last)
+{
+	for ( ; first != last ; ++first)
+		q.push(*first);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity, typename InputIt>
+inline static void pq_push_range(ft::priority_queue<T, Container, Compare, Arity>& q, InputIt first, InputIt last)
+{ q.push_range(first, last); }
+
+template <typename Queue>
+inline static void pq_dump(std::ofstream& fd, Queue& q)
+{
+	fd << q.size() << " { ";
+	while (!q.empty())
+	{
+		fd << q.top() << " ";
+		q.pop();
+	}
+	fd << "}" << std::endl;
+}
+
+template <typename Queue>
+inline static void test_pq_push_pop(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- PUSH/POP ----------------" << std::endl;
+
+	Queue q;
+
+	fd << "\'Priority queue\' test 1: " << q.empty() << " " << q.size() << std::endl;
+
+	// Interleaved pushes and pops
+
+	for (int i = 0 ; i < 0x100 ; i++)
+	{
+		q.push(pq_value(i));
+		if (i % 3 == 2)
+			q.pop();
+	}
+	fd << "\'Priority queue\' test 2: " << q.top() << " ";
+	pq_dump(fd, q);
+
+	// Range constructor
+
+	std::vector<int> v;
+
+	for (int i = 0 ; i < 0x40 ; i++)
+		v.push_back(pq_value(i + 0x1000));
+
+	Queue r(v.begin(), v.end());
+
+	fd << "\'Priority queue\' test 3: ";
+	pq_dump(fd, r);
+}
+
+template <typename Queue>
+inline static void test_pq_push_range(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- PUSH RANGE ----------------" << std::endl;
+
+	std::vector<int> v;
+
+	for (int i = 0 ; i < 0x200 ; i++)
+		v.push_back(pq_value(i + 0x2000));
+
+	// Into an empty queue (heapify), a small batch (sift up), a large one (heapify)
+
+	Queue q;
+
+	pq_push_range(q, v.begin(), v.begin() + 0x80);
+	fd << "\'Push range\' test 1: " << q.size() << " " << q.top() << std::endl;
+
+	pq_push_range(q, v.begin() + 0x80, v.begin() + 0x84);
+	fd << "\'Push range\' test 2: " << q.size() << " " << q.top() << std::endl;
+
+	pq_push_range(q, v.begin() + 0x84, v.end());
+	fd << "\'Push range\' test 3: " << q.size() << " " << q.top() << std::endl;
+
+	pq_push_range(q, v.end(), v.end());
+	fd << "\'Push range\' test 4: ";
+	pq_dump(fd, q);
+}
+
+/// The %indexed_priority_queue interface over a flat array, top() is a
+/// linear scan. The handles are never reused so they are not logged.
+template <typename T, typename Compare>
+struct ipq_model
+{
+	typedef T				value_type;
+	typedef size_t			size_type;
+	typedef size_t			handle_type;
+
+	std::vector<T>		values;
+	std::vector<bool>	alive;
+	size_type			count;
+	Compare				comp;
+
+	ipq_model() : values(), alive(), count(), comp() { }
+
+	handle_type	top_handle() const
+	{
+		handle_type best = values.size();
+
+		for (handle_type h = 0 ; h < values.size() ; h++)
+			if (alive[h] && (best == values.size() || comp(values[best], values[h])))
+				best = h;
+		return (best);
+	}
+
+	const T&	top() const { return (values[top_handle()]); }
+	const T&	get(handle_type h) const { return (values[h]); }
+	bool		contains(handle_type h) const { return (h < alive.size() && alive[h]); }
+	bool		empty() const { return (!count); }
+	size_type	size() const { return (count); }
+
+	handle_type	push(const T& x)
+	{
+		values.push_back(x);
+		alive.push_back(true);
+		count++;
+		return (values.size() - 1);
+	}
+
+	void		pop() { erase(top_handle()); }
+	void		decrease_key(handle_type h, const T& x) { values[h] = x; }
+	void		update(handle_type h, const T& x) { values[h] = x; }
+	void		erase(handle_type h) { alive[h] = false; count--; }
+};
+
+template <typename Queue>
+inline static void test_ipq(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- INDEXED ----------------" << std::endl;
+
+	typedef typename Queue::handle_type handle_type;
+
+	Queue						q;
+	std::vector<handle_type>	h;
+
+	// Distinct values: the order never depends on ties
+
+	for (int i = 0 ; i < 0x40 ; i++)
+		h.push_back(q.push((i * 37) % 0x40 * 10));
+	fd << "\'Indexed\' test 1: " << q.size() << " " << q.top() << " " << (q.get(q.top_handle()) == q.top()) << std::endl;
+
+	// decrease_key moves toward the top (std::greater: a smaller key)
+
+	q.decrease_key(h[0x20], -5);
+	q.decrease_key(h[3], 1);
+	fd << "\'Indexed\' test 2: " << q.top() << " " << q.get(h[3]) << std::endl;
+
+	// update both ways, erase in the middle and at the top
+
+	q.update(h[0x20], 1000);
+	q.update(h[7], -7);
+	q.erase(h[0x11]);
+	q.erase(q.top_handle());
+	fd << "\'Indexed\' test 3: " << q.size() << " " << q.top() << " " << q.contains(h[0x11]) << " " << q.contains(h[7]) << std::endl;
+
+	q.pop();
+	fd << "\'Indexed\' test 4: " << q.contains(h[3]) << " " << q.contains(h[0x20]) << " ";
+	pq_dump(fd, q);
+}
+
+template <typename Binary, typename Quaternary, typename Octonary, typename Min, typename Indexed>
+inline static void start_priority_queue_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_pq_push_pop<Binary>,
+		&test_pq_push_pop<Quaternary>,
+		&test_pq_push_pop<Octonary>,
+		&test_pq_push_pop<Min>,
+		&test_pq_push_range<Binary>,
+		&test_pq_push_range<Quaternary>,
+		&test_pq_push_range<Octonary>,
+		&test_pq_push_range<Min>,
+		&test_ipq<Indexed>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+inline static void priority_queue_tests()
+{
+	start_priority_queue_tests<std::priority_queue<int>, std::priority_queue<int>, std::priority_queue<int>,
+		std::priority_queue<int, std::vector<int>, std::greater<int> >, ipq_model<int, std::greater<int> > >
+		(std::string(std::string(std::string(TEST_DIR) + std::string(STD_PRIORITY_QUEUE_FILENAME))));
+	start_priority_queue_tests<ft::priority_queue<int, ft::vector<int>, std::less<int>, 2>,
+		ft::priority_queue<int, ft::vector<int>, std::less<int>, 4>,
+		ft::priority_queue<int, ft::vector<int>, std::less<int>, 8>,
+		ft::priority_queue<int, ft::vector<int>, std::greater<int> >,
+		ft::indexed_priority_queue<int, std::greater<int> > >
+		(std::string(std::string(std::string(TEST_DIR) + std::string(FT_PRIORITY_QUEUE_FILENAME))));
+}
@@ -0,0 +1,214 @@
+# pragma once
+
+# include "tester.hpp"
+# include "vector_tests.hpp"
+
+# include <deque>
+# include <queue>
+# include <string>
+
+# include "../source_code/ring_buffer.hpp"
+# include "../source_code/queue.hpp"
+
+/// A std::deque with the %ring_buffer interface, the capacity is only
+/// tracked in overwrite mode.
+template <typename T>
+struct rb_model
+{
+	typedef T			value_type;
+	typedef size_t		size_type;
+
+	std::deque<T>	c;
+	size_type		cap;
+	bool			overwrite;
+
+	rb_model() : c(), cap(), overwrite(false) { }
+	rb_model(size_type capacity, bool overwrite_mode) : c(), cap(capacity), overwrite(overwrite_mode) { }
+
+	size_type	size() const { return (c.size()); }
+	bool		empty() const { return (c.empty()); }
+	bool		full() const { return (overwrite && c.size() == cap); }
+	const T&	operator[](size_type n) const { return (c[n]); }
+	const T&	front() const { return (c.front()); }
+	const T&	back() const { return (c.back()); }
+
+	void		pop_front() { if (!c.empty()) c.pop_front(); }
+
+	void		push_back(const T& x)
+	{
+		if (overwrite && c.size() == cap)
+			c.pop_front();
+		c.push_back(x);
+	}
+
+	void		push_back_n(const T* src, size_type n)
+	{
+		for (size_type i = 0 ; i < n ; i++)
+			push_back(src[i]);
+	}
+
+	size_type	pop_front_n(T* dst, size_type n)
+	{
+		if (n > c.size())
+			n = c.size();
+		for (size_type i = 0 ; i < n ; i++)
+		{
+			dst[i] = c.front();
+			c.pop_front();
+		}
+		return (n);
+	}
+};
+
+template <typename Container, typename T>
+inline static void test_rb_push_pop(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- PUSH BACK/POP FRONT ----------------" << std::endl;
+
+	Container c;
+
+	// Grow while head and tail wrap around the buffer
+
+	for (int i = 0 ; i < 0x40 ; i++)
+	{
+		c.push_back(vec_value<Container>(i));
+		if (i % 3 == 0)
+			c.pop_front();
+	}
+	fd << "\'Push back\' test 1: " << c.front() << " " << c.back() << " ";
+	vec_dump(fd, c);
+
+	// Drain then refill an empty buffer
+
+	while (!c.empty())
+		c.pop_front();
+	c.pop_front();
+	for (int i = 0 ; i < 5 ; i++)
+		c.push_back(vec_value<Container>(i + 100));
+	fd << "\'Pop front\' test 1: ";
+	vec_dump(fd, c);
+}
+
+template <typename Container, typename T>
+inline static void test_rb_overwrite(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- OVERWRITE ----------------" << std::endl;
+
+	Container c(8, true);
+
+	// Not full yet, then one lap, then several laps
+
+	for (int i = 0 ; i < 5 ; i++)
+		c.push_back(vec_value<Container>(i));
+	fd << "\'Overwrite\' test 1: " << c.full() << " ";
+	vec_dump(fd, c);
+
+	for (int i = 5 ; i < 9 ; i++)
+		c.push_back(vec_value<Container>(i));
+	fd << "\'Overwrite\' test 2: " << c.full() << " ";
+	vec_dump(fd, c);
+
+	for (int i = 9 ; i < 0x2b ; i++)
+		c.push_back(vec_value<Container>(i));
+	fd << "\'Overwrite\' test 3: " << c.full() << " ";
+	vec_dump(fd, c);
+
+	// Pop makes room again
+
+	c.pop_front();
+	c.pop_front();
+	fd << "\'Overwrite\' test 4: " << c.full() << " ";
+	vec_dump(fd, c);
+}
+
+template <typename Container, typename T>
+inline static void test_rb_bulk(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- BULK ----------------" << std::endl;
+
+	T	src[0x20];
+	T	dst[0x20];
+
+	for (int i = 0 ; i < 0x20 ; i++)
+		src[i] = vec_value<Container>(i);
+
+	// Growing mode, the copies wrap around the end of the buffer
+
+	Container c;
+
+	c.push_back_n(src, 6);
+	fd << "\'Bulk\' test 1: " << c.pop_front_n(dst, 4) << " " << dst[0] << " " << dst[3] << " ";
+	vec_dump(fd, c);
+
+	c.push_back_n(src + 6, 5);
+	fd << "\'Bulk\' test 2: ";
+	vec_dump(fd, c);
+
+	c.push_back_n(src, 0x20);
+	fd << "\'Bulk\' test 3: ";
+	vec_dump(fd, c);
+
+	fd << "\'Bulk\' test 4: " << c.pop_front_n(dst, 0x20) << " " << dst[0] << " " << dst[0x1f] << " ";
+	vec_dump(fd, c);
+
+	fd << "\'Bulk\' test 5: " << c.pop_front_n(dst, 0x20) << " ";
+	vec_dump(fd, c);
+
+	fd << "\'Bulk\' test 6: " << c.pop_front_n(dst, 0x20) << " ";
+	vec_dump(fd, c);
+
+	// Overwrite mode, only the last elements are kept
+
+	Container o(8, true);
+
+	o.push_back_n(src, 3);
+	o.push_back_n(src + 3, 7);
+	fd << "\'Bulk\' test 7: ";
+	vec_dump(fd, o);
+
+	o.push_back_n(src, 0x13);
+	fd << "\'Bulk\' test 8: ";
+	vec_dump(fd, o);
+
+	fd << "\'Bulk\' test 9: " << o.pop_front_n(dst, 3) << " " << dst[0] << " " << dst[2] << " ";
+	vec_dump(fd, o);
+}
+
+template <typename Queue, typename T>
+inline static void test_rb_queue(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- QUEUE ----------------" << std::endl;
+
+	Queue q;
+
+	for (int i = 0 ; i < 0x30 ; i++)
+	{
+		q.push(T(i));
+		if (i % 4 == 0)
+			q.pop();
+	}
+	fd << "\'Queue\' test 1: " << q.size() << " " << q.front() << " " << q.back() << std::endl;
+
+	while (q.size() > 1)
+		q.pop();
+	fd << "\'Queue\' test 2: " << q.size() << " " << q.front() << " " << q.back() << std::endl;
+}
+
+template <typename Container, typename Queue, typename T>
+inline static void start_ring_buffer_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_rb_push_pop<Container, T>,
+		&test_rb_overwrite<Container, T>,
+		&test_rb_bulk<Container, T>,
+		&test_rb_queue<Queue, int>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+inline static void ring_buffer_tests()
+{
+	start_ring_buffer_tests<rb_model<std::string>, std::queue<int>, std::string>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_RING_BUFFER_FILENAME))));
+	start_ring_buffer_tests<ft::ring_buffer<std::string>, ft::queue<int, ft::ring_buffer<int> >, std::string>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_RING_BUFFER_FILENAME))));
+}
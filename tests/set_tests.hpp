@@ -1,7 +1,14 @@
-
 # pragma once
 
+# include "tester.hpp"
+# include "tree_tests.hpp"
+
+# include <set>
+
+# include "../source_code/set.hpp"
+
 inline void set_tests()
 {
-
-}
\ No newline at end of file
+	start_tree_tests<std::set<int>, int>(std::string(std::string(TEST_DIR) + std::string(STD_SET_FILENAME)));
+	start_tree_tests<ft::set<int>, int>(std::string(std::string(TEST_DIR) + std::string(FT_SET_FILENAME)));
+}
@@ -178,11 +178,11 @@ inline static void test_tree_capacity(std::ofstream& fd)
 	Container e;
 
 	fd << "\'Empty\' test 1: " << e.empty() << std::endl;
-	e.insert({{T(42), T(42)},});
+	e.insert(std::pair<T, T>(T(42), T(42)));
 	fd << "\'Empty\' test 2: " << !e.empty() << std::endl;
 	e.erase(e.begin());
 	fd << "\'Empty\' test 3: " << e.empty() << std::endl;
-	e.insert({{T(42), T(42)},});
+	e.insert(std::pair<T, T>(T(42), T(42)));
 	e.clear();
 	fd << "\'Empty\' test 4: " << e.empty() << std::endl;
 
@@ -191,7 +191,7 @@ inline static void test_tree_capacity(std::ofstream& fd)
 	fd << "\'Size\' test 1: " << e.size() << std::endl;
 	Container r;
 	fd << "\'Size\' test 2: " << r.size() << std::endl;
-	e.insert({{T(42), T(42)},});
+	e.insert(std::pair<T, T>(T(42), T(42)));
 	fd << "\'Size\' test 3: " << e.size() << std::endl;
 
 	for (size_t i = 15 ; i > size_t() ; i--)
@@ -224,7 +224,9 @@ inline static void test_tree_modifiers(std::ofstream& fd)
 	while (waitpid(pid, &wstatus, 0) >= 0);
 	fd << "\'Clear\' test 1: " << wstatus << std::endl;
 
-	Container v {{T(42), T(42)},};
+	Container v;
+
+	v.insert(std::pair<T, T>(T(42), T(42)));
 	v.clear();
 	fd << "\'Clear\' test 2: " << c.size() << " " << c.empty() << std::endl;
 
@@ -0,0 +1,223 @@
+# pragma once
+
+# include "tester.hpp"
+# include "vector_tests.hpp"
+
+# include <deque>
+# include <mutex>
+# include <thread>
+# include <string>
+
+# include "../source_code/spsc_queue.hpp"
+
+/// A std::deque behind a std::mutex with the %spsc_queue interface.
+template <typename T>
+struct sq_model
+{
+	typedef T			value_type;
+	typedef size_t		size_type;
+
+	std::deque<T>		c;
+	size_type			cap;
+	mutable std::mutex	lock;
+
+	explicit sq_model(size_type capacity) : c(), cap(1), lock()
+	{
+		while (cap < capacity)
+			cap <<= 1;
+	}
+
+	size_type	capacity() const { return (cap); }
+	size_type	size() const { std::lock_guard<std::mutex> g(lock); return (c.size()); }
+	bool		empty() const { return (size() == 0); }
+
+	bool		try_push(const T& x)
+	{
+		std::lock_guard<std::mutex> g(lock);
+
+		if (c.size() == cap)
+			return (false);
+		c.push_back(x);
+		return (true);
+	}
+
+	void		push(const T& x)
+	{
+		while (!try_push(x))
+			std::this_thread::yield();
+	}
+
+	size_type	try_push_n(const T* src, size_type n)
+	{
+		std::lock_guard<std::mutex> g(lock);
+
+		if (n > cap - c.size())
+			n = cap - c.size();
+		c.insert(c.end(), src, src + n);
+		return (n);
+	}
+
+	T&			front() { std::lock_guard<std::mutex> g(lock); return (c.front()); }
+	void		pop() { std::lock_guard<std::mutex> g(lock); c.pop_front(); }
+
+	bool		try_pop(T& x)
+	{
+		std::lock_guard<std::mutex> g(lock);
+
+		if (c.empty())
+			return (false);
+		x = c.front();
+		c.pop_front();
+		return (true);
+	}
+
+	size_type	try_pop_n(T* dst, size_type n)
+	{
+		std::lock_guard<std::mutex> g(lock);
+
+		if (n > c.size())
+			n = c.size();
+		for (size_type i = 0 ; i < n ; i++)
+		{
+			dst[i] = c.front();
+			c.pop_front();
+		}
+		return (n);
+	}
+};
+
+template <typename Queue>
+inline static void sq_dump(std::ofstream& fd, Queue& q)
+{
+	typename Queue::value_type	x;
+
+	fd << q.size() << " { ";
+	while (q.try_pop(x))
+		fd << x << " ";
+	fd << "}" << std::endl;
+}
+
+template <typename Queue, typename T>
+inline static void test_sq_single_thread(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- SINGLE THREAD ----------------" << std::endl;
+
+	Queue	q(5);
+	T		x;
+
+	// Capacity rounded up, empty pop
+
+	fd << "\'Spsc\' test 1: " << q.capacity() << " " << q.empty() << " " << q.try_pop(x) << std::endl;
+
+	// Full queue refuses the push
+
+	for (int i = 0 ; i < 8 ; i++)
+		q.push(vec_value<Queue>(i));
+	fd << "\'Spsc\' test 2: " << q.try_push(vec_value<Queue>(8)) << " " << q.front() << " ";
+	q.pop();
+	fd << q.try_push(vec_value<Queue>(9)) << " ";
+	sq_dump(fd, q);
+
+	// Wrap around the ring, one element at a time
+
+	for (int i = 0 ; i < 0x20 ; i++)
+	{
+		q.push(vec_value<Queue>(i));
+		if (i % 2)
+		{
+			q.try_pop(x);
+			q.try_pop(x);
+		}
+	}
+	fd << "\'Spsc\' test 3: " << x << " ";
+	sq_dump(fd, q);
+}
+
+template <typename Queue, typename T>
+inline static void test_sq_batch(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- BATCH ----------------" << std::endl;
+
+	Queue	q(8);
+	T		src[0x10];
+	T		dst[0x10];
+
+	for (int i = 0 ; i < 0x10 ; i++)
+		src[i] = vec_value<Queue>(i);
+
+	// Partial pushes when the ring fills up, batches crossing its end
+
+	fd << "\'Batch\' test 1: " << q.try_push_n(src, 5) << " " << q.try_pop_n(dst, 3) << " " << dst[0] << " " << dst[2] << std::endl;
+	fd << "\'Batch\' test 2: " << q.try_push_n(src + 5, 0x10 - 5) << " " << q.size() << std::endl;
+	fd << "\'Batch\' test 3: " << q.try_push_n(src, 1) << " " << q.try_pop_n(dst, 0x10) << " " << dst[0] << " " << dst[7] << std::endl;
+	fd << "\'Batch\' test 4: " << q.try_pop_n(dst, 0x10) << " " << q.try_push_n(src, 0) << " ";
+	sq_dump(fd, q);
+}
+
+template <typename Queue, typename T>
+inline static void test_sq_two_threads(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- TWO THREADS ----------------" << std::endl;
+
+	static const int	amount = 0x20000;
+	Queue				q(0x40);
+	long				sum = 0;
+	bool				ordered = true;
+
+	// Single and batched pushes against batched pops, values must come out in order
+
+	std::thread producer([&q]()
+	{
+		T src[0x10];
+
+		for (int i = 0 ; i < amount ; )
+		{
+			if (i % 3)
+				q.push(T(i++));
+			else
+			{
+				int n = 0;
+
+				for ( ; n < 0x10 && i + n < amount ; n++)
+					src[n] = T(i + n);
+				i += int(q.try_push_n(src, size_t(n)));
+			}
+		}
+	});
+
+	T		dst[0x10];
+	int		expected = 0;
+
+	while (expected < amount)
+	{
+		const size_t n = q.try_pop_n(dst, 0x10);
+
+		for (size_t i = 0 ; i < n ; i++, expected++)
+		{
+			ordered = ordered && dst[i] == T(expected);
+			sum += dst[i];
+		}
+		if (!n)
+			std::this_thread::yield();
+	}
+	producer.join();
+	fd << "\'Threads\' test 1: " << expected << " " << sum << " " << ordered << " " << q.empty() << std::endl;
+}
+
+template <typename Queue, typename IntQueue>
+inline static void start_spsc_queue_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_sq_single_thread<Queue, typename Queue::value_type>,
+		&test_sq_batch<Queue, typename Queue::value_type>,
+		&test_sq_two_threads<IntQueue, typename IntQueue::value_type>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+inline static void spsc_queue_tests()
+{
+	start_spsc_queue_tests<sq_model<std::string>, sq_model<long> >(std::string(std::string(std::string(TEST_DIR) + std::string(STD_SPSC_QUEUE_FILENAME))));
+	start_spsc_queue_tests<ft::spsc_queue<std::string>, ft::spsc_queue<long> >(std::string(std::string(std::string(TEST_DIR) + std::string(FT_SPSC_QUEUE_FILENAME))));
+}
@@ -94,6 +94,45 @@
 # ifndef FT_MULTISET_FILENAME
 #  define FT_MULTISET_FILENAME "ft_multiset_test"
 # endif
+# ifndef FT_SMALL_VECTOR_FILENAME
+#  define FT_SMALL_VECTOR_FILENAME "ft_small_vector_test"
+# endif
+# ifndef FT_DEQUE_ERASE_FILENAME
+#  define FT_DEQUE_ERASE_FILENAME "ft_deque_erase_test"
+# endif
+# ifndef FT_VECTOR_COPY_FILENAME
+#  define FT_VECTOR_COPY_FILENAME "ft_vector_copy_test"
+# endif
+# ifndef FT_VECTOR_ALLOCATOR_FILENAME
+#  define FT_VECTOR_ALLOCATOR_FILENAME "ft_vector_allocator_test"
+# endif
+# ifndef FT_VECTOR_ARENA_FILENAME
+#  define FT_VECTOR_ARENA_FILENAME "ft_vector_arena_test"
+# endif
+# ifndef FT_SMALL_VECTOR_ALLOCATOR_FILENAME
+#  define FT_SMALL_VECTOR_ALLOCATOR_FILENAME "ft_small_vector_allocator_test"
+# endif
+# ifndef FT_VECTOR_INSERT_FILENAME
+#  define FT_VECTOR_INSERT_FILENAME "ft_vector_insert_test"
+# endif
+# ifndef FT_VECTOR_EXCEPTION_FILENAME
+#  define FT_VECTOR_EXCEPTION_FILENAME "ft_vector_exception_test"
+# endif
+# ifndef FT_DEQUE_GROWTH_FILENAME
+#  define FT_DEQUE_GROWTH_FILENAME "ft_deque_growth_test"
+# endif
+# ifndef FT_RING_BUFFER_FILENAME
+#  define FT_RING_BUFFER_FILENAME "ft_ring_buffer_test"
+# endif
+# ifndef FT_SPSC_QUEUE_FILENAME
+#  define FT_SPSC_QUEUE_FILENAME "ft_spsc_queue_test"
+# endif
+# ifndef FT_PRIORITY_QUEUE_FILENAME
+#  define FT_PRIORITY_QUEUE_FILENAME "ft_priority_queue_test"
+# endif
+# ifndef FT_INTERVAL_MAP_FILENAME
+#  define FT_INTERVAL_MAP_FILENAME "ft_interval_map_test"
+# endif
 
 /// STD targeted tests filenames
 # ifndef STD_VECTOR_FILENAME
@@ -123,6 +162,45 @@
 # ifndef STD_MULTISET_FILENAME
 #  define STD_MULTISET_FILENAME "std_multiset_test"
 # endif
+# ifndef STD_SMALL_VECTOR_FILENAME
+#  define STD_SMALL_VECTOR_FILENAME "std_small_vector_test"
+# endif
+# ifndef STD_DEQUE_ERASE_FILENAME
+#  define STD_DEQUE_ERASE_FILENAME "std_deque_erase_test"
+# endif
+# ifndef STD_VECTOR_COPY_FILENAME
+#  define STD_VECTOR_COPY_FILENAME "std_vector_copy_test"
+# endif
+# ifndef STD_VECTOR_ALLOCATOR_FILENAME
+#  define STD_VECTOR_ALLOCATOR_FILENAME "std_vector_allocator_test"
+# endif
+# ifndef STD_VECTOR_ARENA_FILENAME
+#  define STD_VECTOR_ARENA_FILENAME "std_vector_arena_test"
+# endif
+# ifndef STD_SMALL_VECTOR_ALLOCATOR_FILENAME
+#  define STD_SMALL_VECTOR_ALLOCATOR_FILENAME "std_small_vector_allocator_test"
+# endif
+# ifndef STD_VECTOR_INSERT_FILENAME
+#  define STD_VECTOR_INSERT_FILENAME "std_vector_insert_test"
+# endif
+# ifndef STD_VECTOR_EXCEPTION_FILENAME
+#  define STD_VECTOR_EXCEPTION_FILENAME "std_vector_exception_test"
+# endif
+# ifndef STD_DEQUE_GROWTH_FILENAME
+#  define STD_DEQUE_GROWTH_FILENAME "std_deque_growth_test"
+# endif
+# ifndef STD_RING_BUFFER_FILENAME
+#  define STD_RING_BUFFER_FILENAME "std_ring_buffer_test"
+# endif
+# ifndef STD_SPSC_QUEUE_FILENAME
+#  define STD_SPSC_QUEUE_FILENAME "std_spsc_queue_test"
+# endif
+# ifndef STD_PRIORITY_QUEUE_FILENAME
+#  define STD_PRIORITY_QUEUE_FILENAME "std_priority_queue_test"
+# endif
+# ifndef STD_INTERVAL_MAP_FILENAME
+#  define STD_INTERVAL_MAP_FILENAME "std_interval_map_test"
+# endif
 
 template <typename, typename>
 struct are_same
@@ -0,0 +1,495 @@
+# pragma once
+
+# include <iostream>
+# include <fstream>
+# include <utility>
+# include <iterator>
+
+# include <map>
+# include <set>
+# include <vector>
+
+# include "../source_code/map.hpp"
+# include "../source_code/multimap.hpp"
+# include "../source_code/set.hpp"
+# include "../source_code/multiset.hpp"
+
+/*
+* Tests shared by map, set, multimap and multiset. The values are built
+* and printed through the overloads below, so the same test runs on the
+* std::pair of the maps and on the plain keys of the sets.
+*/
+
+template <typename T>
+inline static T tree_value(int k, int, const T*)
+{ return (T(k)); }
+
+template <typename K, typename V>
+inline static std::pair<K, V> tree_value(int k, int v, const std::pair<K, V>*)
+{ return (std::pair<K, V>(k, v)); }
+
+template <typename Container>
+inline static typename Container::value_type tree_value(int k, int v)
+{ return (tree_value(k, v, static_cast<const typename Container::value_type*>(0))); }
+
+template <typename T>
+inline static void tree_print(std::ofstream& fd, const T& value)
+{ fd << value << " "; }
+
+template <typename K, typename V>
+inline static void tree_print(std::ofstream& fd, const std::pair<K, V>& value)
+{ fd << value.first << ":" << value.second << " "; }
+
+/// Prints the size, then the elements forward and backward.
+template <typename Container>
+inline static void tree_dump(std::ofstream& fd, const Container& c)
+{
+	fd << c.size() << " { ";
+	for (typename Container::const_iterator it = c.begin() ; it != c.end() ; ++it)
+		tree_print(fd, *it);
+	fd << "} { ";
+	for (typename Container::const_iterator it = c.end() ; it != c.begin() ; )
+		tree_print(fd, *--it);
+	fd << "}" << std::endl;
+}
+
+/// Inserts the keys [0, n) in a scrambled order, 1 to 3 times each.
+template <typename Container>
+inline static void tree_fill(Container& c, int n)
+{
+	for (int i = 0 ; i < n ; i++)
+	{
+		const int k = (i * 37) % n;
+
+		for (int j = 0 ; j <= k % 3 ; j++)
+			c.insert(tree_value<Container>(k, j));
+	}
+}
+
+/*
+* nth and rank are ft extensions: the std trees walk from begin() instead,
+* like the baseline of benchmarks/map_bench.cpp.
+*/
+
+template <typename Container>
+inline static typename Container::const_iterator tree_nth(const Container& c, size_t n)
+{ return (c.nth(n)); }
+
+template <typename Container>
+inline static size_t tree_rank(const Container& c, const typename Container::key_type& k)
+{ return (c.rank(k)); }
+
+template <typename Container>
+inline static typename Container::const_iterator tree_std_nth(const Container& c, size_t n)
+{ return (n < c.size() ? std::next(c.begin(), n) : c.end()); }
+
+template <typename Container>
+inline static size_t tree_std_rank(const Container& c, const typename Container::key_type& k)
+{ return (size_t(std::distance(c.begin(), c.lower_bound(k)))); }
+
+template <typename K, typename V, typename C, typename A>
+inline static typename std::map<K, V, C, A>::const_iterator tree_nth(const std::map<K, V, C, A>& c, size_t n)
+{ return (tree_std_nth(c, n)); }
+
+template <typename K, typename V, typename C, typename A>
+inline static typename std::multimap<K, V, C, A>::const_iterator tree_nth(const std::multimap<K, V, C, A>& c, size_t n)
+{ return (tree_std_nth(c, n)); }
+
+template <typename K, typename C, typename A>
+inline static typename std::set<K, C, A>::const_iterator tree_nth(const std::set<K, C, A>& c, size_t n)
+{ return (tree_std_nth(c, n)); }
+
+template <typename K, typename C, typename A>
+inline static typename std::multiset<K, C, A>::const_iterator tree_nth(const std::multiset<K, C, A>& c, size_t n)
+{ return (tree_std_nth(c, n)); }
+
+template <typename K, typename V, typename C, typename A>
+inline static size_t tree_rank(const std::map<K, V, C, A>& c, const K& k)
+{ return (tree_std_rank(c, k)); }
+
+template <typename K, typename V, typename C, typename A>
+inline static size_t tree_rank(const std::multimap<K, V, C, A>& c, const K& k)
+{ return (tree_std_rank(c, k)); }
+
+template <typename K, typename C, typename A>
+inline static size_t tree_rank(const std::set<K, C, A>& c, const K& k)
+{ return (tree_std_rank(c, k)); }
+
+template <typename K, typename C, typename A>
+inline static size_t tree_rank(const std::multiset<K, C, A>& c, const K& k)
+{ return (tree_std_rank(c, k)); }
+
+/// Prints nth for every index up to size(), then rank for every key around the range.
+template <typename Container>
+inline static void tree_dump_order(std::ofstream& fd, const Container& c, int n)
+{
+	fd << c.size() << " { ";
+	for (size_t i = 0 ; i < c.size() ; i++)
+		tree_print(fd, *tree_nth(c, i));
+	fd << "} " << bool(tree_nth(c, c.size()) == c.end()) << bool(tree_nth(c, c.size() + 1) == c.end()) << " { ";
+	for (int k = -1 ; k <= n ; k++)
+		fd << tree_rank(c, k) << " ";
+	fd << "}" << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void test_tree_erase(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- ERASE ----------------" << std::endl;
+
+	Container c;
+
+	tree_fill(c, 0x80);
+	fd << "\'Erase\' test 1: ";
+	tree_dump(fd, c);
+
+	// by key, in an other scrambled order: every rebalance case shows up
+
+	size_t erased = 0;
+
+	for (int i = 0 ; i < 0x80 ; i += 2)
+		erased += c.erase(T((i * 53) % 0x80));
+	fd << "\'Erase\' test 2: " << erased << " ";
+	tree_dump(fd, c);
+
+	// absent key
+
+	fd << "\'Erase\' test 3: " << c.erase(T(0x1000)) << " " << c.erase(T(-1)) << " ";
+	tree_dump(fd, c);
+
+	// by position, every other element
+
+	for (typename Container::iterator it = c.begin() ; it != c.end() ; )
+	{
+		c.erase(it++);
+		if (it != c.end())
+			++it;
+	}
+	fd << "\'Erase\' test 4: ";
+	tree_dump(fd, c);
+
+	// range, then everything
+
+	typename Container::iterator first = c.begin();
+	typename Container::iterator last = c.end();
+
+	for (size_t i = 0 ; i < 3 ; i++)
+	{
+		++first;
+		--last;
+	}
+	c.erase(first, last);
+	fd << "\'Erase\' test 5: ";
+	tree_dump(fd, c);
+	while (!c.empty())
+		c.erase(c.begin());
+	fd << "\'Erase\' test 6: " << bool(c.begin() == c.end()) << " ";
+	tree_dump(fd, c);
+
+	// the tree is still usable once emptied
+
+	tree_fill(c, 0x10);
+	fd << "\'Erase\' test 7: ";
+	tree_dump(fd, c);
+}
+
+template <typename Container, typename T>
+inline static void test_tree_equal_range(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- EQUAL RANGE / COUNT ----------------" << std::endl;
+
+	Container c;
+
+	tree_fill(c, 0x40);
+	for (int i = 0 ; i < 0x40 ; i += 7)
+		c.erase(T(i));
+
+	// below the first key, present, erased, above the last key
+
+	static const int keys[] = {-5, 0, 1, 2, 5, 7, 8, 31, 62, 63, 64, 100};
+
+	for (size_t i = 0 ; i < ARRAY_SIZE(keys) ; i++)
+	{
+		const std::pair<typename Container::iterator, typename Container::iterator> range = c.equal_range(T(keys[i]));
+		size_t n = 0;
+
+		fd << "\'Equal range\' test " << i + 1 << ": " << c.count(T(keys[i])) << " ";
+		for (typename Container::iterator it = range.first ; it != range.second ; ++it, ++n)
+			tree_print(fd, *it);
+		fd << n << " " << bool(range.first == c.lower_bound(T(keys[i])))
+		<< bool(range.second == c.upper_bound(T(keys[i]))) << bool(range.second == c.end()) << std::endl;
+	}
+}
+
+template <typename Container, typename T>
+inline static void test_tree_const_iterators(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- CONST ITERATORS ----------------" << std::endl;
+
+	Container c;
+
+	tree_fill(c, 0x20);
+
+	const Container& cc = c;
+
+	// forward, then backward through the reverse iterators
+
+	fd << "\'Const iterators\' test 1: ";
+	for (typename Container::const_iterator it = cc.begin() ; it != cc.end() ; it++)
+		tree_print(fd, *it);
+	fd << std::endl << "\'Const iterators\' test 2: ";
+	for (typename Container::const_reverse_iterator it = cc.rbegin() ; it != cc.rend() ; ++it)
+		tree_print(fd, *it);
+
+	// conversion from iterator, lookups on the const tree
+
+	const typename Container::const_iterator found = cc.find(T(9));
+	typename Container::const_iterator it = c.begin();
+
+	fd << std::endl << "\'Const iterators\' test 3: " << bool(it == cc.begin()) << " "
+	<< bool(found != cc.end()) << " " << bool(cc.find(T(0x20)) == cc.end()) << " ";
+	tree_print(fd, *found);
+	tree_print(fd, *cc.lower_bound(T(10)));
+	tree_print(fd, *--cc.upper_bound(T(10)));
+	fd << cc.count(T(11)) << " ";
+
+	const std::pair<typename Container::const_iterator, typename Container::const_iterator> range = cc.equal_range(T(11));
+
+	for (typename Container::const_iterator it = range.first ; it != range.second ; ++it)
+		tree_print(fd, *it);
+	fd << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void test_tree_order_statistics(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- NTH / RANK ----------------" << std::endl;
+
+	Container c;
+
+	fd << "\'Nth rank\' test 1: ";
+	tree_dump_order(fd, c, 0);
+	tree_fill(c, 0x40);
+	fd << "\'Nth rank\' test 2: ";
+	tree_dump_order(fd, c, 0x40);
+
+	// the subtree sizes follow the erase rebalances
+
+	for (int i = 0 ; i < 0x40 ; i += 3)
+		c.erase(T((i * 29) % 0x40));
+	fd << "\'Nth rank\' test 3: ";
+	tree_dump_order(fd, c, 0x40);
+
+	typename Container::iterator first = c.begin();
+	typename Container::iterator last = c.end();
+
+	for (size_t i = 0 ; i < 5 ; i++)
+		++first;
+	for (size_t i = 0 ; i < 9 ; i++)
+		--last;
+	c.erase(first, last);
+	fd << "\'Nth rank\' test 4: ";
+	tree_dump_order(fd, c, 0x40);
+
+	// and the hinted inserts
+
+	for (int i = 0x40 ; i < 0x50 ; i++)
+		c.insert(c.end(), tree_value<Container>(i, 0));
+	for (int i = 0x20 ; i < 0x30 ; i++)
+		c.insert(c.begin(), tree_value<Container>(i, 1));
+	fd << "\'Nth rank\' test 5: ";
+	tree_dump_order(fd, c, 0x50);
+}
+
+/*
+* The sorted_unique and sorted_equivalent tags are ft extensions: the std
+* trees take the plain range insert.
+*/
+
+template <typename Container, typename InputIt>
+inline static void tree_insert_sorted(Container& c, InputIt first, InputIt last)
+{ c.insert(first, last); }
+
+template <typename K, typename V, typename C, typename A, typename InputIt>
+inline static void tree_insert_sorted(ft::map<K, V, C, A>& c, InputIt first, InputIt last)
+{ c.insert(ft::sorted_unique, first, last); }
+
+template <typename K, typename C, typename A, typename InputIt>
+inline static void tree_insert_sorted(ft::set<K, C, A>& c, InputIt first, InputIt last)
+{ c.insert(ft::sorted_unique, first, last); }
+
+template <typename K, typename V, typename C, typename A, typename InputIt>
+inline static void tree_insert_sorted(ft::multimap<K, V, C, A>& c, InputIt first, InputIt last)
+{ c.insert(ft::sorted_equivalent, first, last); }
+
+template <typename K, typename C, typename A, typename InputIt>
+inline static void tree_insert_sorted(ft::multiset<K, C, A>& c, InputIt first, InputIt last)
+{ c.insert(ft::sorted_equivalent, first, last); }
+
+/// Erases then inserts around a built tree, the dumps catch a broken shape.
+template <typename Container, typename T>
+inline static void tree_dump_after_updates(std::ofstream& fd, Container& c, int n)
+{
+	for (int i = 0 ; i < n ; i += 3)
+		c.erase(T(i));
+	for (int i = -2 ; i < n + 2 ; i += 4)
+		c.insert(tree_value<Container>(i, 7));
+	tree_dump_order(fd, c, n + 2);
+}
+
+template <typename Container, typename T>
+inline static void test_tree_sorted_build(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- SORTED BUILD ----------------" << std::endl;
+
+	typedef std::vector<typename Container::value_type> Values;
+
+	// Sorted ranges of every shape: empty, single node, full and partial last level
+
+	static const int sizes[] = {0, 1, 2, 3, 7, 8, 0x40, 0x41, 0x5d};
+
+	for (size_t i = 0 ; i < ARRAY_SIZE(sizes) ; i++)
+	{
+		Values v;
+
+		for (int k = 0 ; k < sizes[i] ; k++)
+			v.push_back(tree_value<Container>(k, k % 3));
+
+		Container c(v.begin(), v.end());
+		Container t;
+
+		tree_insert_sorted(t, v.begin(), v.end());
+		fd << "'Sorted build' test " << i + 1 << ": " << bool(c == t) << " ";
+		tree_dump_order(fd, c, sizes[i]);
+		fd << "'Sorted build' test " << i + 1 << " updates: ";
+		tree_dump_after_updates<Container, T>(fd, t, sizes[i]);
+	}
+
+	// Equal keys (not for the sorted_unique tag): skipped by the unique
+	// trees, kept in order by the others
+
+	Values v;
+
+	for (int k = 0 ; k < 0x20 ; k++)
+		for (int j = 0 ; j <= k % 3 ; j++)
+			v.push_back(tree_value<Container>(k, j));
+
+	Container e(v.begin(), v.end());
+	Container te;
+
+	te.insert(v.begin(), v.end());
+	fd << "'Sorted build' equal keys: " << bool(e == te) << " ";
+	tree_dump(fd, e);
+	fd << "'Sorted build' equal keys updates: ";
+	tree_dump_after_updates<Container, T>(fd, te, 0x20);
+
+	// A sorted prefix then an unsorted tail
+
+	Values p;
+
+	for (int k = 0 ; k < 0x20 ; k++)
+		p.push_back(tree_value<Container>(k * 2, 0));
+	for (int k = 0x20 ; k-- ; )
+		p.push_back(tree_value<Container>(k * 3, 1));
+
+	Container u(p.begin(), p.end());
+
+	fd << "'Sorted build' unsorted tail: ";
+	tree_dump_order(fd, u, 0x60);
+
+	// The tagged insert into a non empty tree falls back to the usual insert
+
+	Values w;
+
+	for (int k = 0 ; k < 0x30 ; k += 2)
+		w.push_back(tree_value<Container>(k, 2));
+	tree_insert_sorted(u, w.begin(), w.end());
+	fd << "'Sorted build' non empty: ";
+	tree_dump_order(fd, u, 0x60);
+}
+
+/// Hinted insert, prints the element returned and its position.
+template <typename Container>
+inline static void tree_hint_insert(std::ofstream& fd, Container& c, typename Container::iterator hint, int k, int v)
+{
+	const typename Container::iterator it = c.insert(hint, tree_value<Container>(k, v));
+	size_t n = 0;
+
+	for (typename Container::iterator pos = c.begin() ; pos != it ; ++pos)
+		n++;
+	tree_print(fd, *it);
+	fd << n << " ";
+}
+
+template <typename Container, typename T>
+inline static void test_tree_hint(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- HINTED INSERT ----------------" << std::endl;
+
+	Container c;
+
+	// Appends at end(), equal keys included
+
+	fd << "\'Hint\' test 1: ";
+	for (int k = 0 ; k < 0x10 ; k++)
+		tree_hint_insert(fd, c, c.end(), k / 2 * 4, k);
+	fd << std::endl;
+
+	// Prepends at begin()
+
+	fd << "\'Hint\' test 2: ";
+	for (int k = -1 ; k > -8 ; k--)
+		tree_hint_insert(fd, c, c.begin(), k, 0);
+	fd << std::endl;
+
+	// Right hints: just after the slot, just before it, and on an equal key
+
+	fd << "\'Hint\' test 3: ";
+	for (int k = 1 ; k < 0x20 ; k += 4)
+		tree_hint_insert(fd, c, c.lower_bound(T(k)), k, 1);
+	for (int k = 2 ; k < 0x20 ; k += 4)
+		tree_hint_insert(fd, c, --c.lower_bound(T(k)), k, 2);
+	for (int k = 0 ; k < 0x20 ; k += 8)
+		tree_hint_insert(fd, c, c.lower_bound(T(k)), k, 3);
+	for (int k = 4 ; k < 0x20 ; k += 8)
+		tree_hint_insert(fd, c, c.upper_bound(T(k)), k, 4);
+	fd << std::endl;
+
+	// Wrong hints: the insert falls back to the root descent
+
+	fd << "\'Hint\' test 4: ";
+	tree_hint_insert(fd, c, c.begin(), 0x40, 5);
+	tree_hint_insert(fd, c, c.end(), -0x40, 5);
+	tree_hint_insert(fd, c, c.find(T(8)), 3, 5);
+	tree_hint_insert(fd, c, c.find(T(8)), 0x1d, 5);
+	tree_hint_insert(fd, c, c.end(), 0x40, 6);
+	tree_hint_insert(fd, c, c.begin(), -0x40, 6);
+	fd << std::endl << "\'Hint\' test 5: ";
+	tree_dump_order(fd, c, 0x40);
+
+	// A long append run, then the tree is still balanced enough to erase
+
+	for (int k = 0x41 ; k < 0x400 ; k++)
+		c.insert(c.end(), tree_value<Container>(k, 0));
+	for (int k = 0x41 ; k < 0x400 ; k += 2)
+		c.erase(T(k));
+	fd << "\'Hint\' test 6: " << c.size() << " ";
+	tree_print(fd, *tree_nth(c, c.size() / 2));
+	tree_print(fd, *--c.end());
+	fd << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void start_tree_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_tree_erase<Container, T>,
+		&test_tree_equal_range<Container, T>,
+		&test_tree_const_iterators<Container, T>,
+		&test_tree_order_statistics<Container, T>,
+		&test_tree_sorted_build<Container, T>,
+		&test_tree_hint<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
@@ -9,6 +9,65 @@
 
 # include <vector>
 # include <string>
+# include <sstream>
+
+# include "../source_code/small_vector.hpp"
+# include "../source_code/ft_stats_allocator.hpp"
+# include "../source_code/ft_arena_allocator.hpp"
+
+template <typename T>
+inline static T vec_value(int i, const T*)
+{ return (T(i)); }
+
+inline static std::string vec_value(int i, const std::string*)
+{
+	std::ostringstream s;
+
+	s << "value_" << i;
+	return (s.str());
+}
+
+template <typename Container>
+inline static typename Container::value_type vec_value(int i)
+{ return (vec_value(i, static_cast<const typename Container::value_type*>(0))); }
+
+template <typename Container>
+inline static void vec_dump(std::ofstream& fd, const Container& c)
+{
+	fd << c.size() << " { ";
+	for (size_t i = 0 ; i < c.size() ; i++)
+		fd << c[i] << " ";
+	fd << "}" << std::endl;
+}
+
+/// Counts its live instances, its copy and move constructors throw once
+/// vec_throwing::countdown reaches 0.
+struct vec_throwing
+{
+	static int	live;
+	static int	countdown;
+
+	int			value;
+
+	vec_throwing(int v = 0) : value(v) { live++; }
+	vec_throwing(const vec_throwing& other) : value(other.value) { vec_throwing_check(); live++; }
+	vec_throwing(vec_throwing&& other) : value(other.value) { vec_throwing_check(); live++; }
+	~vec_throwing() { live--; }
+
+	vec_throwing& operator=(const vec_throwing& other) { value = other.value; return (*this); }
+
+	static void vec_throwing_check()
+	{
+		if (countdown >= 0 && countdown-- == 0)
+			throw (std::bad_alloc());
+	}
+};
+
+int vec_throwing::live = 0;
+int vec_throwing::countdown = -1;
+
+inline static std::ostream& operator<<(std::ostream& o, const vec_throwing& x)
+{ return (o << x.value); }
 
 template <typename Container, typename T>
 inline static void test_vec_constructor(std::ofstream& fd)
@@ -120,6 +179,358 @@ inline static void test_vec_resize(std::ofstream& fd)
 	} catch(...) { fd << "SUCCESS" << std::endl; }
 }
 
+template <typename Container, typename T>
+inline static void test_vec_small_sizes(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- SMALL SIZES ----------------" << std::endl;
+
+	// copy of a vector smaller than the inline storage
+
+	Container c;
+
+	c.push_back(T("first"));
+	c.push_back(T("second"));
+
+	Container copy(c);
+
+	fd << "\'Small sizes\' test 1: " << copy.size() << " { ";
+	for (size_t i = 0 ; i < copy.size() ; i++)
+		fd << copy[i] << " ";
+	fd << "}" << std::endl;
+
+	// fill constructor smaller than the inline storage
+
+	Container fill(size_t(3), T("value"));
+
+	fd << "\'Small sizes\' test 2: " << fill.size() << " { ";
+	for (size_t i = 0 ; i < fill.size() ; i++)
+		fd << fill[i] << " ";
+	fd << "}" << std::endl;
+
+	// size constructor smaller than the inline storage
+
+	Container sized(size_t(5));
+
+	fd << "\'Small sizes\' test 3: " << sized.size() << " " << sized.empty() << std::endl;
+
+	// fill constructor greather than the inline storage, then copied
+
+	Container big(size_t(0x42), T("big"));
+	Container big_copy(big);
+
+	fd << "\'Small sizes\' test 4: " << big.size() << " " << big_copy.size() << " "
+	<< big_copy.front() << " " << big_copy.back() << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void test_vec_copy_assign(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- COPY ASSIGN ----------------" << std::endl;
+
+	// source with a capacity greather than its size
+
+	Container c;
+
+	c.reserve(0x40);
+	for (int i = 0 ; i < 10 ; i++)
+		c.push_back(vec_value<Container>(i));
+
+	Container empty;
+
+	empty = c;
+	fd << "\'Copy assign\' test 1: ";
+	vec_dump(fd, empty);
+	empty.push_back(vec_value<Container>(42));
+	fd << "\'Copy assign\' test 2: ";
+	vec_dump(fd, empty);
+
+	// target already holding more elements than the source
+
+	Container big;
+
+	for (int i = 0 ; i < 0x20 ; i++)
+		big.push_back(vec_value<Container>(-i));
+	big = c;
+	fd << "\'Copy assign\' test 3: ";
+	vec_dump(fd, big);
+	big.push_back(vec_value<Container>(42));
+	fd << "\'Copy assign\' test 4: ";
+	vec_dump(fd, big);
+
+	// target holding less elements than the source
+
+	Container small;
+
+	small.push_back(vec_value<Container>(-1));
+	small = big;
+	fd << "\'Copy assign\' test 5: ";
+	vec_dump(fd, small);
+
+	// self assignment and empty source
+
+	Container& self = small;
+
+	small = self;
+	fd << "\'Copy assign\' test 6: ";
+	vec_dump(fd, small);
+	small = Container();
+	fd << "\'Copy assign\' test 7: " << small.size() << " " << small.empty() << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void start_vector_copy_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_vec_copy_assign<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+template <typename Container, typename T>
+inline static void test_vec_insert_amount(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- INSERT AMOUNT ----------------" << std::endl;
+
+	Container c(size_t(5));
+
+	for (size_t i = 0 ; i < c.size() ; i++)
+		c[i] = vec_value<Container>(int(i));
+
+	// insert nothing
+
+	c.insert(c.begin() + 2, size_t(0), vec_value<Container>(42));
+	c.insert(c.end(), size_t(0), vec_value<Container>(42));
+	fd << "\'Insert amount\' test 1: ";
+	vec_dump(fd, c);
+
+	// insert an element of the vector, with a reallocation
+
+	c.insert(c.begin() + 1, size_t(3), c[3]);
+	fd << "\'Insert amount\' test 2: ";
+	vec_dump(fd, c);
+
+	// insert an element of the vector, moved by the shift
+
+	c.reserve(c.size() + 0x10);
+	c.insert(c.begin(), size_t(2), c.back());
+	c.insert(c.begin() + 1, size_t(4), c[2]);
+	fd << "\'Insert amount\' test 3: ";
+	vec_dump(fd, c);
+}
+
+template <typename Container, typename T>
+inline static void test_vec_throwing_relocate(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- THROWING RELOCATE ----------------" << std::endl;
+
+	{
+		Container c(size_t(10));
+
+		for (size_t i = 0 ; i < c.size() ; i++)
+			c[i] = T(int(i));
+
+		// the 6th element throws while the array grows
+
+		vec_throwing::countdown = 5;
+		try {
+			c.push_back(T(42));
+			fd << "\'Throwing relocate\' test 1: FAILURE" << std::endl;
+		} catch (const std::bad_alloc&) { fd << "\'Throwing relocate\' test 1: SUCCESS" << std::endl; }
+		vec_throwing::countdown = -1;
+
+		fd << "\'Throwing relocate\' test 2: " << T::live << " ";
+		vec_dump(fd, c);
+
+		// the array still grows once nothing throws
+
+		c.push_back(T(42));
+		fd << "\'Throwing relocate\' test 3: " << T::live << " ";
+		vec_dump(fd, c);
+	}
+	fd << "\'Throwing relocate\' test 4: " << T::live << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void test_vec_small_boundary(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- SMALL BOUNDARY ----------------" << std::endl;
+
+	Container small;
+	Container big;
+
+	for (int i = 0 ; i < 3 ; i++)
+		small.push_back(vec_value<Container>(i));
+	for (int i = 0 ; i < 0x20 ; i++)
+		big.push_back(vec_value<Container>(-i));
+
+	// copy of an inline and of a heap source
+
+	Container small_copy(small);
+	Container big_copy(big);
+
+	fd << "\'Small boundary\' test 1: ";
+	vec_dump(fd, small_copy);
+	fd << "\'Small boundary\' test 2: ";
+	vec_dump(fd, big_copy);
+
+	// copy assignment across the boundary
+
+	small_copy = big;
+	big_copy = small;
+	fd << "\'Small boundary\' test 3: ";
+	vec_dump(fd, small_copy);
+	fd << "\'Small boundary\' test 4: ";
+	vec_dump(fd, big_copy);
+
+	// move construction of an inline and of a heap source
+
+	Container small_move(std::move(big_copy));
+	Container big_move(std::move(small_copy));
+
+	fd << "\'Small boundary\' test 5: " << big_copy.size() << " ";
+	vec_dump(fd, small_move);
+	fd << "\'Small boundary\' test 6: " << small_copy.size() << " ";
+	vec_dump(fd, big_move);
+
+	// move assignment across the boundary
+
+	small_move = std::move(big_move);
+	fd << "\'Small boundary\' test 7: " << big_move.size() << " ";
+	vec_dump(fd, small_move);
+	big_move = small;
+	small_move = std::move(big_move);
+	fd << "\'Small boundary\' test 8: " << big_move.size() << " ";
+	vec_dump(fd, small_move);
+
+	// swap across the boundary
+
+	small.swap(big);
+	fd << "\'Small boundary\' test 9: ";
+	vec_dump(fd, small);
+	fd << "\'Small boundary\' test 10: ";
+	vec_dump(fd, big);
+}
+
+template <typename Container, typename T>
+inline static void test_vec_stats_copy(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- STATS COPY ----------------" << std::endl;
+
+	typedef typename Container::allocator_type	allocator_type;
+
+	ft::allocation_stats	s;
+	ft::allocation_stats	t;
+	Container				c((allocator_type(s)));
+
+	for (int i = 0 ; i < 0x20 ; i++)
+		c.push_back(T(i));
+
+	// copy constructor keeps the allocator of the source
+
+	const size_t	allocations = s.allocations;
+	Container		copy(c);
+
+	fd << "\'Stats copy\' test 1: " << (&copy.get_allocator().get_stats() == &s) << " "
+	<< (s.allocations - allocations) << " " << t.allocations << " " << copy.size() << std::endl;
+
+	// copy assignment keeps the allocator of the target
+
+	Container		other((allocator_type(t)));
+
+	other = c;
+	fd << "\'Stats copy\' test 2: " << (&other.get_allocator().get_stats() == &t) << " "
+	<< (s.allocations - allocations) << " " << t.allocations << " " << other.size() << std::endl;
+}
+
+template <typename Container, typename T>
+inline static void test_vec_arena_copy(std::ofstream& fd)
+{
+	fd << std::endl << "-------------- ARENA COPY ----------------" << std::endl;
+
+	typedef typename Container::allocator_type	allocator_type;
+
+	ft::arena	a;
+	ft::arena	b;
+
+	{
+		Container	c((allocator_type(a)));
+
+		for (int i = 0 ; i < 0x20 ; i++)
+			c.push_back(T(i));
+
+		// copy constructor takes its array from the arena of the source
+
+		Container	copy(c);
+
+		fd << "\'Arena copy\' test 1: " << (&copy.get_allocator().get_arena() == &a) << " ";
+		vec_dump(fd, copy);
+
+		// copy assignment keeps the arena of the target
+
+		Container	other((allocator_type(b)));
+
+		other = copy;
+		fd << "\'Arena copy\' test 2: " << (&other.get_allocator().get_arena() == &b) << " ";
+		vec_dump(fd, other);
+	}
+	a.reset();
+	b.reset();
+}
+
+template <typename Container, typename T>
+inline static void start_vector_allocator_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_vec_stats_copy<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+template <typename Container, typename T>
+inline static void start_vector_arena_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_vec_arena_copy<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+template <typename Container, typename T>
+inline static void start_vector_insert_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_vec_insert_amount<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+template <typename Container, typename T>
+inline static void start_vector_exception_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_vec_throwing_relocate<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
+template <typename Container, typename T>
+inline static void start_small_vector_tests(const std::string& filename)
+{
+	static void (*const tests[])(std::ofstream&) = {
+		&test_vec_small_sizes<Container, T>,
+		&test_vec_copy_assign<Container, T>,
+		&test_vec_small_boundary<Container, T>,
+		&test_vec_insert_amount<Container, T>
+	};
+
+	start_tests(filename, tests, ARRAY_SIZE(tests));
+}
+
 template <typename Container, typename T>
 inline static void start_vector_tests(const std::string& filename)
 {
@@ -140,4 +551,18 @@ inline void vector_tests()
 {	
 	start_vector_tests<std::vector<int>, int>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_VECTOR_FILENAME))));
 	start_vector_tests<std::vector<int>, int>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_VECTOR_FILENAME))));
+	start_small_vector_tests<std::vector<std::string>, std::string>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_SMALL_VECTOR_FILENAME))));
+	start_small_vector_tests<ft::small_vector<std::string, 16>, std::string>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_SMALL_VECTOR_FILENAME))));
+	start_vector_insert_tests<std::vector<std::string>, std::string>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_VECTOR_INSERT_FILENAME))));
+	start_vector_insert_tests<ft::vector<std::string>, std::string>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_VECTOR_INSERT_FILENAME))));
+	start_vector_exception_tests<std::vector<vec_throwing>, vec_throwing>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_VECTOR_EXCEPTION_FILENAME))));
+	start_vector_exception_tests<ft::vector<vec_throwing>, vec_throwing>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_VECTOR_EXCEPTION_FILENAME))));
+	start_vector_copy_tests<std::vector<int>, int>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_VECTOR_COPY_FILENAME))));
+	start_vector_copy_tests<ft::vector<int>, int>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_VECTOR_COPY_FILENAME))));
+	start_vector_allocator_tests<std::vector<int, ft::stats_allocator<int> >, int>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_VECTOR_ALLOCATOR_FILENAME))));
+	start_vector_allocator_tests<ft::vector<int, ft::stats_allocator<int> >, int>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_VECTOR_ALLOCATOR_FILENAME))));
+	start_vector_arena_tests<std::vector<int, ft::arena_allocator<int> >, int>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_VECTOR_ARENA_FILENAME))));
+	start_vector_arena_tests<ft::vector<int, ft::arena_allocator<int> >, int>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_VECTOR_ARENA_FILENAME))));
+	start_vector_allocator_tests<std::vector<int, ft::stats_allocator<int> >, int>(std::string(std::string(std::string(TEST_DIR) + std::string(STD_SMALL_VECTOR_ALLOCATOR_FILENAME))));
+	start_vector_allocator_tests<ft::small_vector<int, 4, ft::stats_allocator<int> >, int>(std::string(std::string(std::string(TEST_DIR) + std::string(FT_SMALL_VECTOR_ALLOCATOR_FILENAME))));
 }
\ No newline at end of file